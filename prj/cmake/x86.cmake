@@ -81,4 +81,11 @@ if(SIMD_TEST)
 		target_link_libraries(Test ${OpenCV_LIBS})
 		target_include_directories(Test PUBLIC ${OpenCV_INCLUDE_DIRS})
 	endif()
+endif()
+
+if(SIMD_BENCH)
+	file(GLOB_RECURSE BENCH_SRC_CPP ${SIMD_ROOT}/src/Bench/*.cpp)
+	set_source_files_properties(${BENCH_SRC_CPP} PROPERTIES COMPILE_FLAGS "${COMMON_CXX_FLAGS}")
+	add_executable(Bench ${BENCH_SRC_CPP})
+	target_link_libraries(Bench Simd -lpthread -lstdc++ -lm)
 endif()
\ No newline at end of file
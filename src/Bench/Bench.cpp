@@ -0,0 +1,328 @@
+/*
+* Benchmarks for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Bench/Bench.h"
+
+#include "Simd/SimdLib.h"
+
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+
+namespace Bench
+{
+    struct Entry
+    {
+        String name;
+        ScenarioFactoryPtr factory;
+    };
+    typedef std::vector<Entry> Entries;
+
+    static Entries& GetEntries()
+    {
+        static Entries entries;
+        return entries;
+    }
+
+    bool AddScenario(const String& name, ScenarioFactoryPtr factory)
+    {
+        Entry entry;
+        entry.name = name;
+        entry.factory = factory;
+        GetEntries().push_back(entry);
+        return true;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    static String GetArg(int argc, char* argv[], const String& name, const String& default_)
+    {
+        String value = default_;
+        for (int a = 1; a < argc; ++a)
+        {
+            String arg = argv[a];
+            if (arg.substr(0, name.size() + 1) == name + "=")
+                value = arg.substr(name.size() + 1);
+        }
+        return value;
+    }
+
+    static Strings GetArgs(int argc, char* argv[], const String& name)
+    {
+        Strings values;
+        for (int a = 1; a < argc; ++a)
+        {
+            String arg = argv[a];
+            if (arg.substr(0, name.size() + 1) == name + "=")
+                values.push_back(arg.substr(name.size() + 1));
+        }
+        return values;
+    }
+
+    Options::Options(int argc, char* argv[])
+    {
+        help = false;
+        for (int a = 1; a < argc; ++a)
+            if (String(argv[a]) == "--help" || String(argv[a]) == "-?")
+                help = true;
+        include = GetArgs(argc, argv, "-fi");
+        exclude = GetArgs(argc, argv, "-fe");
+        output = GetArg(argc, argv, "-o", "");
+        baseline = GetArg(argc, argv, "-b", "");
+        root = GetArg(argc, argv, "-r", "../..");
+        time = std::max(atof(GetArg(argc, argv, "-bt", "1.0").c_str()), 0.001);
+        warmUp = std::max(atof(GetArg(argc, argv, "-wu", "0.1").c_str()), 0.0);
+        tolerance = std::max(atof(GetArg(argc, argv, "-rt", "0.1").c_str()), 0.0);
+        threads = std::max(atoi(GetArg(argc, argv, "-wt", "1").c_str()), 1);
+    }
+
+    bool Options::Required(const String& name) const
+    {
+        bool required = include.empty();
+        for (size_t i = 0; i < include.size() && !required; ++i)
+            if (name.find(include[i]) != String::npos)
+                required = true;
+        for (size_t i = 0; i < exclude.size() && required; ++i)
+            if (name.find(exclude[i]) != String::npos)
+                required = false;
+        return required;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    struct Result
+    {
+        String name, unit;
+        size_t iterations, items;
+        double total, throughput, min, p50, p90, p99, max;
+    };
+    typedef std::vector<Result> Results;
+
+    static double Time()
+    {
+        using namespace std::chrono;
+        return duration_cast<duration<double>>(high_resolution_clock::now().time_since_epoch()).count();
+    }
+
+    static double Percentile(const std::vector<double>& sorted, double p)
+    {
+        if (sorted.empty())
+            return 0.0;
+        double pos = p * double(sorted.size() - 1);
+        size_t lo = (size_t)pos, hi = std::min(lo + 1, sorted.size() - 1);
+        return sorted[lo] + (sorted[hi] - sorted[lo]) * (pos - double(lo));
+    }
+
+    static bool Run(const Entry& entry, const Options& options, Result& result)
+    {
+        ScenarioPtr scenario(entry.factory());
+        if (!scenario->Init(options))
+        {
+            std::cout << "Can't init scenario " << entry.name << " !" << std::endl;
+            return false;
+        }
+        for (double start = Time(); Time() - start < options.warmUp;)
+            scenario->Run();
+        std::vector<double> latencies;
+        double start = Time(), current = start;
+        do
+        {
+            scenario->Run();
+            double finish = Time();
+            latencies.push_back((finish - current) * 1000.0);
+            current = finish;
+        } while (current - start < options.time);
+        std::sort(latencies.begin(), latencies.end());
+        result.name = entry.name;
+        result.unit = scenario->Unit();
+        result.iterations = latencies.size();
+        result.items = latencies.size() * scenario->Items();
+        result.total = current - start;
+        result.throughput = double(result.items) / result.total;
+        result.min = latencies.front();
+        result.p50 = Percentile(latencies, 0.50);
+        result.p90 = Percentile(latencies, 0.90);
+        result.p99 = Percentile(latencies, 0.99);
+        result.max = latencies.back();
+        return true;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    static String Isa()
+    {
+        std::stringstream ss;
+        ss << "[";
+        const char* names[] = { "SSE4.1", "AVX2", "AVX-512BW", "AVX-512VNNI", "AMX-BF16", "NEON" };
+        const SimdCpuInfoType types[] = { SimdCpuInfoSse41, SimdCpuInfoAvx2, SimdCpuInfoAvx512bw,
+            SimdCpuInfoAvx512vnni, SimdCpuInfoAmxBf16, SimdCpuInfoNeon };
+        bool first = true;
+        for (size_t i = 0; i < 6; ++i)
+        {
+            if (SimdCpuInfo(types[i]))
+            {
+                ss << (first ? "" : ", ") << "\"" << names[i] << "\"";
+                first = false;
+            }
+        }
+        ss << "]";
+        return ss.str();
+    }
+
+    static String ToJson(const Results& results, const Options& options)
+    {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(4);
+        ss << "{" << std::endl;
+        ss << "  \"version\": \"" << SimdVersion() << "\"," << std::endl;
+        ss << "  \"cpu\": \"" << SimdCpuDesc(SimdCpuDescModel) << "\"," << std::endl;
+        ss << "  \"isa\": " << Isa() << "," << std::endl;
+        ss << "  \"threads\": " << options.threads << "," << std::endl;
+        ss << "  \"scenarios\": [" << std::endl;
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result& r = results[i];
+            ss << "    { \"name\": \"" << r.name << "\", \"unit\": \"" << r.unit << "\", ";
+            ss << "\"iterations\": " << r.iterations << ", \"throughput\": " << r.throughput << ", ";
+            ss << "\"latency\": { \"min\": " << r.min << ", \"p50\": " << r.p50 << ", \"p90\": " << r.p90;
+            ss << ", \"p99\": " << r.p99 << ", \"max\": " << r.max << " } }";
+            ss << (i + 1 < results.size() ? "," : "") << std::endl;
+        }
+        ss << "  ]" << std::endl;
+        ss << "}" << std::endl;
+        return ss.str();
+    }
+
+    static bool FindValue(const String& json, size_t begin, size_t end, const String& key, double& value)
+    {
+        size_t pos = json.find("\"" + key + "\"", begin);
+        if (pos == String::npos || pos >= end)
+            return false;
+        pos = json.find(':', pos);
+        if (pos == String::npos || pos >= end)
+            return false;
+        value = atof(json.c_str() + pos + 1);
+        return true;
+    }
+
+    static bool Compare(const Results& results, const Options& options)
+    {
+        std::ifstream ifs(options.baseline.c_str());
+        if (!ifs.is_open())
+        {
+            std::cout << "Can't open baseline file '" << options.baseline << "' !" << std::endl;
+            return false;
+        }
+        std::stringstream buffer;
+        buffer << ifs.rdbuf();
+        String json = buffer.str();
+        bool ok = true;
+        std::cout << std::endl << "Comparison with baseline '" << options.baseline << "' (tolerance " << options.tolerance * 100.0 << "%):" << std::endl;
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result& r = results[i];
+            size_t begin = json.find("\"name\": \"" + r.name + "\"");
+            if (begin == String::npos)
+            {
+                std::cout << " " << r.name << ": absent in baseline." << std::endl;
+                continue;
+            }
+            size_t end = json.find('}', json.find('}', begin) + 1);
+            double throughput, p50;
+            if (!FindValue(json, begin, end, "throughput", throughput) || !FindValue(json, begin, end, "p50", p50))
+            {
+                std::cout << " " << r.name << ": wrong baseline format!" << std::endl;
+                ok = false;
+                continue;
+            }
+            double ratio = throughput > 0.0 ? r.throughput / throughput : 1.0;
+            bool regression = r.throughput < throughput * (1.0 - options.tolerance) || r.p50 > p50 * (1.0 + options.tolerance);
+            std::cout << " " << r.name << ": " << std::fixed << std::setprecision(2) << r.throughput << " vs " << throughput;
+            std::cout << " " << r.unit << "/s (x" << std::setprecision(3) << ratio << ")" << (regression ? " - REGRESSION!" : "") << std::endl;
+            if (regression)
+                ok = false;
+        }
+        return ok;
+    }
+
+    static void PrintHelp()
+    {
+        std::cout << "Bench is a utility for end-to-end benchmarking of Simd Library." << std::endl << std::endl;
+        std::cout << "Its parameters:" << std::endl;
+        std::cout << " -fi=scenario  - include scenarios which contain given substring (can be several)." << std::endl;
+        std::cout << " -fe=scenario  - exclude scenarios which contain given substring (can be several)." << std::endl;
+        std::cout << " -bt=1.0       - a measurement time for every scenario (in seconds)." << std::endl;
+        std::cout << " -wu=0.1       - a warm up time for every scenario (in seconds)." << std::endl;
+        std::cout << " -wt=1         - a number of Simd Library internal threads." << std::endl;
+        std::cout << " -r=../..      - a path to the root of repository (to find test data)." << std::endl;
+        std::cout << " -o=out.json   - a path to output JSON report." << std::endl;
+        std::cout << " -b=base.json  - a path to baseline JSON report to compare with." << std::endl;
+        std::cout << " -rt=0.1       - a relative tolerance of regression detection." << std::endl;
+        std::cout << " -?, --help    - print this help." << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Bench::Options options(argc, argv);
+    if (options.help)
+    {
+        Bench::PrintHelp();
+        return 0;
+    }
+    SimdSetThreadNumber(options.threads);
+
+    Bench::Results results;
+    const Bench::Entries& entries = Bench::GetEntries();
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        if (!options.Required(entries[i].name))
+            continue;
+        Bench::Result result;
+        if (!Bench::Run(entries[i], options, result))
+            return 1;
+        std::cout << std::fixed << std::setprecision(3) << result.name << ": " << result.throughput << " " << result.unit << "/s, latency ms:";
+        std::cout << " p50 = " << result.p50 << ", p90 = " << result.p90 << ", p99 = " << result.p99 << "." << std::endl;
+        results.push_back(result);
+    }
+
+    Bench::String json = Bench::ToJson(results, options);
+    if (options.output.size())
+    {
+        std::ofstream ofs(options.output.c_str());
+        if (!ofs.is_open())
+        {
+            std::cout << "Can't open output file '" << options.output << "' !" << std::endl;
+            return 1;
+        }
+        ofs << json;
+    }
+
+    if (options.baseline.size() && !Bench::Compare(results, options))
+        return 2;
+
+    return 0;
+}
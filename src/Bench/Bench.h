@@ -0,0 +1,78 @@
+/*
+* Benchmarks for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __Bench_h__
+#define __Bench_h__
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <iostream>
+#include <sstream>
+
+namespace Bench
+{
+    typedef std::string String;
+    typedef std::vector<String> Strings;
+
+    struct Options
+    {
+        Strings include, exclude;
+        String output, baseline, root;
+        double time, warmUp, tolerance;
+        size_t threads;
+        bool help;
+
+        Options(int argc, char* argv[]);
+
+        bool Required(const String& name) const;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class Scenario
+    {
+    public:
+        virtual ~Scenario() {}
+
+        virtual bool Init(const Options& options) = 0;
+
+        virtual void Run() = 0;
+
+        virtual size_t Items() const { return 1; }
+
+        virtual String Unit() const { return "item"; }
+    };
+    typedef std::shared_ptr<Scenario> ScenarioPtr;
+
+    typedef Scenario* (*ScenarioFactoryPtr)();
+
+    bool AddScenario(const String& name, ScenarioFactoryPtr factory);
+}
+
+#define BENCH_ADD_SCENARIO(name) \
+    namespace Bench { \
+    Scenario * Create##name() { return new name(); } \
+    bool name##AtList = AddScenario(#name, Create##name); }
+
+#endif
@@ -0,0 +1,99 @@
+/*
+* Benchmarks for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Bench/Bench.h"
+
+#include "Simd/SimdLib.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace Bench
+{
+    /*! Top-K cosine similarity search of compressed (DescrInt) descriptors. */
+    class DescrIntTopK : public Scenario
+    {
+    public:
+        DescrIntTopK()
+            : _context(NULL)
+        {
+        }
+
+        virtual ~DescrIntTopK()
+        {
+            if (_context)
+                SimdRelease(_context);
+        }
+
+        virtual bool Init(const Options& options)
+        {
+            const size_t size = 512, depth = 7;
+            _M = 16, _N = 16384, _K = 10;
+            _context = SimdDescrIntInit(size, depth);
+            if (_context == NULL)
+                return false;
+            size_t encoded = SimdDescrIntEncodedSize(_context);
+            std::vector<float> original(size);
+            _a.resize(_M * encoded);
+            _b.resize(_N * encoded);
+            srand(0);
+            for (size_t i = 0; i < _M + _N; ++i)
+            {
+                for (size_t j = 0; j < size; ++j)
+                    original[j] = float(rand()) / float(RAND_MAX) * 2.0f - 1.0f;
+                SimdDescrIntEncode32f(_context, original.data(), i < _M ? _a.data() + i * encoded : _b.data() + (i - _M) * encoded);
+            }
+            _distances.resize(_M * _N);
+            _indices.resize(_N);
+            _top.resize(_M * _K);
+            return true;
+        }
+
+        virtual void Run()
+        {
+            SimdDescrIntCosineDistancesMxNp(_context, _M, _N, _a.data(), _b.data(), _distances.data());
+            for (size_t i = 0; i < _M; ++i)
+            {
+                const float* distances = _distances.data() + i * _N;
+                for (size_t j = 0; j < _N; ++j)
+                    _indices[j] = j;
+                std::partial_sort(_indices.begin(), _indices.begin() + _K, _indices.end(),
+                    [distances](size_t a, size_t b) { return distances[a] < distances[b]; });
+                std::copy(_indices.begin(), _indices.begin() + _K, _top.begin() + i * _K);
+            }
+        }
+
+        virtual size_t Items() const { return _M; }
+
+        virtual String Unit() const { return "query"; }
+
+    private:
+        void* _context;
+        size_t _M, _N, _K;
+        std::vector<uint8_t> _a, _b;
+        std::vector<float> _distances;
+        std::vector<size_t> _indices, _top;
+    };
+}
+
+BENCH_ADD_SCENARIO(DescrIntTopK);
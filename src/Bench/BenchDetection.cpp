@@ -0,0 +1,67 @@
+/*
+* Benchmarks for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Bench/Bench.h"
+
+#include "Simd/SimdDetection.hpp"
+
+namespace Bench
+{
+    /*! HAAR cascade face detection over an image pyramid. */
+    class DetectionHaar : public Scenario
+    {
+    public:
+        typedef Simd::Detection<Simd::Allocator> Detection;
+
+        virtual bool Init(const Options& options)
+        {
+            String cascade = options.root + "/data/cascade/haar_face_0.xml";
+            String image = options.root + "/data/image/face/lena.pgm";
+            if (!_detection.Load(cascade))
+            {
+                std::cout << "Can't load cascade '" << cascade << "' !" << std::endl;
+                return false;
+            }
+            if (!_image.Load(image, Detection::View::Gray8))
+            {
+                std::cout << "Can't load image '" << image << "' !" << std::endl;
+                return false;
+            }
+            return _detection.Init(_image.Size(), 1.1, _image.Size() / 20, _image.Size(), Detection::View(), options.threads);
+        }
+
+        virtual void Run()
+        {
+            Detection::Objects objects;
+            _detection.Detect(_image, objects);
+        }
+
+        virtual String Unit() const { return "frame"; }
+
+    private:
+        Detection _detection;
+        Detection::View _image;
+    };
+}
+
+BENCH_ADD_SCENARIO(DetectionHaar);
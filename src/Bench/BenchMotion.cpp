@@ -0,0 +1,93 @@
+/*
+* Benchmarks for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Bench/Bench.h"
+
+#include "Simd/SimdMotion.hpp"
+
+namespace Bench
+{
+    /*! Motion::Detector over synthetic video: a textured static scene with several moving objects. */
+    class MotionDetector : public Scenario
+    {
+    public:
+        typedef Simd::Motion::View View;
+        typedef Simd::Motion::Frame Frame;
+
+        virtual bool Init(const Options& options)
+        {
+            const size_t W = 640, H = 360, N = 64;
+            View background(W, H, View::Gray8);
+            for (size_t y = 0; y < H; ++y)
+                for (size_t x = 0; x < W; ++x)
+                    background.At<uint8_t>(x, y) = uint8_t(96 + ((x * 7 + y * 13) % 32) + ((x / 40 + y / 40) % 2) * 16);
+            _frames.resize(N);
+            for (size_t i = 0; i < N; ++i)
+            {
+                _frames[i].Recreate(W, H, View::Gray8);
+                Simd::Copy(background, _frames[i]);
+                for (size_t o = 0; o < 3; ++o)
+                {
+                    ptrdiff_t size = 24 + o * 12, x = (i * (4 + o * 2) + o * 150) % (W - size), y = 60 + o * 100;
+                    Simd::Fill(_frames[i].Region(x, y, x + size, y + size).Ref(), uint8_t(220 - o * 60));
+                }
+            }
+            _index = 0;
+            _time = 0.0;
+            return true;
+        }
+
+        virtual void Run()
+        {
+            Frame input(_frames[_index], false, _time);
+            Simd::Motion::Metadata metadata;
+            _detector.NextFrame(input, metadata);
+            _index = (_index + 1) % _frames.size();
+            _time += 0.04;
+        }
+
+        virtual String Unit() const { return "frame"; }
+
+    protected:
+        std::vector<View> _frames;
+        Simd::Motion::Detector _detector;
+        size_t _index;
+        double _time;
+    };
+
+    /*! The same as MotionDetector but with skipping of updates in static tiles of the scene. */
+    class MotionDetectorGated : public MotionDetector
+    {
+    public:
+        virtual bool Init(const Options& options)
+        {
+            Simd::Motion::Options detectorOptions;
+            detectorOptions.ActivityGatingEnable = true;
+            _detector.SetOptions(detectorOptions);
+            return MotionDetector::Init(options);
+        }
+    };
+}
+
+BENCH_ADD_SCENARIO(MotionDetector);
+BENCH_ADD_SCENARIO(MotionDetectorGated);
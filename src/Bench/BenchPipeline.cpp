@@ -0,0 +1,109 @@
+/*
+* Benchmarks for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Bench/Bench.h"
+
+#include "Simd/SimdLib.hpp"
+
+#include <fstream>
+#include <iterator>
+
+namespace Bench
+{
+    typedef Simd::View<Simd::Allocator> View;
+    typedef std::vector<uint8_t> Buffer;
+
+    /*! JPEG decoding -> NV12 conversion -> resizing to several network input sizes -> SynetSetInput. */
+    class JpegToSynetInput : public Scenario
+    {
+    public:
+        virtual bool Init(const Options& options)
+        {
+            String path = options.root + "/data/image/city.jpg";
+            std::ifstream ifs(path.c_str(), std::ios::binary);
+            if (!ifs.is_open())
+            {
+                std::cout << "Can't open image '" << path << "' !" << std::endl;
+                return false;
+            }
+            _jpeg.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+            View bgr;
+            if (!bgr.Load(_jpeg.data(), _jpeg.size(), View::Bgr24))
+                return false;
+            size_t w = bgr.width & (~1), h = bgr.height & (~1);
+            _y.Recreate(w, h, View::Gray8);
+            _u.Recreate(w / 2, h / 2, View::Gray8);
+            _v.Recreate(w / 2, h / 2, View::Gray8);
+            _uv.Recreate(w / 2, h / 2, View::Uv16);
+            const size_t sizes[][2] = { { 640, 360 }, { 320, 320 }, { 160, 96 } };
+            _levels.resize(3);
+            for (size_t i = 0; i < _levels.size(); ++i)
+                _levels[i].Init(sizes[i][0], sizes[i][1]);
+            return true;
+        }
+
+        virtual void Run()
+        {
+            _bgr.Load(_jpeg.data(), _jpeg.size(), View::Bgr24);
+            Simd::BgrToYuv420p(_bgr.Region(_y.Size(), View::TopLeft), _y, _u, _v);
+            Simd::InterleaveUv(_u, _v, _uv);
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                Level& l = _levels[i];
+                Simd::Resize(_y, l.y, SimdResizeMethodBilinear);
+                Simd::Resize(_uv, l.uv, SimdResizeMethodBilinear);
+                Simd::DeinterleaveUv(l.uv, l.u, l.v);
+                Simd::Yuv420pToBgr(l.y, l.u, l.v, l.bgr);
+                Simd::SynetSetInput(l.bgr, l.lower, l.upper, l.tensor.data(), 3, SimdTensorFormatNchw);
+            }
+        }
+
+        virtual String Unit() const { return "frame"; }
+
+    private:
+        struct Level
+        {
+            View y, uv, u, v, bgr;
+            std::vector<float> tensor;
+            float lower[3], upper[3];
+
+            void Init(size_t w, size_t h)
+            {
+                y.Recreate(w, h, View::Gray8);
+                uv.Recreate(w / 2, h / 2, View::Uv16);
+                u.Recreate(w / 2, h / 2, View::Gray8);
+                v.Recreate(w / 2, h / 2, View::Gray8);
+                bgr.Recreate(w, h, View::Bgr24);
+                tensor.resize(3 * w * h);
+                for (size_t c = 0; c < 3; ++c)
+                    lower[c] = -1.0f, upper[c] = 1.0f;
+            }
+        };
+
+        Buffer _jpeg;
+        View _bgr, _y, _u, _v, _uv;
+        std::vector<Level> _levels;
+    };
+}
+
+BENCH_ADD_SCENARIO(JpegToSynetInput);
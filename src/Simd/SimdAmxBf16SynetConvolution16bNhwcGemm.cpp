@@ -1291,6 +1291,9 @@ namespace Simd
             case SimdConvolutionActivationGelu: Set<SimdConvolutionActivationGelu>(p, _alg, _convolutions); break;
             default: assert(0);
             }
+            Convolution convolutions[2];
+            Set<SimdConvolutionActivationIdentity>(p, _alg, convolutions);
+            _addConvolution = convolutions[1];
         }
     }
 #endif
@@ -370,6 +370,7 @@ namespace Simd
                 _gemm = InnerProduct16bGemmNN_Gemm2<Term16bLast16b>;
             else
                 _gemm = InnerProduct16bGemmNN_Gemm2<Term16bLast32f>;
+            SetGemv(_gemv);
         }
     }
 #endif
@@ -0,0 +1,76 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdConnectedComponents.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE uint64_t CcMask32(const uint8_t* src, __m256i threshold)
+        {
+            __m256i value = _mm256_loadu_si256((__m256i*)src);
+            return uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(value, threshold), value)));
+        }
+
+        static void CcMaskRow(const uint8_t* src, size_t width, uint8_t threshold, uint64_t* dst)
+        {
+            __m256i _threshold = _mm256_set1_epi8(threshold);
+            size_t width64 = AlignLo(width, 64), i = 0;
+            for (; i < width64; i += 64)
+                *dst++ = CcMask32(src + i + 0, _threshold) | (CcMask32(src + i + 32, _threshold) << 32);
+            if (i < width)
+            {
+                uint64_t bits = 0;
+                for (size_t j = 0; i + j < width; ++j)
+                    bits |= uint64_t(src[i + j] >= threshold) << j;
+                *dst = bits;
+            }
+        }
+
+        static uint64_t CcSumRow(const uint8_t* src, size_t size)
+        {
+            size_t size32 = AlignLo(size, 32), i = 0;
+            __m256i sum = _mm256_setzero_si256();
+            for (; i < size32; i += 32)
+                sum = _mm256_add_epi64(sum, _mm256_sad_epu8(_mm256_loadu_si256((__m256i*)(src + i)), _mm256_setzero_si256()));
+            uint64_t result = ExtractSum<uint64_t>(sum);
+            for (; i < size; ++i)
+                result += src[i];
+            return result;
+        }
+
+        size_t ConnectedComponents(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t threshold,
+            SimdConnectedComponentsFlags flags, uint32_t* labels, size_t labelsStride, SimdConnectedComponentStat* stats, size_t capacity)
+        {
+            static const Base::CcOps ops = { CcMaskRow, CcSumRow };
+            return Base::ConnectedComponents(ops, src, srcStride, width, height, threshold, flags, labels, labelsStride, stats, capacity);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,148 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDetectionNms.h"
+#include "Simd/SimdConst.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdSse41.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE void DecodeSsd2(const float* loc, const float* prior, const float* variance, bool clip, float* dst)
+        {
+            __m256 p = _mm256_loadu_ps(prior);
+            __m256 d = _mm256_mul_ps(_mm256_loadu_ps(loc), _mm256_loadu_ps(variance));
+            __m256 p0 = _mm256_shuffle_ps(p, p, 0x44);
+            __m256 p1 = _mm256_shuffle_ps(p, p, 0xEE);
+            __m256 pwh = _mm256_sub_ps(p1, p0);
+            __m256 c = _mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(p0, p1), _mm256_set1_ps(0.5f)), _mm256_mul_ps(_mm256_shuffle_ps(d, d, 0x44), pwh));
+            __m256 s = _mm256_mul_ps(_mm256_mul_ps(Exponent(_mm256_shuffle_ps(d, d, 0xEE)), pwh), _mm256_setr_ps(-0.5f, -0.5f, 0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f));
+            __m256 r = _mm256_add_ps(c, s);
+            if (clip)
+                r = _mm256_min_ps(_mm256_max_ps(r, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+            _mm256_storeu_ps(dst, r);
+        }
+
+        void DetectionDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t size, SimdBool clip, float* dst)
+        {
+            size_t size2 = AlignLo(size, 2), i = 0;
+            for (; i < size2; i += 2, loc += 8, prior += 8, variance += 8, dst += 8)
+                DecodeSsd2(loc, prior, variance, clip == SimdTrue, dst);
+            if (i < size)
+                Sse41::DetectionDecodeSsd32f(loc, prior, variance, size - i, clip, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static size_t ArgMax(const float* src, size_t size)
+        {
+            if (size < F)
+                return Base::ArgMax(src, size);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m256 max = _mm256_loadu_ps(src);
+            for (i = F; i < sizeF; i += F)
+                max = _mm256_max_ps(max, _mm256_loadu_ps(src + i));
+            if (sizeF < size)
+                max = _mm256_max_ps(max, _mm256_loadu_ps(src + size - F));
+            max = _mm256_max_ps(max, _mm256_permute2f128_ps(max, max, 0x01));
+            max = _mm256_max_ps(max, _mm256_shuffle_ps(max, max, 0x4E));
+            max = _mm256_max_ps(max, _mm256_shuffle_ps(max, max, 0xB1));
+            for (i = 0; i < sizeF; i += F)
+            {
+                int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(src + i), max, _CMP_EQ_OQ));
+                if (mask)
+                    return i + _tzcnt_u32(mask);
+            }
+            return sizeF + Base::ArgMax(src + sizeF, size - sizeF);
+        }
+
+        size_t DetectionDecodeYolo32f(const float* src, size_t height, size_t width, size_t anchors, size_t classes, const float* anchorSizes,
+            float threshold, float* boxes, float* scores, uint32_t* labels, size_t capacity)
+        {
+            return Base::DetectionDecodeYolo32f(src, height, width, anchors, classes, anchorSizes, threshold, boxes, scores, labels, capacity, ArgMax);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t DetectionFilterScores32f(const float* scores, size_t size, float threshold, uint32_t* indices)
+        {
+            size_t sizeF = AlignLo(size, F), count = 0, i = 0;
+            __m256 _threshold = _mm256_set1_ps(threshold);
+            for (; i < sizeF; i += F)
+            {
+                uint32_t mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(scores + i), _threshold, _CMP_GT_OQ));
+                for (; mask; mask &= mask - 1)
+                    indices[count++] = uint32_t(i + _tzcnt_u32(mask));
+            }
+            for (; i < size; ++i)
+                if (scores[i] > threshold)
+                    indices[count++] = uint32_t(i);
+            return count;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void DetectionSuppress(const Base::NmsBuffer& buf, size_t curr, size_t begin, size_t end, float iouThreshold, float sigma, bool labeled)
+        {
+            __m256 x0 = _mm256_set1_ps(buf.x0[curr]), y0 = _mm256_set1_ps(buf.y0[curr]);
+            __m256 x1 = _mm256_set1_ps(buf.x1[curr]), y1 = _mm256_set1_ps(buf.y1[curr]);
+            __m256 area = _mm256_set1_ps(buf.area[curr]), label = _mm256_set1_ps(buf.label[curr]);
+            __m256 _iouThreshold = _mm256_set1_ps(iouThreshold), _sigma = _mm256_set1_ps(sigma);
+            __m256 _0 = _mm256_setzero_ps(), _1 = _mm256_set1_ps(1.0f), _min = _mm256_set1_ps(-FLT_MAX);
+            size_t j = begin, endF = begin + AlignLo(end - begin, F);
+            for (; j < endF; j += F)
+            {
+                __m256 w = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(x1, _mm256_loadu_ps(buf.x1 + j)), _mm256_max_ps(x0, _mm256_loadu_ps(buf.x0 + j))), _0);
+                __m256 h = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(y1, _mm256_loadu_ps(buf.y1 + j)), _mm256_max_ps(y0, _mm256_loadu_ps(buf.y0 + j))), _0);
+                __m256 inter = _mm256_mul_ps(w, h);
+                __m256 uni = _mm256_sub_ps(_mm256_add_ps(area, _mm256_loadu_ps(buf.area + j)), inter);
+                __m256 same = labeled ? _mm256_cmp_ps(label, _mm256_loadu_ps(buf.label + j), _CMP_EQ_OQ) : _mm256_castsi256_ps(Avx2::K_INV_ZERO);
+                __m256 score = _mm256_loadu_ps(buf.score + j);
+                if (sigma > 0.0f)
+                {
+                    __m256 iou = _mm256_and_ps(_mm256_div_ps(inter, uni), _mm256_cmp_ps(uni, _0, _CMP_GT_OQ));
+                    __m256 decay = Exponent(_mm256_sub_ps(_0, _mm256_div_ps(_mm256_mul_ps(iou, iou), _sigma)));
+                    score = _mm256_mul_ps(score, _mm256_blendv_ps(_1, decay, same));
+                }
+                else
+                {
+                    __m256 suppress = _mm256_and_ps(_mm256_cmp_ps(inter, _mm256_mul_ps(_iouThreshold, uni), _CMP_GT_OQ), same);
+                    score = _mm256_blendv_ps(score, _min, suppress);
+                }
+                _mm256_storeu_ps(buf.score + j, score);
+            }
+            Base::DetectionSuppress(buf, curr, j, end, iouThreshold, sigma, labeled);
+        }
+
+        size_t DetectionNms32f(const float* boxes, const float* scores, const uint32_t* labels, size_t size, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* keepScores)
+        {
+            return Base::DetectionNms32f(boxes, scores, labels, size, iouThreshold, sigma, scoreThreshold, indices, keepScores, DetectionFilterScores32f, DetectionSuppress);
+        }
+    }
+#endif
+}
@@ -38,7 +38,17 @@ namespace Simd
             return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src))));
         }
 
-        SIMD_INLINE void BlurColsAny(const uint8_t* src, size_t size, size_t channels, const float* weight, size_t kernel, float* dst)
+        SIMD_INLINE __m256 LoadAs32f(const uint16_t* src)
+        {
+            return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)(src))));
+        }
+
+        SIMD_INLINE __m256 LoadAs32f(const float* src)
+        {
+            return _mm256_loadu_ps(src);
+        }
+
+        template<class T> SIMD_INLINE void BlurColsAny(const T* src, size_t size, size_t channels, const float* weight, size_t kernel, float* dst)
         {
             size_t sizeF = AlignLo(size, F);
             size_t i = 0;
@@ -58,13 +68,23 @@ namespace Simd
             }
         }
 
-        SIMD_INLINE void StoreAs8u(uint8_t* dst, const __m256& f0)
+        SIMD_INLINE void StoreAs(uint8_t* dst, const __m256& f0)
         {
             __m256i i0 = _mm256_cvtps_epi32(f0);
             ((int64_t*)dst)[0] = Extract64i<0>(PackI16ToU8(PackI32ToI16(i0, K_ZERO), K_ZERO));
         }
 
-        SIMD_INLINE void StoreAs8u(uint8_t* dst, const __m256& f0, const __m256& f1, const __m256& f2, const __m256& f3)
+        SIMD_INLINE void StoreAs(uint16_t* dst, const __m256& f0)
+        {
+            _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(PackU32ToI16(_mm256_cvtps_epi32(f0), K_ZERO)));
+        }
+
+        SIMD_INLINE void StoreAs(float* dst, const __m256& f0)
+        {
+            _mm256_storeu_ps(dst, f0);
+        }
+
+        SIMD_INLINE void StoreAs(uint8_t* dst, const __m256& f0, const __m256& f1, const __m256& f2, const __m256& f3)
         {
             __m256i i0 = _mm256_cvtps_epi32(f0);
             __m256i i1 = _mm256_cvtps_epi32(f1);
@@ -73,7 +93,21 @@ namespace Simd
             _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(PackI32ToI16(i0, i1), PackI32ToI16(i2, i3)));
         }
 
-        SIMD_INLINE void BlurRowsAny(const float* src, size_t size, size_t stride, const float* weight, size_t kernel, uint8_t* dst)
+        SIMD_INLINE void StoreAs(uint16_t* dst, const __m256& f0, const __m256& f1, const __m256& f2, const __m256& f3)
+        {
+            _mm256_storeu_si256((__m256i*)dst + 0, PackU32ToI16(_mm256_cvtps_epi32(f0), _mm256_cvtps_epi32(f1)));
+            _mm256_storeu_si256((__m256i*)dst + 1, PackU32ToI16(_mm256_cvtps_epi32(f2), _mm256_cvtps_epi32(f3)));
+        }
+
+        SIMD_INLINE void StoreAs(float* dst, const __m256& f0, const __m256& f1, const __m256& f2, const __m256& f3)
+        {
+            _mm256_storeu_ps(dst + 0 * F, f0);
+            _mm256_storeu_ps(dst + 1 * F, f1);
+            _mm256_storeu_ps(dst + 2 * F, f2);
+            _mm256_storeu_ps(dst + 3 * F, f3);
+        }
+
+        template<class T> SIMD_INLINE void BlurRowsAny(const float* src, size_t size, size_t stride, const float* weight, size_t kernel, T* dst)
         {
             size_t sizeA = AlignLo(size, A);
             size_t sizeF = AlignLo(size, F);
@@ -93,65 +127,40 @@ namespace Simd
                     sum2 = _mm256_fmadd_ps(w, _mm256_loadu_ps(ps + 2 * F), sum2);
                     sum3 = _mm256_fmadd_ps(w, _mm256_loadu_ps(ps + 3 * F), sum3);
                 }
-                StoreAs8u(dst + i, sum0, sum1, sum2, sum3);
+                StoreAs(dst + i, sum0, sum1, sum2, sum3);
             }
             for (; i < sizeF; i += F)
             {
                 __m256 sum = _mm256_setzero_ps();
                 for (size_t k = 0; k < kernel; ++k)
                     sum = _mm256_fmadd_ps(_mm256_set1_ps(weight[k]), _mm256_loadu_ps(src + i + k * stride), sum);
-                StoreAs8u(dst + i, sum);
+                StoreAs(dst + i, sum);
             }
             for (; i < size; ++i)
             {
                 float sum = 0;
                 for (size_t k = 0; k < kernel; ++k)
                     sum += weight[k] * src[i + k * stride];
-                dst[i] = Round(sum);
+                dst[i] = Base::BlurCast<T>(sum);
             }
         }
 
-        template<int channels> void BlurImageAny(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<class T> struct BlurAny
         {
-            Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
-            {
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + (a.half + row) * a.stride);
-            }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRowsAny(rows, a.size, a.stride, a.weight.data, a.kernel, dst), dst += dstStride;
-
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < a.body; ++row, ++b, --w)
+            static SIMD_INLINE void Cols(const Base::AlgDefault& a, const T* src, size_t channels, float* dst)
             {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + b * a.stride);
-                BlurRowsAny(rows, a.size, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
+                BlurColsAny(src, a.size, channels, a.weight.data, a.kernel, dst);
             }
 
-            size_t last = (a.body + 2 * a.half - 1) % a.kernel;
-            for (size_t row = a.body, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < p.height; ++row, ++b, --w)
+            static SIMD_INLINE void Rows(const Base::AlgDefault& a, const float* src, const float* weight, T* dst)
             {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRowsAny(rows, a.size, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
+                BlurRowsAny(src, a.size, a.stride, weight, a.kernel, dst);
             }
-        }
+        };
 
         //---------------------------------------------------------------------
 
-        template<int kernel> SIMD_INLINE void BlurCols(const uint8_t* src, size_t size, size_t channels, const float* weight, float* dst)
+        template<int kernel, class T> SIMD_INLINE void BlurCols(const T* src, size_t size, size_t channels, const float* weight, float* dst)
         {
             __m256 w[kernel];
             for (size_t k = 0; k < kernel; ++k)
@@ -174,7 +183,7 @@ namespace Simd
             }
         }
 
-        template<> SIMD_INLINE void BlurCols<3>(const uint8_t* src, size_t size, size_t channels, const float* weight, float* dst)
+        template<> SIMD_INLINE void BlurCols<3, uint8_t>(const uint8_t* src, size_t size, size_t channels, const float* weight, float* dst)
         {
             __m256 w0 = _mm256_set1_ps(weight[0]);
             __m256 w1 = _mm256_set1_ps(weight[1]);
@@ -197,7 +206,7 @@ namespace Simd
             }
         }
 
-        template<> SIMD_INLINE void BlurCols<5>(const uint8_t* src, size_t size, size_t channels, const float* weight, float* dst)
+        template<> SIMD_INLINE void BlurCols<5, uint8_t>(const uint8_t* src, size_t size, size_t channels, const float* weight, float* dst)
         {
             __m256 w0 = _mm256_set1_ps(weight[0]);
             __m256 w1 = _mm256_set1_ps(weight[1]);
@@ -226,7 +235,7 @@ namespace Simd
             }
         }
 
-        template<int kernel> SIMD_INLINE void BlurRows(const float* src, size_t size, size_t stride, const float* weight, uint8_t* dst)
+        template<int kernel, class T> SIMD_INLINE void BlurRows(const float* src, size_t size, size_t stride, const float* weight, T* dst)
         {
             __m256 w[kernel];
             for (size_t k = 0; k < kernel; ++k)
@@ -248,73 +257,60 @@ namespace Simd
                     sum2 = _mm256_fmadd_ps(w[k], _mm256_loadu_ps(ps + 2 * F), sum2);
                     sum3 = _mm256_fmadd_ps(w[k], _mm256_loadu_ps(ps + 3 * F), sum3);
                 }
-                StoreAs8u(dst + i, sum0, sum1, sum2, sum3);
+                StoreAs(dst + i, sum0, sum1, sum2, sum3);
             }
             for (; i < sizeF; i += F)
             {
                 __m256 sum = _mm256_setzero_ps();
                 for (size_t k = 0; k < kernel; ++k)
                     sum = _mm256_fmadd_ps(w[k], _mm256_loadu_ps(src + i + k * stride), sum);
-                StoreAs8u(dst + i, sum);
+                StoreAs(dst + i, sum);
             }
             for (; i < size; ++i)
             {
                 float sum = 0;
                 for (size_t k = 0; k < kernel; ++k)
                     sum += weight[k] * src[i + k * stride];
-                dst[i] = Round(sum);
+                dst[i] = Base::BlurCast<T>(sum);
             }
         }
 
-        template<int channels, int kernel> void BlurImage(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<class T, int kernel> struct BlurKernel
         {
-            Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
+            static SIMD_INLINE void Cols(const Base::AlgDefault& a, const T* src, size_t channels, float* dst)
             {
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + (a.half + row) * a.stride);
+                BlurCols<kernel>(src, a.size, channels, a.weight.data, dst);
             }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRows<kernel>(rows, a.size, a.stride, a.weight.data, dst), dst += dstStride;
 
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = kernel - row % kernel; row < a.body; ++row, ++b, --w)
+            static SIMD_INLINE void Rows(const Base::AlgDefault& a, const float* src, const float* weight, T* dst)
             {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + b * a.stride);
-                BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + w, dst), dst += dstStride;
+                BlurRows<kernel>(src, a.size, a.stride, weight, dst);
             }
+        };
 
-            size_t last = (a.body + 2 * a.half - 1) % kernel;
-            for (size_t row = a.body, b = row % kernel + 2 * a.half, w = kernel - row % kernel; row < p.height; ++row, ++b, --w)
+        //---------------------------------------------------------------------
+
+        template<class T, int channels> Base::BlurDefaultPtr GetBlurDefaultPtr(const BlurParam& p, const Base::AlgDefault& a)
+        {
+            switch (a.kernel)
             {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + w, dst), dst += dstStride;
+            case 3: return Base::BlurImage<T, channels, BlurKernel<T, 3>>;
+            case 5: return Base::BlurImage<T, channels, BlurKernel<T, 5>>;
+            case 7: return Base::BlurImage<T, channels, BlurKernel<T, 7>>;
+            case 9: return Base::BlurImage<T, channels, BlurKernel<T, 9>>;
+            default: return Base::BlurImage<T, channels, BlurAny<T>>;
             }
         }
 
-        //---------------------------------------------------------------------
-
-        template<int channels> Base::BlurDefaultPtr GetBlurDefaultPtr(const BlurParam& p, const Base::AlgDefault& a)
+        template<class T> Base::BlurDefaultPtr GetBlurDefaultPtr(const BlurParam& p, const Base::AlgDefault& a)
         {
-            switch (a.kernel)
+            switch (p.channels)
             {
-            case 3: return BlurImage<channels, 3>;
-            case 5: return BlurImage<channels, 5>;
-            case 7: return BlurImage<channels, 7>;
-            case 9: return BlurImage<channels, 9>;
-            default: return BlurImageAny<channels>;
+            case 1: return GetBlurDefaultPtr<T, 1>(p, a);
+            case 2: return GetBlurDefaultPtr<T, 2>(p, a);
+            case 3: return GetBlurDefaultPtr<T, 3>(p, a);
+            case 4: return GetBlurDefaultPtr<T, 4>(p, a);
+            default: return NULL;
             }
         }
 
@@ -325,23 +321,82 @@ namespace Simd
         {
             if (_param.width >= F)
             {
-                switch (_param.channels)
+                switch (_param.Channel())
+                {
+                case SimdGaussianBlurChannelByte: _blur = GetBlurDefaultPtr<uint8_t>(_param, _alg); break;
+                case SimdGaussianBlurChannelShort: _blur = GetBlurDefaultPtr<uint16_t>(_param, _alg); break;
+                case SimdGaussianBlurChannelFloat: _blur = GetBlurDefaultPtr<float>(_param, _alg); break;
+                default: break;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<class T> void RecursiveRows(const BlurParam& p, const Base::AlgRecursive& a, size_t xBeg, size_t xEnd, float* buf, uint8_t* dst, size_t dstStride)
+        {
+            __m256 k0 = _mm256_set1_ps(a.b), k1 = _mm256_set1_ps(a.a1), k2 = _mm256_set1_ps(a.a2), k3 = _mm256_set1_ps(a.a3);
+            size_t xEndF = xBeg + AlignLo(xEnd - xBeg, F);
+            for (size_t y = 0; y < p.height; ++y)
+            {
+                const float* p1 = buf + (y > 0 ? y - 1 : 0) * a.stride;
+                const float* p2 = buf + (y > 1 ? y - 2 : 0) * a.stride;
+                const float* p3 = buf + (y > 2 ? y - 3 : 0) * a.stride;
+                float* pb = buf + y * a.stride;
+                size_t x = xBeg;
+                for (; x < xEndF; x += F)
+                {
+                    __m256 y0 = _mm256_fmadd_ps(k0, _mm256_loadu_ps(pb + x), _mm256_mul_ps(k1, _mm256_loadu_ps(p1 + x)));
+                    y0 = _mm256_fmadd_ps(k3, _mm256_loadu_ps(p3 + x), _mm256_fmadd_ps(k2, _mm256_loadu_ps(p2 + x), y0));
+                    _mm256_storeu_ps(pb + x, y0);
+                }
+                for (; x < xEnd; ++x)
+                    pb[x] = a.b * pb[x] + a.a1 * p1[x] + a.a2 * p2[x] + a.a3 * p3[x];
+            }
+            for (ptrdiff_t y = p.height - 1, last = y; y >= 0; --y)
+            {
+                const float* n1 = buf + Simd::Min(y + 1, last) * a.stride;
+                const float* n2 = buf + Simd::Min(y + 2, last) * a.stride;
+                const float* n3 = buf + Simd::Min(y + 3, last) * a.stride;
+                float* pb = buf + y * a.stride;
+                T* pd = (T*)(dst + y * dstStride);
+                size_t x = xBeg;
+                for (; x < xEndF; x += F)
+                {
+                    __m256 y0 = _mm256_fmadd_ps(k0, _mm256_loadu_ps(pb + x), _mm256_mul_ps(k1, _mm256_loadu_ps(n1 + x)));
+                    y0 = _mm256_fmadd_ps(k3, _mm256_loadu_ps(n3 + x), _mm256_fmadd_ps(k2, _mm256_loadu_ps(n2 + x), y0));
+                    _mm256_storeu_ps(pb + x, y0);
+                    StoreAs(pd + x, y0);
+                }
+                for (; x < xEnd; ++x)
                 {
-                case 1: _blur = GetBlurDefaultPtr<1>(_param, _alg); break;
-                case 2: _blur = GetBlurDefaultPtr<2>(_param, _alg); break;
-                case 3: _blur = GetBlurDefaultPtr<3>(_param, _alg); break;
-                case 4: _blur = GetBlurDefaultPtr<4>(_param, _alg); break;
+                    pb[x] = a.b * pb[x] + a.a1 * n1[x] + a.a2 * n2[x] + a.a3 * n3[x];
+                    pd[x] = Base::BlurCast<T>(pb[x]);
                 }
             }
         }
 
+        GaussianBlurRecursive::GaussianBlurRecursive(const BlurParam& param)
+            : Sse41::GaussianBlurRecursive(param)
+        {
+            switch (_param.Channel())
+            {
+            case SimdGaussianBlurChannelByte: _blurRows = RecursiveRows<uint8_t>; break;
+            case SimdGaussianBlurChannelShort: _blurRows = RecursiveRows<uint16_t>; break;
+            case SimdGaussianBlurChannelFloat: _blurRows = RecursiveRows<float>; break;
+            default: break;
+            }
+        }
+
         //---------------------------------------------------------------------
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags)
         {
-            BlurParam param(width, height, channels, sigma, epsilon, A);
+            BlurParam param(width, height, channels, sigma, epsilon, flags, A);
             if (!param.Valid())
                 return NULL;
+            if (param.IsRecursive())
+                return new GaussianBlurRecursive(param);
             return new GaussianBlurDefault(param);
         }
 
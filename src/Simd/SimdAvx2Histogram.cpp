@@ -25,6 +25,11 @@
 #include "Simd/SimdStore.h"
 #include "Simd/SimdCompare.h"
 #include "Simd/SimdUnpack.h"
+#include "Simd/SimdHistogram.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse41.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -276,6 +281,73 @@ namespace Simd
                 assert(0);
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m256 AdaptiveHistogramInterp(const float* lut, __m256i i0, __m256i i1, __m256 wx)
+        {
+            __m256 v0 = _mm256_i32gather_ps(lut, i0, 4);
+            __m256 v1 = _mm256_i32gather_ps(lut, i1, 4);
+            return _mm256_fmadd_ps(_mm256_sub_ps(v1, v0), wx, v0);
+        }
+
+        SIMD_INLINE __m256i AdaptiveHistogram8(const float* lut0, const float* lut1, const int32_t* i0, const int32_t* i1, const float* weight, const uint8_t* src, __m256 wy)
+        {
+            __m256i value = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)src));
+            __m256i _i0 = _mm256_add_epi32(_mm256_loadu_si256((__m256i*)i0), value);
+            __m256i _i1 = _mm256_add_epi32(_mm256_loadu_si256((__m256i*)i1), value);
+            __m256 wx = _mm256_loadu_ps(weight);
+            __m256 r0 = AdaptiveHistogramInterp(lut0, _i0, _i1, wx);
+            __m256 r1 = AdaptiveHistogramInterp(lut1, _i0, _i1, wx);
+            __m256 res = _mm256_fmadd_ps(_mm256_sub_ps(r1, r0), wy, r0);
+            return _mm256_cvttps_epi32(_mm256_add_ps(res, _mm256_set1_ps(0.5f)));
+        }
+
+        SIMD_INLINE void AdaptiveHistogram32(const float* lut0, const float* lut1, const int32_t* i0, const int32_t* i1, const float* weight, const uint8_t* src, __m256 wy, uint8_t* dst)
+        {
+            __m256i d0 = AdaptiveHistogram8(lut0, lut1, i0 + 0 * F, i1 + 0 * F, weight + 0 * F, src + 0 * F, wy);
+            __m256i d1 = AdaptiveHistogram8(lut0, lut1, i0 + 1 * F, i1 + 1 * F, weight + 1 * F, src + 1 * F, wy);
+            __m256i d2 = AdaptiveHistogram8(lut0, lut1, i0 + 2 * F, i1 + 2 * F, weight + 2 * F, src + 2 * F, wy);
+            __m256i d3 = AdaptiveHistogram8(lut0, lut1, i0 + 3 * F, i1 + 3 * F, weight + 3 * F, src + 3 * F, wy);
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(PackI32ToI16(d0, d1), PackI32ToI16(d2, d3)));
+        }
+
+        void NormalizeHistogramAdaptive(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t tilesX, size_t tilesY, float clipLimit, uint8_t* dst, size_t dstStride)
+        {
+            assert(tilesX >= 1 && tilesY >= 1 && tilesX <= width && tilesY <= height);
+            if (width < A)
+            {
+                Sse41::NormalizeHistogramAdaptive(src, srcStride, width, height, tilesX, tilesY, clipLimit, dst, dstStride);
+                return;
+            }
+            Array32f luts(tilesX * tilesY * HISTOGRAM_SIZE), weights(width);
+            Array32i indices(2 * width);
+            Base::AdaptiveHistogramLuts(src, srcStride, width, height, tilesX, tilesY, clipLimit, luts.data);
+            Base::AdaptiveHistogramCols(width, tilesX, indices.data, indices.data + width, weights.data);
+            size_t widthA = AlignLo(width, A);
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                const int32_t* i0 = indices.data, * i1 = indices.data + width;
+                for (size_t y = begin; y < end; ++y)
+                {
+                    size_t offset0, offset1;
+                    float wy;
+                    Base::AdaptiveHistogramRow(y, height, tilesY, tilesX, offset0, offset1, wy);
+                    const float* lut0 = luts.data + offset0, * lut1 = luts.data + offset1;
+                    const uint8_t* ps = src + y * srcStride;
+                    uint8_t* pd = dst + y * dstStride;
+                    __m256 _wy = _mm256_set1_ps(wy);
+                    uint8_t tail[A];
+                    if (widthA < width)
+                        memcpy(tail, ps + width - A, A);
+                    for (size_t x = 0; x < widthA; x += A)
+                        AdaptiveHistogram32(lut0, lut1, i0 + x, i1 + x, weights.data + x, ps + x, _wy, pd + x);
+                    if (widthA < width)
+                        AdaptiveHistogram32(lut0, lut1, i0 + width - A, i1 + width - A, weights.data + width - A, tail, _wy, pd + width - A);
+                }
+            }, Base::GetThreadNumber());
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
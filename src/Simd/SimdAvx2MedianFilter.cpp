@@ -25,6 +25,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdLoadBlock.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -648,6 +649,46 @@ namespace Simd
             else
                 MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        struct MedianHist
+        {
+            static SIMD_INLINE void Add(uint16_t* dst, const uint16_t* src)
+            {
+                _mm256_storeu_si256((__m256i*)dst, _mm256_add_epi16(_mm256_loadu_si256((__m256i*)dst), _mm256_loadu_si256((__m256i*)src)));
+            }
+
+            static SIMD_INLINE void Update(uint16_t* dst, const uint16_t* add, const uint16_t* sub)
+            {
+                _mm256_storeu_si256((__m256i*)dst, _mm256_sub_epi16(_mm256_add_epi16(_mm256_loadu_si256((__m256i*)dst),
+                    _mm256_loadu_si256((__m256i*)add)), _mm256_loadu_si256((__m256i*)sub)));
+            }
+
+            static SIMD_INLINE size_t Find(const uint16_t* hist, size_t& sum, size_t half)
+            {
+                SIMD_ALIGNED(32) uint16_t buf[16];
+                __m256i prefix = _mm256_loadu_si256((__m256i*)hist);
+                prefix = _mm256_add_epi16(prefix, _mm256_slli_si256(prefix, 2));
+                prefix = _mm256_add_epi16(prefix, _mm256_slli_si256(prefix, 4));
+                prefix = _mm256_add_epi16(prefix, _mm256_slli_si256(prefix, 8));
+                __m256i last = _mm256_shufflehi_epi16(prefix, 0xFF);
+                prefix = _mm256_add_epi16(prefix, _mm256_permute2x128_si256(_mm256_unpackhi_epi64(last, last), last, 0x08));
+                _mm256_store_si256((__m256i*)buf, prefix);
+                __m256i threshold = _mm256_set1_epi16(int16_t(half - sum + 1));
+                uint32_t above = _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_max_epu16(prefix, threshold), prefix));
+                size_t index = Simd::Min<size_t>(_tzcnt_u32(above) >> 1, 15);
+                if (index)
+                    sum += buf[index - 1];
+                return index;
+            }
+        };
+
+        void MedianFilterSquare(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t* dst, size_t dstStride)
+        {
+            Base::MedianFilterSquare<MedianHist>(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
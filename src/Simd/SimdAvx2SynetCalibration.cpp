@@ -0,0 +1,157 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetCalibration.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx2
+    {
+        void SynetCalibrationMinMax(const float* src, size_t channels, size_t spatial, SimdTensorFormatType format, float* min, float* max)
+        {
+            if (format == SimdTensorFormatNchw)
+            {
+                size_t spatialF = AlignLo(spatial, F);
+                for (size_t c = 0; c < channels; ++c, src += spatial)
+                {
+                    __m256 _min = _mm256_set1_ps(min[c]), _max = _mm256_set1_ps(max[c]);
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                    {
+                        __m256 _src = _mm256_loadu_ps(src + s);
+                        _min = _mm256_min_ps(_min, _src);
+                        _max = _mm256_max_ps(_max, _src);
+                    }
+                    __m128 min128 = _mm_min_ps(_mm256_castps256_ps128(_min), _mm256_extractf128_ps(_min, 1));
+                    __m128 max128 = _mm_max_ps(_mm256_castps256_ps128(_max), _mm256_extractf128_ps(_max, 1));
+                    for (; s < spatial; ++s)
+                    {
+                        __m128 _src = _mm_load_ss(src + s);
+                        min128 = _mm_min_ss(min128, _src);
+                        max128 = _mm_max_ss(max128, _src);
+                    }
+                    min128 = _mm_min_ps(min128, _mm_shuffle_ps(min128, min128, 0x4E));
+                    max128 = _mm_max_ps(max128, _mm_shuffle_ps(max128, max128, 0x4E));
+                    min128 = _mm_min_ss(min128, _mm_shuffle_ps(min128, min128, 0xB1));
+                    max128 = _mm_max_ss(max128, _mm_shuffle_ps(max128, max128, 0xB1));
+                    min[c] = _mm_cvtss_f32(min128);
+                    max[c] = _mm_cvtss_f32(max128);
+                }
+            }
+            else
+            {
+                size_t channelsF = AlignLo(channels, F);
+                for (size_t s = 0; s < spatial; ++s, src += channels)
+                {
+                    size_t c = 0;
+                    for (; c < channelsF; c += F)
+                    {
+                        __m256 _src = _mm256_loadu_ps(src + c);
+                        _mm256_storeu_ps(min + c, _mm256_min_ps(_mm256_loadu_ps(min + c), _src));
+                        _mm256_storeu_ps(max + c, _mm256_max_ps(_mm256_loadu_ps(max + c), _src));
+                    }
+                    for (; c < channels; ++c)
+                    {
+                        min[c] = Simd::Min(min[c], src[c]);
+                        max[c] = Simd::Max(max[c], src[c]);
+                    }
+                }
+            }
+        }
+
+        SIMD_INLINE __m256i BinIndex(const float* src, __m256 norm, __m256 shift, __m256 top)
+        {
+            __m256 val = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(src), shift), norm);
+            return _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(val, _mm256_setzero_ps()), top));
+        }
+
+        SIMD_INLINE void Increment(const uint32_t* idx, uint32_t* hist)
+        {
+            hist[idx[0]]++;
+            hist[idx[1]]++;
+            hist[idx[2]]++;
+            hist[idx[3]]++;
+            hist[idx[4]]++;
+            hist[idx[5]]++;
+            hist[idx[6]]++;
+            hist[idx[7]]++;
+        }
+
+        void SynetCalibrationHistogram(const float* src, size_t size, float norm, float shift, size_t bins, uint32_t* hist)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m256 _norm = _mm256_set1_ps(norm), _shift = _mm256_set1_ps(shift), _top = _mm256_set1_ps(float(bins - 1));
+            SIMD_ALIGNED(32) uint32_t idx[F];
+            for (; i < sizeF; i += F)
+            {
+                _mm256_store_si256((__m256i*)idx, BinIndex(src + i, _norm, _shift, _top));
+                Increment(idx, hist);
+            }
+            if (i < size)
+                Base::SynetCalibrationHistogram(src + i, size - i, norm, shift, bins, hist);
+        }
+
+        void SynetCalibrationHistogramNhwc(const float* src, size_t spatial, size_t channels, const float* norm, const float* shift, size_t bins, uint32_t* hist)
+        {
+            size_t channelsF = AlignLo(channels, F);
+            __m256 _top = _mm256_set1_ps(float(bins - 1));
+            __m256i _offset = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(int(bins)));
+            SIMD_ALIGNED(32) uint32_t idx[F];
+            for (size_t s = 0; s < spatial; ++s, src += channels)
+            {
+                size_t c = 0;
+                for (; c < channelsF; c += F)
+                {
+                    __m256i offset = _mm256_add_epi32(_offset, _mm256_set1_epi32(int(c * bins)));
+                    _mm256_store_si256((__m256i*)idx, _mm256_add_epi32(BinIndex(src + c, _mm256_loadu_ps(norm + c), _mm256_loadu_ps(shift + c), _top), offset));
+                    Increment(idx, hist);
+                }
+                for (; c < channels; ++c)
+                    Base::SynetCalibrationHistogram(src + c, 1, norm[c], shift[c], bins, hist + c * bins);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetCalibration::SynetCalibration(const SynetCalibrationParam& p)
+            : Sse41::SynetCalibration(p)
+        {
+            _minMax = SynetCalibrationMinMax;
+            _histogram = SynetCalibrationHistogram;
+            _histogramNhwc = SynetCalibrationHistogramNhwc;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetCalibrationInit(size_t channels, SimdTensorFormatType format, size_t bins, SimdBool perChannel)
+        {
+            SynetCalibrationParam param(channels, format, bins, perChannel);
+            if (!param.Valid())
+                return NULL;
+            return new SynetCalibration(param);
+        }
+    }
+#endif
+}
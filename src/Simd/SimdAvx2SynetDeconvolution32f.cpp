@@ -235,11 +235,21 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        SynetDeconvolution32fNhwcSubPixel::SynetDeconvolution32fNhwcSubPixel(const DeconvParam & p)
+            : Sse41::SynetDeconvolution32fNhwcSubPixel(p)
+        {
+            SetConvolutions(Avx2::SynetConvolution32fInit);
+        }
+
+        //---------------------------------------------------------------------
+
         void * SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility)
         {
             DeconvParam param(batch, conv, compatibility);
             if (!param.Valid(SimdTensorData32f))
                 return NULL;
+            if (SynetDeconvolution32fNhwcSubPixel::Preferable(param))
+                return new SynetDeconvolution32fNhwcSubPixel(param);
             if (SynetDeconvolution32fNhwcDirect2x2::Preferable(param))
                 return new SynetDeconvolution32fNhwcDirect2x2(param);
             else
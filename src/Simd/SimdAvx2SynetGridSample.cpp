@@ -37,7 +37,7 @@ namespace Simd
             if(param.Is32fBlZ())
                 return new Avx2::SynetGridSample2d32fBlZ(param);
             else
-                return new Base::SynetGridSample2dRef(param);
+                return new Avx2::SynetGridSample2dGather(param);
         }
     }
 #endif
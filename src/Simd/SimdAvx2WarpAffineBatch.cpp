@@ -0,0 +1,67 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdWarpAffine.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        static void Convert8uTo32f(const uint8_t* src, size_t size, const float* scale, const float* shift, float* dst)
+        {
+            size_t size8 = AlignLo(size, 8), i = 0;
+            for (; i < size8; i += 8)
+            {
+                __m256 _src = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src + i))));
+                _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(_src, _mm256_loadu_ps(scale + i), _mm256_loadu_ps(shift + i)));
+            }
+            for (; i < size; ++i)
+                dst[i] = float(src[i]) * scale[i] + shift[i];
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        WarpAffineBatch::WarpAffineBatch(const WarpAffParam& param, SimdTensorDataType type, const float* mean, const float* std)
+            : Sse41::WarpAffineBatch(param, type, mean, std)
+        {
+            _convert8uTo32f = Convert8uTo32f;
+            _float32ToBFloat16 = Avx2::Float32ToBFloat16;
+            SetWarps(Avx2::WarpAffineInit);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels,
+            SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* mean, const float* std)
+        {
+            const float mat[6] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstW * channels, channels, mat, flags, border, 1);
+            if (!WarpAffineBatch::Valid(param, type))
+                return NULL;
+            return new WarpAffineBatch(param, type, mean, std);
+        }
+    }
+#endif
+}
@@ -190,6 +190,16 @@ namespace Simd
         void DetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
             ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
+        void DetectionDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t size, SimdBool clip, float* dst);
+
+        size_t DetectionDecodeYolo32f(const float* src, size_t height, size_t width, size_t anchors, size_t classes, const float* anchorSizes,
+            float threshold, float* boxes, float* scores, uint32_t* labels, size_t capacity);
+
+        size_t DetectionFilterScores32f(const float* scores, size_t size, float threshold, uint32_t* indices);
+
+        size_t DetectionNms32f(const float* boxes, const float* scores, const uint32_t* labels, size_t size, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* keepScores);
+
         void Fill32f(float* dst, size_t size, const float* value);
 
         void FillBgr(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red);
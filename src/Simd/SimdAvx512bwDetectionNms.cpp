@@ -0,0 +1,157 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDetectionNms.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE void DecodeSsd4(const float* loc, const float* prior, const float* variance, bool clip, float* dst, __mmask16 tail = -1)
+        {
+            __m512 p = _mm512_maskz_loadu_ps(tail, prior);
+            __m512 d = _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, loc), _mm512_maskz_loadu_ps(tail, variance));
+            __m512 p0 = _mm512_shuffle_ps(p, p, 0x44);
+            __m512 p1 = _mm512_shuffle_ps(p, p, 0xEE);
+            __m512 pwh = _mm512_sub_ps(p1, p0);
+            __m512 c = _mm512_add_ps(_mm512_mul_ps(_mm512_add_ps(p0, p1), _mm512_set1_ps(0.5f)), _mm512_mul_ps(_mm512_shuffle_ps(d, d, 0x44), pwh));
+            __m512 sign = _mm512_mask_blend_ps(0xCCCC, _mm512_set1_ps(-0.5f), _mm512_set1_ps(0.5f));
+            __m512 s = _mm512_mul_ps(_mm512_mul_ps(Exponent(_mm512_shuffle_ps(d, d, 0xEE)), pwh), sign);
+            __m512 r = _mm512_add_ps(c, s);
+            if (clip)
+                r = _mm512_min_ps(_mm512_max_ps(r, _mm512_setzero_ps()), _mm512_set1_ps(1.0f));
+            _mm512_mask_storeu_ps(dst, tail, r);
+        }
+
+        void DetectionDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t size, SimdBool clip, float* dst)
+        {
+            size_t size4 = AlignLo(size, 4), i = 0;
+            for (; i < size4; i += 4, loc += F, prior += F, variance += F, dst += F)
+                DecodeSsd4(loc, prior, variance, clip == SimdTrue, dst);
+            if (i < size)
+                DecodeSsd4(loc, prior, variance, clip == SimdTrue, dst, TailMask16((size - i) * 4));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static size_t ArgMax(const float* src, size_t size)
+        {
+            if (size < 4)
+                return Base::ArgMax(src, size);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __mmask16 tail = TailMask16(size - sizeF);
+            __m512 max = _mm512_set1_ps(-FLT_MAX);
+            for (i = 0; i < sizeF; i += F)
+                max = _mm512_max_ps(max, _mm512_loadu_ps(src + i));
+            if (tail)
+                max = _mm512_max_ps(max, _mm512_mask_loadu_ps(max, tail, src + i));
+            max = _mm512_set1_ps(_mm512_reduce_max_ps(max));
+            for (i = 0; i < sizeF; i += F)
+            {
+                __mmask16 mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(src + i), max, _CMP_EQ_OQ);
+                if (mask)
+                    return i + _tzcnt_u32(mask);
+            }
+            __mmask16 mask = _mm512_mask_cmp_ps_mask(tail, _mm512_maskz_loadu_ps(tail, src + i), max, _CMP_EQ_OQ);
+            return mask ? i + _tzcnt_u32(mask) : 0;
+        }
+
+        size_t DetectionDecodeYolo32f(const float* src, size_t height, size_t width, size_t anchors, size_t classes, const float* anchorSizes,
+            float threshold, float* boxes, float* scores, uint32_t* labels, size_t capacity)
+        {
+            return Base::DetectionDecodeYolo32f(src, height, width, anchors, classes, anchorSizes, threshold, boxes, scores, labels, capacity, ArgMax);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t DetectionFilterScores32f(const float* scores, size_t size, float threshold, uint32_t* indices)
+        {
+            size_t sizeF = AlignLo(size, F), count = 0, i = 0;
+            __m512 _threshold = _mm512_set1_ps(threshold);
+            __m512i index = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            for (; i < sizeF; i += F)
+            {
+                __mmask16 mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(scores + i), _threshold, _CMP_GT_OQ);
+                _mm512_mask_compressstoreu_epi32(indices + count, mask, _mm512_add_epi32(index, _mm512_set1_epi32(int(i))));
+                count += _mm_popcnt_u32(mask);
+            }
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __mmask16 mask = _mm512_mask_cmp_ps_mask(tail, _mm512_maskz_loadu_ps(tail, scores + i), _threshold, _CMP_GT_OQ);
+                _mm512_mask_compressstoreu_epi32(indices + count, mask, _mm512_add_epi32(index, _mm512_set1_epi32(int(i))));
+                count += _mm_popcnt_u32(mask);
+            }
+            return count;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void DetectionSuppress(const Base::NmsBuffer& buf, size_t j, __m512 x0, __m512 y0, __m512 x1, __m512 y1, __m512 area, __m512 label,
+            __m512 iouThreshold, __m512 sigma, bool soft, bool labeled, __mmask16 tail = -1)
+        {
+            __m512 w = _mm512_max_ps(_mm512_sub_ps(_mm512_min_ps(x1, _mm512_maskz_loadu_ps(tail, buf.x1 + j)), _mm512_max_ps(x0, _mm512_maskz_loadu_ps(tail, buf.x0 + j))), _mm512_setzero_ps());
+            __m512 h = _mm512_max_ps(_mm512_sub_ps(_mm512_min_ps(y1, _mm512_maskz_loadu_ps(tail, buf.y1 + j)), _mm512_max_ps(y0, _mm512_maskz_loadu_ps(tail, buf.y0 + j))), _mm512_setzero_ps());
+            __m512 inter = _mm512_mul_ps(w, h);
+            __m512 uni = _mm512_sub_ps(_mm512_add_ps(area, _mm512_maskz_loadu_ps(tail, buf.area + j)), inter);
+            __mmask16 same = labeled ? _mm512_mask_cmp_ps_mask(tail, label, _mm512_maskz_loadu_ps(tail, buf.label + j), _CMP_EQ_OQ) : tail;
+            __m512 score = _mm512_maskz_loadu_ps(tail, buf.score + j);
+            if (soft)
+            {
+                __m512 iou = _mm512_maskz_div_ps(_mm512_cmp_ps_mask(uni, _mm512_setzero_ps(), _CMP_GT_OQ), inter, uni);
+                __m512 decay = Exponent(_mm512_sub_ps(_mm512_setzero_ps(), _mm512_div_ps(_mm512_mul_ps(iou, iou), sigma)));
+                score = _mm512_mask_mul_ps(score, same, score, decay);
+            }
+            else
+            {
+                __mmask16 suppress = _mm512_mask_cmp_ps_mask(same, inter, _mm512_mul_ps(iouThreshold, uni), _CMP_GT_OQ);
+                score = _mm512_mask_mov_ps(score, suppress, _mm512_set1_ps(-FLT_MAX));
+            }
+            _mm512_mask_storeu_ps(buf.score + j, tail, score);
+        }
+
+        static void DetectionSuppress(const Base::NmsBuffer& buf, size_t curr, size_t begin, size_t end, float iouThreshold, float sigma, bool labeled)
+        {
+            __m512 x0 = _mm512_set1_ps(buf.x0[curr]), y0 = _mm512_set1_ps(buf.y0[curr]);
+            __m512 x1 = _mm512_set1_ps(buf.x1[curr]), y1 = _mm512_set1_ps(buf.y1[curr]);
+            __m512 area = _mm512_set1_ps(buf.area[curr]), label = _mm512_set1_ps(buf.label[curr]);
+            __m512 _iouThreshold = _mm512_set1_ps(iouThreshold), _sigma = _mm512_set1_ps(sigma);
+            bool soft = sigma > 0.0f;
+            size_t j = begin, endF = begin + AlignLo(end - begin, F);
+            for (; j < endF; j += F)
+                DetectionSuppress(buf, j, x0, y0, x1, y1, area, label, _iouThreshold, _sigma, soft, labeled);
+            if (j < end)
+                DetectionSuppress(buf, j, x0, y0, x1, y1, area, label, _iouThreshold, _sigma, soft, labeled, TailMask16(end - j));
+        }
+
+        size_t DetectionNms32f(const float* boxes, const float* scores, const uint32_t* labels, size_t size, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* keepScores)
+        {
+            return Base::DetectionNms32f(boxes, scores, labels, size, iouThreshold, sigma, scoreThreshold, indices, keepScores, DetectionFilterScores32f, DetectionSuppress);
+        }
+    }
+#endif
+}
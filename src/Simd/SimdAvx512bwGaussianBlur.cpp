@@ -115,44 +115,18 @@ namespace Simd
             }
         }
 
-        template<int channels> void BlurImageAny(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        struct BlurAny
         {
-            __mmask16 tail = TailMask16(a.size - AlignLo(a.size, F));
-            Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurColsAny(cols, a.size, tail, p.channels, a.weight.data, a.kernel, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
+            static SIMD_INLINE void Cols(const Base::AlgDefault& a, const uint8_t* src, size_t channels, float* dst)
             {
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, tail, p.channels, a.weight.data, a.kernel, rows + (a.half + row) * a.stride);
+                BlurColsAny(src, a.size, TailMask16(a.size - AlignLo(a.size, F)), channels, a.weight.data, a.kernel, dst);
             }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRowsAny(rows, a.size, tail, a.stride, a.weight.data, a.kernel, dst), dst += dstStride;
 
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < a.body; ++row, ++b, --w)
+            static SIMD_INLINE void Rows(const Base::AlgDefault& a, const float* src, const float* weight, uint8_t* dst)
             {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, tail, p.channels, a.weight.data, a.kernel, rows + b * a.stride);
-                BlurRowsAny(rows, a.size, tail, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
+                BlurRowsAny(src, a.size, TailMask16(a.size - AlignLo(a.size, F)), a.stride, weight, a.kernel, dst);
             }
-
-            size_t last = (a.body + 2 * a.half - 1) % a.kernel;
-            for (size_t row = a.body, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < p.height; ++row, ++b, --w)
-            {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRowsAny(rows, a.size, tail, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
-            }
-        }
+        };
 
         //---------------------------------------------------------------------
 
@@ -271,44 +245,18 @@ namespace Simd
             }
         }
 
-        template<int channels, int kernel> void BlurImage(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<int kernel> struct BlurKernel
         {
-            __mmask16 tail = TailMask16(a.size - AlignLo(a.size, F));
-            Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurCols<kernel>(cols, a.size, tail, p.channels, a.weight.data, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
-            {
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, tail, p.channels, a.weight.data, rows + (a.half + row) * a.stride);
-            }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRows<kernel>(rows, a.size, tail, a.stride, a.weight.data, dst), dst += dstStride;
-
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = kernel - row % kernel; row < a.body; ++row, ++b, --w)
+            static SIMD_INLINE void Cols(const Base::AlgDefault& a, const uint8_t* src, size_t channels, float* dst)
             {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, tail, p.channels, a.weight.data, rows + b * a.stride);
-                BlurRows<kernel>(rows, a.size, tail, a.stride, a.weight.data + w, dst), dst += dstStride;
+                BlurCols<kernel>(src, a.size, TailMask16(a.size - AlignLo(a.size, F)), channels, a.weight.data, dst);
             }
 
-            size_t last = (a.body + 2 * a.half - 1) % kernel;
-            for (size_t row = a.body, b = row % kernel + 2 * a.half, w = kernel - row % kernel; row < p.height; ++row, ++b, --w)
+            static SIMD_INLINE void Rows(const Base::AlgDefault& a, const float* src, const float* weight, uint8_t* dst)
             {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRows<kernel>(rows, a.size, tail, a.stride, a.weight.data + w, dst), dst += dstStride;
+                BlurRows<kernel>(src, a.size, TailMask16(a.size - AlignLo(a.size, F)), a.stride, weight, dst);
             }
-        }
+        };
 
         //---------------------------------------------------------------------
 
@@ -316,11 +264,11 @@ namespace Simd
         {
             switch (a.kernel)
             {
-            case 3: return BlurImage<channels, 3>;
-            case 5: return BlurImage<channels, 5>;
-            case 7: return BlurImage<channels, 7>;
-            case 9: return BlurImage<channels, 9>;
-            default: return BlurImageAny<channels>;
+            case 3: return Base::BlurImage<uint8_t, channels, BlurKernel<3>>;
+            case 5: return Base::BlurImage<uint8_t, channels, BlurKernel<5>>;
+            case 7: return Base::BlurImage<uint8_t, channels, BlurKernel<7>>;
+            case 9: return Base::BlurImage<uint8_t, channels, BlurKernel<9>>;
+            default: return Base::BlurImage<uint8_t, channels, BlurAny>;
             }
         }
 
@@ -329,22 +277,27 @@ namespace Simd
         GaussianBlurDefault::GaussianBlurDefault(const BlurParam& param)
             : Avx2::GaussianBlurDefault(param)
         {
-            switch (_param.channels)
+            if (_param.Channel() == SimdGaussianBlurChannelByte)
             {
-            case 1: _blur = GetBlurDefaultPtr<1>(_param, _alg); break;
-            case 2: _blur = GetBlurDefaultPtr<2>(_param, _alg); break;
-            case 3: _blur = GetBlurDefaultPtr<3>(_param, _alg); break;
-            case 4: _blur = GetBlurDefaultPtr<4>(_param, _alg); break;
+                switch (_param.channels)
+                {
+                case 1: _blur = GetBlurDefaultPtr<1>(_param, _alg); break;
+                case 2: _blur = GetBlurDefaultPtr<2>(_param, _alg); break;
+                case 3: _blur = GetBlurDefaultPtr<3>(_param, _alg); break;
+                case 4: _blur = GetBlurDefaultPtr<4>(_param, _alg); break;
+                }
             }
         }
 
         //---------------------------------------------------------------------
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags)
         {
-            BlurParam param(width, height, channels, sigma, epsilon, A);
+            BlurParam param(width, height, channels, sigma, epsilon, flags, A);
             if (!param.Valid())
                 return NULL;
+            if (param.IsRecursive())
+                return new Avx2::GaussianBlurRecursive(param);
             return new GaussianBlurDefault(param);
         }
 
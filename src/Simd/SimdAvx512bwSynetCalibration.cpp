@@ -0,0 +1,159 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetCalibration.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx512bw
+    {
+        void SynetCalibrationMinMax(const float* src, size_t channels, size_t spatial, SimdTensorFormatType format, float* min, float* max)
+        {
+            if (format == SimdTensorFormatNchw)
+            {
+                size_t spatialF = AlignLo(spatial, F);
+                __mmask16 tail = TailMask16(spatial - spatialF);
+                for (size_t c = 0; c < channels; ++c, src += spatial)
+                {
+                    __m512 _min = _mm512_set1_ps(min[c]), _max = _mm512_set1_ps(max[c]);
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                    {
+                        __m512 _src = _mm512_loadu_ps(src + s);
+                        _min = _mm512_min_ps(_min, _src);
+                        _max = _mm512_max_ps(_max, _src);
+                    }
+                    if (tail)
+                    {
+                        __m512 _src = _mm512_maskz_loadu_ps(tail, src + s);
+                        _min = _mm512_mask_min_ps(_min, tail, _min, _src);
+                        _max = _mm512_mask_max_ps(_max, tail, _max, _src);
+                    }
+                    min[c] = _mm512_reduce_min_ps(_min);
+                    max[c] = _mm512_reduce_max_ps(_max);
+                }
+            }
+            else
+            {
+                size_t channelsF = AlignLo(channels, F);
+                __mmask16 tail = TailMask16(channels - channelsF);
+                for (size_t s = 0; s < spatial; ++s, src += channels)
+                {
+                    size_t c = 0;
+                    for (; c < channelsF; c += F)
+                    {
+                        __m512 _src = _mm512_loadu_ps(src + c);
+                        _mm512_storeu_ps(min + c, _mm512_min_ps(_mm512_loadu_ps(min + c), _src));
+                        _mm512_storeu_ps(max + c, _mm512_max_ps(_mm512_loadu_ps(max + c), _src));
+                    }
+                    if (tail)
+                    {
+                        __m512 _src = _mm512_maskz_loadu_ps(tail, src + c);
+                        _mm512_mask_storeu_ps(min + c, tail, _mm512_min_ps(_mm512_maskz_loadu_ps(tail, min + c), _src));
+                        _mm512_mask_storeu_ps(max + c, tail, _mm512_max_ps(_mm512_maskz_loadu_ps(tail, max + c), _src));
+                    }
+                }
+            }
+        }
+
+        SIMD_INLINE __m512i BinIndex(__m512 src, __m512 norm, __m512 shift, __m512 top)
+        {
+            __m512 val = _mm512_mul_ps(_mm512_add_ps(src, shift), norm);
+            return _mm512_cvttps_epi32(_mm512_min_ps(_mm512_max_ps(val, _mm512_setzero_ps()), top));
+        }
+
+        SIMD_INLINE void Increment(const uint32_t* idx, uint32_t* hist, size_t size)
+        {
+            for (size_t i = 0; i < size; ++i)
+                hist[idx[i]]++;
+        }
+
+        void SynetCalibrationHistogram(const float* src, size_t size, float norm, float shift, size_t bins, uint32_t* hist)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m512 _norm = _mm512_set1_ps(norm), _shift = _mm512_set1_ps(shift), _top = _mm512_set1_ps(float(bins - 1));
+            SIMD_ALIGNED(64) uint32_t idx[F];
+            for (; i < sizeF; i += F)
+            {
+                _mm512_store_si512((__m512i*)idx, BinIndex(_mm512_loadu_ps(src + i), _norm, _shift, _top));
+                Increment(idx, hist, F);
+            }
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                _mm512_store_si512((__m512i*)idx, BinIndex(_mm512_maskz_loadu_ps(tail, src + i), _norm, _shift, _top));
+                Increment(idx, hist, size - i);
+            }
+        }
+
+        void SynetCalibrationHistogramNhwc(const float* src, size_t spatial, size_t channels, const float* norm, const float* shift, size_t bins, uint32_t* hist)
+        {
+            size_t channelsF = AlignLo(channels, F);
+            __mmask16 tail = TailMask16(channels - channelsF);
+            __m512 _top = _mm512_set1_ps(float(bins - 1));
+            __m512i _offset = _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(int(bins)));
+            SIMD_ALIGNED(64) uint32_t idx[F];
+            for (size_t s = 0; s < spatial; ++s, src += channels)
+            {
+                size_t c = 0;
+                for (; c < channelsF; c += F)
+                {
+                    __m512i offset = _mm512_add_epi32(_offset, _mm512_set1_epi32(int(c * bins)));
+                    __m512i index = BinIndex(_mm512_loadu_ps(src + c), _mm512_loadu_ps(norm + c), _mm512_loadu_ps(shift + c), _top);
+                    _mm512_store_si512((__m512i*)idx, _mm512_add_epi32(index, offset));
+                    Increment(idx, hist, F);
+                }
+                if (tail)
+                {
+                    __m512i offset = _mm512_add_epi32(_offset, _mm512_set1_epi32(int(c * bins)));
+                    __m512i index = BinIndex(_mm512_maskz_loadu_ps(tail, src + c), _mm512_maskz_loadu_ps(tail, norm + c), _mm512_maskz_loadu_ps(tail, shift + c), _top);
+                    _mm512_store_si512((__m512i*)idx, _mm512_add_epi32(index, offset));
+                    Increment(idx, hist, channels - c);
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetCalibration::SynetCalibration(const SynetCalibrationParam& p)
+            : Avx2::SynetCalibration(p)
+        {
+            _minMax = SynetCalibrationMinMax;
+            _histogram = SynetCalibrationHistogram;
+            _histogramNhwc = SynetCalibrationHistogramNhwc;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetCalibrationInit(size_t channels, SimdTensorFormatType format, size_t bins, SimdBool perChannel)
+        {
+            SynetCalibrationParam param(channels, format, bins, perChannel);
+            if (!param.Valid())
+                return NULL;
+            return new SynetCalibration(param);
+        }
+    }
+#endif
+}
@@ -35,6 +35,7 @@ namespace Simd
     {
         typedef Base::SynetConvolution16bNhwcGemm::AlgParam AlgParam;
         typedef Base::SynetConvolution16bNhwcGemm::ConvolutionPtr Convolution;
+        typedef Base::SynetConvolution16bNhwcGemm::AddActivatePtr AddActivate;
 
         //-----------------------------------------------------------------------------------------
 
@@ -494,6 +495,24 @@ namespace Simd
 
         //-----------------------------------------------------------------------------------------
 
+        template<SimdConvolutionActivationType type, class A, class D> void AddActivate16bNhwcGemm(const uint8_t* add8, const ConvParam& p, size_t dstC, size_t dstH, const float* params, uint8_t* dst8)
+        {
+            const A* add = (const A*)add8;
+            D* dst = (D*)dst8;
+            size_t size = dstH * p.dstW, dstCF = AlignLo(dstC, F);
+            __mmask16 tail = TailMask16(dstC - dstCF);
+            for (size_t i = 0; i < size; ++i, add += p.dstC, dst += p.dstC)
+            {
+                size_t c = 0;
+                for (; c < dstCF; c += F)
+                    AddActivate16b<type>(add, params, c, dst);
+                if (c < dstC)
+                    AddActivate16b<type>(add, params, c, dst, tail);
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
         template <SimdConvolutionActivationType type> SIMD_INLINE void Set(const ConvParam& p, const AlgParam & a, Convolution* convolutions)
         {
             convolutions[0] = Convolution16bNhwcGemm_2<Term16bInterim, SimdConvolutionActivationIdentity>;
@@ -503,6 +522,42 @@ namespace Simd
                 convolutions[1] = Convolution16bNhwcGemm_2<Term16bLast32f, type>;
         }
 
+        template <SimdConvolutionActivationType type> SIMD_INLINE void SetAdd(const ConvParam& p, AddActivate* addActivate)
+        {
+            if (p.dstT == SimdTensorData16b)
+            {
+                addActivate[0] = AddActivate16bNhwcGemm<type, float, uint16_t>;
+                addActivate[1] = AddActivate16bNhwcGemm<type, uint16_t, uint16_t>;
+            }
+            else
+            {
+                addActivate[0] = AddActivate16bNhwcGemm<type, float, float>;
+                addActivate[1] = AddActivate16bNhwcGemm<type, uint16_t, float>;
+            }
+        }
+
+        static void SetAdd(const ConvParam& p, const AlgParam& a, Convolution& addConvolution, AddActivate* addActivate)
+        {
+            Convolution convolutions[2];
+            Set<SimdConvolutionActivationRestrictRange>(p, a, convolutions);
+            addConvolution = convolutions[1];
+            switch (p.activation)
+            {
+            case SimdConvolutionActivationIdentity: SetAdd<SimdConvolutionActivationRestrictRange>(p, addActivate); break;
+            case SimdConvolutionActivationRelu: SetAdd<SimdConvolutionActivationRestrictRange>(p, addActivate); break;
+            case SimdConvolutionActivationLeakyRelu: SetAdd<SimdConvolutionActivationPrelu>(p, addActivate); break;
+            case SimdConvolutionActivationRestrictRange: SetAdd<SimdConvolutionActivationRestrictRange>(p, addActivate); break;
+            case SimdConvolutionActivationPrelu: SetAdd<SimdConvolutionActivationPrelu>(p, addActivate); break;
+            case SimdConvolutionActivationElu: SetAdd<SimdConvolutionActivationElu>(p, addActivate); break;
+            case SimdConvolutionActivationHswish: SetAdd<SimdConvolutionActivationHswish>(p, addActivate); break;
+            case SimdConvolutionActivationMish: SetAdd<SimdConvolutionActivationMish>(p, addActivate); break;
+            case SimdConvolutionActivationHardSigmoid: SetAdd<SimdConvolutionActivationHardSigmoid>(p, addActivate); break;
+            case SimdConvolutionActivationSwish: SetAdd<SimdConvolutionActivationSwish>(p, addActivate); break;
+            case SimdConvolutionActivationGelu: SetAdd<SimdConvolutionActivationGelu>(p, addActivate); break;
+            default: assert(0);
+            }
+        }
+
         SynetConvolution16bNhwcGemm::SynetConvolution16bNhwcGemm(const ConvParam & p)
             : Avx2::SynetConvolution16bNhwcGemm(p)
         {
@@ -532,6 +587,7 @@ namespace Simd
             case SimdConvolutionActivationGelu: Set<SimdConvolutionActivationGelu>(p, _alg, _convolutions); break;
             default: assert(0);
             }
+            SetAdd(p, _alg, _addConvolution, _addActivate);
         }
     }
 #endif
@@ -22,17 +22,28 @@
 * SOFTWARE.
 */
 #include "Simd/SimdSynetDeconvolution16b.h"
+#include "Simd/SimdSynetConvolution16b.h"
 
 namespace Simd
 {
 #if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE) 
     namespace Avx512bw
     {
+        SynetDeconvolution16bNhwcSubPixel::SynetDeconvolution16bNhwcSubPixel(const DeconvParam& p)
+            : Avx2::SynetDeconvolution16bNhwcSubPixel(p)
+        {
+            SetConvolutions(Avx512bw::SynetConvolution16bInit);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         void* SynetDeconvolution16bInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
         {
             DeconvParam param(batch, conv, compatibility);
             if (!param.Valid(SimdTensorData32f, SimdTensorData16b))
                 return NULL;
+            if (SynetDeconvolution16bNhwcSubPixel::Preferable(param))
+                return new Avx512bw::SynetDeconvolution16bNhwcSubPixel(param);
             if (SynetDeconvolution16bNhwcGemm::Preferable(param))
                 return new Avx512bw::SynetDeconvolution16bNhwcGemm(param);
             return new Base::SynetDeconvolution16bGemm(param);
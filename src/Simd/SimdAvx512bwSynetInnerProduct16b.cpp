@@ -37,6 +37,14 @@ namespace Simd
                 return new Avx512bw::SynetInnerProduct16bGemmNN(param);
             return Avx2::SynetInnerProduct16bInit(M, N, K, typeA, typeB, typeC, transB, constB, bias);
         }
+
+        void* SynetInnerProduct16bInitWq(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeC, SimdBool transB, SimdBool bias, size_t bits, size_t group)
+        {
+            InnerProductParam16b param(M, N, K, typeA, SimdTensorData32f, typeC, transB, SimdTrue, bias, bits, group);
+            if (!param.Valid())
+                return NULL;
+            return new Avx512bw::SynetInnerProduct16bGemmNN(param);
+        }
     }
 #endif
 }
@@ -319,6 +319,117 @@ namespace Simd
 
         //-----------------------------------------------------------------------------------------
 
+        template<int bits> SIMD_INLINE void DequantQ(const uint8_t* src, __m512 scale, __m512& even, __m512& odd);
+
+        template<> SIMD_INLINE void DequantQ<4>(const uint8_t* src, __m512 scale, __m512& even, __m512& odd)
+        {
+            __m128i _src = _mm_loadu_si128((__m128i*)src);
+            __m128i lo = _mm_sub_epi8(_mm_and_si128(_src, Sse41::K8_0F), Sse41::K8_08);
+            __m128i hi = _mm_sub_epi8(_mm_and_si128(_mm_srli_epi16(_src, 4), Sse41::K8_0F), Sse41::K8_08);
+            even = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(lo)), scale);
+            odd = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(hi)), scale);
+        }
+
+        template<> SIMD_INLINE void DequantQ<8>(const uint8_t* src, __m512 scale, __m512& even, __m512& odd)
+        {
+            even = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128((__m128i*)(src + 0)))), scale);
+            odd = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128((__m128i*)(src + F)))), scale);
+        }
+
+        template<int bits> SIMD_INLINE void DequantB(const uint8_t* src, __m512 scale, uint16_t* dst)
+        {
+            __m512 even, odd;
+            DequantQ<bits>(src, scale, even, odd);
+            _mm512_storeu_si512((__m512i*)dst, Float32ToBFloat16Interlived(even, odd));
+        }
+
+        template<int bits> static void InnerProduct16bGemmNN_DequantB(const uint8_t* src, const float* scale, const InnerProductParam16b& p, const AlgParam& a, size_t N, size_t k, size_t K, uint16_t* dst)
+        {
+            size_t Kh = AlignHi(K, a.microK), gap = (a.bK - Kh) * a.F, G = p.qGroup, nG = DivHi(a.aK, G);
+            size_t srcStep = a.aK * a.F * bits / 8, scaleStep = nG * a.F;
+            for (size_t j = 0; j < N; j += a.F)
+            {
+                for (size_t kk = 0; kk < Kh;)
+                {
+                    size_t g = (k + kk) / G, end = Simd::Min(Kh, (g + 1) * G - k);
+                    __m512 s = _mm512_loadu_ps(scale + g * a.F);
+                    const uint8_t* ps = src + (k + kk) * a.F * bits / 8;
+                    for (; kk < end; kk += 2, ps += a.F * bits / 4, dst += DF)
+                        DequantB<bits>(ps, s, dst);
+                }
+                dst += gap;
+                src += srcStep;
+                scale += scaleStep;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m512 RoundToBFloat16(__m512 value)
+        {
+            return _mm512_castsi512_ps(_mm512_and_si512(_mm512_add_epi32(_mm512_castps_si512(value), BFloat16Round(value)), Bf16::MASK));
+        }
+
+        template<int bits, int M, class T> void InnerProduct16bGemmNN_GemvQ(const float* A, const InnerProductParam16b& p, const AlgParam& a,
+            const uint8_t* src, const float* scale, const float* bias, T* C, __mmask16 tail)
+        {
+            __m512 c[M], s, w0, w1;
+            for (size_t i = 0; i < M; ++i)
+                c[i] = _mm512_setzero_ps();
+            for (size_t k = 0, K = AlignHi(p.K, 2), G = p.qGroup; k < K;)
+            {
+                size_t end = Simd::Min(K, k + G);
+                s = _mm512_loadu_ps(scale + k / G * F);
+                for (; k < end; k += 2, src += F * bits / 4)
+                {
+                    DequantQ<bits>(src, s, w0, w1);
+                    w0 = RoundToBFloat16(w0);
+                    w1 = RoundToBFloat16(w1);
+                    for (size_t i = 0; i < M; ++i)
+                    {
+                        c[i] = _mm512_fmadd_ps(_mm512_set1_ps(A[i * a.aK + k + 0]), w0, c[i]);
+                        c[i] = _mm512_fmadd_ps(_mm512_set1_ps(A[i * a.aK + k + 1]), w1, c[i]);
+                    }
+                }
+            }
+            __m512 _bias = _mm512_loadu_ps(bias);
+            for (size_t i = 0; i < M; ++i)
+                SaveDst<T>(C + i * p.N, _mm512_add_ps(c[i], _bias), tail);
+        }
+
+        template<int bits, class T> void InnerProduct16bGemmNN_GemvQ(const float* A, const InnerProductParam16b& p, const AlgParam& a,
+            const uint8_t* src, const float* scale, const float* bias, uint8_t* C8)
+        {
+            T* C = (T*)C8;
+            size_t srcStep = a.aK * F * bits / 8, scaleStep = DivHi(a.aK, p.qGroup) * F;
+            for (size_t j = 0; j < p.N; j += F)
+            {
+                __mmask16 tail = TailMask16(p.N - j);
+                for (size_t i = 0; i < p.M; i += 4)
+                {
+                    const float* pA = A + i * a.aK;
+                    T* pC = C + i * p.N + j;
+                    switch (Simd::Min<size_t>(p.M - i, 4))
+                    {
+                    case 1: InnerProduct16bGemmNN_GemvQ<bits, 1, T>(pA, p, a, src, scale, bias, pC, tail); break;
+                    case 2: InnerProduct16bGemmNN_GemvQ<bits, 2, T>(pA, p, a, src, scale, bias, pC, tail); break;
+                    case 3: InnerProduct16bGemmNN_GemvQ<bits, 3, T>(pA, p, a, src, scale, bias, pC, tail); break;
+                    case 4: InnerProduct16bGemmNN_GemvQ<bits, 4, T>(pA, p, a, src, scale, bias, pC, tail); break;
+                    }
+                }
+                src += srcStep;
+                scale += scaleStep;
+                bias += F;
+            }
+        }
+
+        template<int bits> SIMD_INLINE Base::SynetInnerProduct16bGemmNN::GemvPtr GetGemvQ(const InnerProductParam16b& p)
+        {
+            return p.typeC == SimdTensorData16b ? InnerProduct16bGemmNN_GemvQ<bits, uint16_t> : InnerProduct16bGemmNN_GemvQ<bits, float>;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
         template<Term16bType term, int M> void InnerProduct16bGemmNN_2xM(const uint16_t* A0, const InnerProductParam16b& p, const AlgParam& a,
             size_t N, size_t K, int update, const uint16_t* B0, float* C, const __m512* bias, uint8_t* dst)
         {
@@ -716,6 +827,12 @@ namespace Simd
                 _gemm = InnerProduct16bGemmNN_Gemm2<Term16bLast16b>;
             else
                 _gemm = InnerProduct16bGemmNN_Gemm2<Term16bLast32f>;
+            if (p.qBits == 4)
+                _dequantB = InnerProduct16bGemmNN_DequantB<4>;
+            if (p.qBits == 8)
+                _dequantB = InnerProduct16bGemmNN_DequantB<8>;
+            if (p.qBits && p.M <= 4)
+                SetGemv(p.qBits == 4 ? GetGemvQ<4>(p) : GetGemvQ<8>(p));
         }
     }
 #endif
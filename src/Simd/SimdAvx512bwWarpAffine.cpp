@@ -242,7 +242,7 @@ namespace Simd
             : Avx2::WarpAffineNearest(param)
         {
             bool soft = Avx2::SlowGather;
-            switch (_param.channels)
+            switch (_param.PixelSize())
             {
             case 1: _run = soft ? NearestRun<1, true> : NearestRun<1, false>; break;
             case 2: _run = soft ? NearestRun<2, true> : NearestRun<2, false>; break;
@@ -691,20 +691,23 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        WarpAffineByteBilinear::WarpAffineByteBilinear(const WarpAffParam& param)
-            : Avx2::WarpAffineByteBilinear(param)
+        WarpAffineBilinear::WarpAffineBilinear(const WarpAffParam& param)
+            : Avx2::WarpAffineBilinear(param)
         {
             bool soft = Avx2::SlowGather;
-            switch (_param.channels)
+            if (_param.IsByte())
             {
-            case 1: _run = soft ? ByteBilinearRun<1, true> : ByteBilinearRun<1, false>; break;
-            case 2: _run = soft ? ByteBilinearRun<2, true> : ByteBilinearRun<2, false>; break;
-            case 3: _run = soft ? ByteBilinearRun<3, true> : ByteBilinearRun<3, false>; break;
-            case 4: _run = soft ? ByteBilinearRun<4, true> : ByteBilinearRun<4, false>; break;
+                switch (_param.channels)
+                {
+                case 1: _run = soft ? ByteBilinearRun<1, true> : ByteBilinearRun<1, false>; break;
+                case 2: _run = soft ? ByteBilinearRun<2, true> : ByteBilinearRun<2, false>; break;
+                case 3: _run = soft ? ByteBilinearRun<3, true> : ByteBilinearRun<3, false>; break;
+                case 4: _run = soft ? ByteBilinearRun<4, true> : ByteBilinearRun<4, false>; break;
+                }
             }
         }
 
-        void WarpAffineByteBilinear::SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi)
+        void WarpAffineBilinear::SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi)
         {
             const WarpAffParam& p = _param;
             float* min = (float*)_buf.data;
@@ -801,8 +804,8 @@ namespace Simd
                 return NULL;
             if (param.IsNearest())
                 return new WarpAffineNearest(param);
-            else if (param.IsByteBilinear())
-                return new WarpAffineByteBilinear(param);
+            else if (param.IsBilinear())
+                return new WarpAffineBilinear(param);
             else
                 return NULL;
         }
@@ -814,8 +817,8 @@ namespace Simd
                 return NULL;
             if (param.IsNearest())
                 return new Avx2::WarpAffineNearest(param);
-            else if (param.IsByteBilinear())
-                return new Avx2::WarpAffineByteBilinear(param);
+            else if (param.IsBilinear())
+                return new Avx2::WarpAffineBilinear(param);
             else
                 return NULL;
         }
@@ -238,6 +238,16 @@ namespace Simd
         void DetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
             ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
+        void DetectionDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t size, SimdBool clip, float* dst);
+
+        size_t DetectionDecodeYolo32f(const float* src, size_t height, size_t width, size_t anchors, size_t classes, const float* anchorSizes,
+            float threshold, float* boxes, float* scores, uint32_t* labels, size_t capacity);
+
+        size_t DetectionFilterScores32f(const float* scores, size_t size, float threshold, uint32_t* indices);
+
+        size_t DetectionNms32f(const float* boxes, const float* scores, const uint32_t* labels, size_t size, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* keepScores);
+
         void Fill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value);
 
         void FillFrame(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize,
@@ -307,6 +317,9 @@ namespace Simd
 
         void NormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
+        void NormalizeHistogramAdaptive(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t tilesX, size_t tilesY, float clipLimit, uint8_t* dst, size_t dstStride);
+
         void AddRowToHistograms(int * indexes, float * values, size_t row, size_t width, size_t height,
             size_t cellX, size_t cellY, size_t quantization, float * histograms);
 
@@ -355,6 +368,15 @@ namespace Simd
         void MedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             size_t channelCount, uint8_t * dst, size_t dstStride);
 
+        void MedianFilterSquare(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t* dst, size_t dstStride);
+
+        void Morphology(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t* dst, size_t dstStride);
+
+        void MorphologyBits(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t* dst, size_t dstStride);
+
         void NeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
 
         void NeuralProductSum(const float * a, const float * b, size_t size, float * sum);
@@ -448,6 +470,9 @@ namespace Simd
 
         void RgbaToGray(const uint8_t* rgba, size_t width, size_t height, size_t rgbaStride, uint8_t* gray, size_t grayStride);
 
+        size_t ConnectedComponents(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t threshold,
+            SimdConnectedComponentsFlags flags, uint32_t* labels, size_t labelsStride, SimdConnectedComponentStat* stats, size_t capacity);
+
         void SegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex);
 
         void SegmentationFillSingleHoles(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index);
@@ -0,0 +1,275 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdConnectedComponents.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        struct CcRun
+        {
+            uint32_t beg, end;
+            uint64_t sum;
+        };
+
+        struct CcStripe
+        {
+            size_t yBeg, yEnd;
+            std::vector<CcRun> runs;
+            std::vector<uint32_t> rows, parents;
+        };
+
+        SIMD_INLINE uint32_t CcFind(uint32_t* parents, uint32_t index)
+        {
+            uint32_t root = index;
+            while (parents[root] != root)
+                root = parents[root];
+            while (parents[index] != root)
+            {
+                uint32_t next = parents[index];
+                parents[index] = root;
+                index = next;
+            }
+            return root;
+        }
+
+        SIMD_INLINE void CcUnion(uint32_t* parents, uint32_t a, uint32_t b)
+        {
+            a = CcFind(parents, a);
+            b = CcFind(parents, b);
+            if (a < b)
+                parents[b] = a;
+            else if (b < a)
+                parents[a] = b;
+        }
+
+        static void CcExtractRuns(const uint64_t* mask, size_t width, const uint8_t* src, CcSumRowPtr sumRow, std::vector<CcRun>& runs)
+        {
+            uint64_t carry = 0;
+            CcRun run;
+            for (size_t i = 0, words = DivHi(width, 64); i < words; ++i)
+            {
+                uint64_t bits = mask[i], edges = bits ^ ((bits << 1) | carry);
+                carry = bits >> 63;
+                while (edges)
+                {
+                    size_t offset = CcTrailingZeros(edges);
+                    uint32_t x = uint32_t(i * 64 + offset);
+                    if ((bits >> offset) & 1)
+                        run.beg = x;
+                    else
+                    {
+                        run.end = x;
+                        run.sum = src ? sumRow(src + run.beg, run.end - run.beg) : run.end - run.beg;
+                        runs.push_back(run);
+                    }
+                    edges &= edges - 1;
+                }
+            }
+            if (carry)
+            {
+                run.end = uint32_t(width);
+                run.sum = src ? sumRow(src + run.beg, run.end - run.beg) : run.end - run.beg;
+                runs.push_back(run);
+            }
+        }
+
+        static void CcUnionRows(const CcRun* runs, uint32_t* parents, uint32_t prevBeg, uint32_t prevEnd, uint32_t currBeg, uint32_t currEnd, uint32_t gap)
+        {
+            for (uint32_t p = prevBeg, c = currBeg; p < prevEnd && c < currEnd;)
+            {
+                if (runs[p].beg < runs[c].end + gap && runs[c].beg < runs[p].end + gap)
+                    CcUnion(parents, p, c);
+                if (runs[p].end < runs[c].end)
+                    p++;
+                else
+                    c++;
+            }
+        }
+
+        static void CcProcessStripe(const CcOps& ops, const uint8_t* src, size_t srcStride, size_t width, uint8_t threshold, bool gray, uint32_t gap, CcStripe& stripe)
+        {
+            const size_t words = DivHi(width, 64);
+            std::vector<uint64_t> mask(words);
+            stripe.runs.clear();
+            stripe.rows.resize(stripe.yEnd - stripe.yBeg + 1);
+            for (size_t y = stripe.yBeg; y < stripe.yEnd; ++y)
+            {
+                const uint8_t* ps = src + y * srcStride;
+                if (gray)
+                    ops.maskRow(ps, width, threshold, mask.data());
+                else
+                {
+                    mask[words - 1] = 0;
+                    memcpy(mask.data(), ps, DivHi(width, 8));
+                    if (width & 63)
+                        mask[words - 1] &= (uint64_t(1) << (width & 63)) - 1;
+                }
+                stripe.rows[y - stripe.yBeg] = uint32_t(stripe.runs.size());
+                CcExtractRuns(mask.data(), width, gray ? ps : NULL, ops.sumRow, stripe.runs);
+            }
+            stripe.rows.back() = uint32_t(stripe.runs.size());
+            stripe.parents.resize(stripe.runs.size());
+            for (size_t i = 0; i < stripe.parents.size(); ++i)
+                stripe.parents[i] = uint32_t(i);
+            for (size_t y = 1, n = stripe.yEnd - stripe.yBeg; y < n; ++y)
+                CcUnionRows(stripe.runs.data(), stripe.parents.data(), stripe.rows[y - 1], stripe.rows[y], stripe.rows[y], stripe.rows[y + 1], gap);
+        }
+
+        size_t ConnectedComponents(const CcOps& ops, const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t threshold,
+            SimdConnectedComponentsFlags flags, uint32_t* labels, size_t labelsStride, SimdConnectedComponentStat* stats, size_t capacity)
+        {
+            const bool gray = (flags & SimdConnectedComponentsFormatMask) == SimdConnectedComponentsGray8;
+            const uint32_t gap = (flags & SimdConnectedComponentsConnectivityMask) == SimdConnectedComponents8 ? 1 : 0;
+            if (width == 0 || height == 0)
+                return 0;
+
+            std::vector<CcStripe> stripes(GetThreadNumber());
+            Simd::Parallel(0, height, [&](size_t thread, size_t yBeg, size_t yEnd)
+            {
+                stripes[thread].yBeg = yBeg;
+                stripes[thread].yEnd = yEnd;
+                CcProcessStripe(ops, src, srcStride, width, threshold, gray, gap, stripes[thread]);
+            }, stripes.size(), 16);
+
+            std::vector<CcRun> runs;
+            std::vector<uint32_t> parents, rows(height + 1), first;
+            for (size_t s = 0; s < stripes.size(); ++s)
+            {
+                const CcStripe& stripe = stripes[s];
+                if (stripe.yEnd <= stripe.yBeg)
+                    continue;
+                uint32_t offset = uint32_t(runs.size());
+                for (size_t y = stripe.yBeg; y <= stripe.yEnd; ++y)
+                    rows[y] = stripe.rows[y - stripe.yBeg] + offset;
+                runs.insert(runs.end(), stripe.runs.begin(), stripe.runs.end());
+                for (size_t i = 0; i < stripe.parents.size(); ++i)
+                    parents.push_back(stripe.parents[i] + offset);
+                first.push_back(uint32_t(stripe.yBeg));
+            }
+            for (size_t s = 0; s < first.size(); ++s)
+            {
+                size_t y = first[s];
+                if (y)
+                    CcUnionRows(runs.data(), parents.data(), rows[y - 1], rows[y], rows[y], rows[y + 1], gap);
+            }
+
+            std::vector<uint32_t> runLabels(runs.size());
+            uint32_t count = 0;
+            for (uint32_t i = 0; i < (uint32_t)runs.size(); ++i)
+            {
+                uint32_t root = CcFind(parents.data(), i);
+                runLabels[i] = root == i ? ++count : runLabels[root];
+            }
+
+            if (stats)
+            {
+                size_t size = Simd::Min<size_t>(count, capacity);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    SimdConnectedComponentStat& stat = stats[i];
+                    stat.area = 0;
+                    stat.left = uint32_t(width), stat.top = uint32_t(height), stat.right = 0, stat.bottom = 0;
+                    stat.sumX = 0, stat.sumY = 0, stat.sumValue = 0;
+                }
+                for (size_t y = 0; y < height; ++y)
+                {
+                    for (uint32_t i = rows[y]; i < rows[y + 1]; ++i)
+                    {
+                        if (runLabels[i] > size)
+                            continue;
+                        const CcRun& run = runs[i];
+                        SimdConnectedComponentStat& stat = stats[runLabels[i] - 1];
+                        uint32_t length = run.end - run.beg;
+                        stat.area += length;
+                        stat.left = Simd::Min(stat.left, run.beg);
+                        stat.right = Simd::Max(stat.right, run.end);
+                        stat.top = Simd::Min(stat.top, uint32_t(y));
+                        stat.bottom = uint32_t(y + 1);
+                        stat.sumX += uint64_t(run.beg + run.end - 1) * length / 2;
+                        stat.sumY += uint64_t(y) * length;
+                        stat.sumValue += run.sum;
+                    }
+                }
+                for (size_t i = 0; i < size; ++i)
+                {
+                    SimdConnectedComponentStat& stat = stats[i];
+                    stat.centroidX = float(double(stat.sumX) / stat.area);
+                    stat.centroidY = float(double(stat.sumY) / stat.area);
+                }
+            }
+
+            if (labels)
+            {
+                Simd::Parallel(0, height, [&](size_t thread, size_t yBeg, size_t yEnd)
+                {
+                    for (size_t y = yBeg; y < yEnd; ++y)
+                    {
+                        uint32_t* pl = (uint32_t*)((uint8_t*)labels + y * labelsStride);
+                        memset(pl, 0, width * sizeof(uint32_t));
+                        for (uint32_t i = rows[y]; i < rows[y + 1]; ++i)
+                            for (uint32_t x = runs[i].beg, label = runLabels[i]; x < runs[i].end; ++x)
+                                pl[x] = label;
+                    }
+                }, GetThreadNumber());
+            }
+
+            return count;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void CcMaskRow(const uint8_t* src, size_t width, uint8_t threshold, uint64_t* dst)
+        {
+            for (size_t i = 0, words = DivHi(width, 64); i < words; ++i)
+            {
+                uint64_t bits = 0;
+                for (size_t j = 0, n = Simd::Min<size_t>(64, width - i * 64); j < n; ++j)
+                    bits |= uint64_t(src[i * 64 + j] >= threshold) << j;
+                dst[i] = bits;
+            }
+        }
+
+        static uint64_t CcSumRow(const uint8_t* src, size_t size)
+        {
+            uint64_t sum = 0;
+            for (size_t i = 0; i < size; ++i)
+                sum += src[i];
+            return sum;
+        }
+
+        size_t ConnectedComponents(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t threshold,
+            SimdConnectedComponentsFlags flags, uint32_t* labels, size_t labelsStride, SimdConnectedComponentStat* stats, size_t capacity)
+        {
+            static const CcOps ops = { CcMaskRow, CcSumRow };
+            return ConnectedComponents(ops, src, srcStride, width, height, threshold, flags, labels, labelsStride, stats, capacity);
+        }
+    }
+}
@@ -0,0 +1,197 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDetectionNms.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdBase.h"
+
+#include <algorithm>
+#include <float.h>
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE float Sigmoid(float value)
+        {
+            return 1.0f / (1.0f + ::expf(-value));
+        }
+
+        SIMD_INLINE void DecodeSsd(const float* loc, const float* prior, const float* variance, bool clip, float* dst)
+        {
+            float pw = prior[2] - prior[0], ph = prior[3] - prior[1];
+            float cx = (prior[0] + prior[2]) * 0.5f + loc[0] * variance[0] * pw;
+            float cy = (prior[1] + prior[3]) * 0.5f + loc[1] * variance[1] * ph;
+            float hw = ::expf(loc[2] * variance[2]) * pw * 0.5f;
+            float hh = ::expf(loc[3] * variance[3]) * ph * 0.5f;
+            dst[0] = cx - hw;
+            dst[1] = cy - hh;
+            dst[2] = cx + hw;
+            dst[3] = cy + hh;
+            if (clip)
+            {
+                for (size_t i = 0; i < 4; ++i)
+                    dst[i] = Simd::RestrictRange(dst[i], 0.0f, 1.0f);
+            }
+        }
+
+        void DetectionDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t size, SimdBool clip, float* dst)
+        {
+            for (size_t i = 0; i < size; ++i, loc += 4, prior += 4, variance += 4, dst += 4)
+                DecodeSsd(loc, prior, variance, clip == SimdTrue, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t DetectionDecodeYolo32f(const float* src, size_t height, size_t width, size_t anchors, size_t classes, const float* anchorSizes,
+            float threshold, float* boxes, float* scores, uint32_t* labels, size_t capacity, DetectionArgMaxPtr argMax)
+        {
+            if (threshold >= 1.0f)
+                return 0;
+            float logit = threshold > 0.0f ? ::logf(threshold / (1.0f - threshold)) : -FLT_MAX;
+            size_t step = 5 + classes, count = 0;
+            for (size_t y = 0; y < height; ++y)
+            {
+                for (size_t x = 0; x < width; ++x)
+                {
+                    for (size_t a = 0; a < anchors; ++a, src += step)
+                    {
+                        if (src[4] <= logit)
+                            continue;
+                        size_t label = classes ? argMax(src + 5, classes) : 0;
+                        float score = Sigmoid(src[4]) * (classes ? Sigmoid(src[5 + label]) : 1.0f);
+                        if (score <= threshold)
+                            continue;
+                        if (count == capacity)
+                            return count;
+                        float cx = (float(x) + Sigmoid(src[0])) / float(width);
+                        float cy = (float(y) + Sigmoid(src[1])) / float(height);
+                        float hw = anchorSizes[2 * a + 0] * ::expf(src[2]) * 0.5f;
+                        float hh = anchorSizes[2 * a + 1] * ::expf(src[3]) * 0.5f;
+                        boxes[0] = cx - hw;
+                        boxes[1] = cy - hh;
+                        boxes[2] = cx + hw;
+                        boxes[3] = cy + hh;
+                        boxes += 4;
+                        scores[count] = score;
+                        if (labels)
+                            labels[count] = (uint32_t)label;
+                        count++;
+                    }
+                }
+            }
+            return count;
+        }
+
+        size_t DetectionDecodeYolo32f(const float* src, size_t height, size_t width, size_t anchors, size_t classes, const float* anchorSizes,
+            float threshold, float* boxes, float* scores, uint32_t* labels, size_t capacity)
+        {
+            return DetectionDecodeYolo32f(src, height, width, anchors, classes, anchorSizes, threshold, boxes, scores, labels, capacity, ArgMax);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t DetectionFilterScores32f(const float* scores, size_t size, float threshold, uint32_t* indices)
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < size; ++i)
+                if (scores[i] > threshold)
+                    indices[count++] = (uint32_t)i;
+            return count;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        struct ScoreGreater
+        {
+            const float* scores;
+
+            ScoreGreater(const float* s) : scores(s) {}
+
+            SIMD_INLINE bool operator()(uint32_t a, uint32_t b) const
+            {
+                return scores[a] > scores[b] || (scores[a] == scores[b] && a < b);
+            }
+        };
+
+        size_t DetectionNms32f(const float* boxes, const float* scores, const uint32_t* labels, size_t size, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* keepScores, DetectionFilterScoresPtr filterScores, DetectionSuppressPtr suppress)
+        {
+            NmsBuffer buf;
+            buf.Resize(size);
+            size_t n = filterScores(scores, size, scoreThreshold, buf.index);
+            std::sort(buf.index, buf.index + n, ScoreGreater(scores));
+            for (size_t i = 0; i < n; ++i)
+            {
+                const float* box = boxes + 4 * buf.index[i];
+                buf.x0[i] = box[0];
+                buf.y0[i] = box[1];
+                buf.x1[i] = box[2];
+                buf.y1[i] = box[3];
+                buf.area[i] = (box[2] - box[0]) * (box[3] - box[1]);
+                buf.label[i] = labels ? float(labels[buf.index[i]]) : 0.0f;
+                buf.score[i] = scores[buf.index[i]];
+            }
+            size_t count = 0;
+            if (sigma > 0.0f)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    size_t best = i;
+                    for (size_t j = i + 1; j < n; ++j)
+                        if (buf.score[j] > buf.score[best])
+                            best = j;
+                    if (buf.score[best] <= scoreThreshold)
+                        break;
+                    if (best != i)
+                        buf.Swap(i, best);
+                    indices[count] = buf.index[i];
+                    if (keepScores)
+                        keepScores[count] = buf.score[i];
+                    count++;
+                    suppress(buf, i, i + 1, n, iouThreshold, sigma, labels != NULL);
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    if (buf.score[i] == -FLT_MAX)
+                        continue;
+                    indices[count] = buf.index[i];
+                    if (keepScores)
+                        keepScores[count] = buf.score[i];
+                    count++;
+                    suppress(buf, i, i + 1, n, iouThreshold, sigma, labels != NULL);
+                }
+            }
+            return count;
+        }
+
+        size_t DetectionNms32f(const float* boxes, const float* scores, const uint32_t* labels, size_t size, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* keepScores)
+        {
+            return DetectionNms32f(boxes, scores, labels, size, iouThreshold, sigma, scoreThreshold, indices, keepScores, DetectionFilterScores32f, DetectionSuppress);
+        }
+    }
+}
@@ -24,15 +24,17 @@
 #include "Simd/SimdDefs.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
-    BlurParam::BlurParam(size_t w, size_t h, size_t c, const float* s, const float* e, size_t a)
+    BlurParam::BlurParam(size_t w, size_t h, size_t c, const float* s, const float* e, SimdGaussianBlurFlags f, size_t a)
         : width(w)
         , height(h)
         , channels(c)
         , sigma(*s)
         , epsilon(e ? *e : 0.001f)
+        , flags(f)
         , align(a)
     {
     }
@@ -45,13 +47,22 @@ namespace Simd
             channels > 0 && channels <= 4 &&
             sigma >= 0.000001f &&
             epsilon >= 0.000001f && epsilon <= 1.0f &&
+            Channel() != SimdGaussianBlurChannelMask &&
+            Engine() != SimdGaussianBlurEngineMask &&
+            (Engine() != SimdGaussianBlurEngineRecursive || sigma >= 0.5f) &&
             align >= sizeof(float);
     }
 
+    bool BlurParam::IsRecursive() const
+    {
+        return Engine() == SimdGaussianBlurEngineRecursive || (Engine() == SimdGaussianBlurEngineAuto && sigma >= 6.0f);
+    }
+
     //---------------------------------------------------------------------
 
     GaussianBlur::GaussianBlur(const BlurParam& param)
         : _param(param)
+        , _threads(Base::GetThreadNumber())
     {
     }
 
@@ -59,7 +70,7 @@ namespace Simd
 
     namespace Base
     {
-        SIMD_INLINE void BlurColsAny(const uint8_t* src, size_t size, size_t channels, const float* weight, size_t kernel, float* dst)
+        template<class T> SIMD_INLINE void BlurColsAny(const T* src, size_t size, size_t channels, const float* weight, size_t kernel, float* dst)
         {
             for (size_t i = 0; i < size; ++i)
             {
@@ -70,58 +81,33 @@ namespace Simd
             }
         }
 
-        SIMD_INLINE void BlurRowsAny(const float* src, size_t size, size_t stride, const float* weight, size_t kernel, uint8_t* dst)
+        template<class T> SIMD_INLINE void BlurRowsAny(const float* src, size_t size, size_t stride, const float* weight, size_t kernel, T* dst)
         {
             for (size_t i = 0; i < size; ++i)
             {
                 float sum = 0;
                 for (size_t k = 0; k < kernel; ++k)
                     sum += weight[k] * src[i + k * stride];
-                dst[i] = Round(sum);
+                dst[i] = BlurCast<T>(sum);
             }
         }
 
-        template<int channels> void BlurImageAny(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<class T> struct BlurAny
         {
-            PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
+            static SIMD_INLINE void Cols(const AlgDefault& a, const T* src, size_t channels, float* dst)
             {
-                PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + (a.half + row) * a.stride);
+                BlurColsAny(src, a.size, channels, a.weight.data, a.kernel, dst);
             }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRowsAny(rows, a.size, a.stride, a.weight.data, a.kernel, dst), dst += dstStride;
 
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < a.body; ++row, ++b, --w)
+            static SIMD_INLINE void Rows(const AlgDefault& a, const float* src, const float* weight, T* dst)
             {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + b * a.stride);
-                BlurRowsAny(rows, a.size, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
+                BlurRowsAny(src, a.size, a.stride, weight, a.kernel, dst);
             }
-
-            size_t last = (a.body + 2 * a.half - 1) % a.kernel;
-            for (size_t row = a.body, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < p.height; ++row, ++b, --w)
-            {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRowsAny(rows, a.size, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
-            }
-        }
+        };
 
         //---------------------------------------------------------------------
 
-        template<int kernel> SIMD_INLINE void BlurCols(const uint8_t* src, size_t size, size_t channels, const float* weight, float* dst)
+        template<int kernel, class T> SIMD_INLINE void BlurCols(const T* src, size_t size, size_t channels, const float* weight, float* dst)
         {
             for (size_t i = 0; i < size; ++i)
             {
@@ -132,66 +118,53 @@ namespace Simd
             }
         }
 
-        template<int kernel> SIMD_INLINE void BlurRows(const float* src, size_t size, size_t stride, const float* weight, uint8_t* dst)
+        template<int kernel, class T> SIMD_INLINE void BlurRows(const float* src, size_t size, size_t stride, const float* weight, T* dst)
         {
             for (size_t i = 0; i < size; ++i)
             {
                 float sum = 0;
                 for (size_t k = 0; k < kernel; ++k)
                     sum += weight[k] * src[i + k * stride];
-                dst[i] = Round(sum);
+                dst[i] = BlurCast<T>(sum);
             }
         }
 
-        template<int channels, int kernel> void BlurImage(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<class T, int kernel> struct BlurKernel
         {
-            PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
+            static SIMD_INLINE void Cols(const AlgDefault& a, const T* src, size_t channels, float* dst)
             {
-                PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + (a.half + row) * a.stride);
+                BlurCols<kernel>(src, a.size, channels, a.weight.data, dst);
             }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRows<kernel>(rows, a.size, a.stride, a.weight.data, dst), dst += dstStride;
 
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = kernel - row % kernel; row < a.body; ++row, ++b, --w)
+            static SIMD_INLINE void Rows(const AlgDefault& a, const float* src, const float* weight, T* dst)
             {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + b * a.stride);
-                BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + w, dst), dst += dstStride;
+                BlurRows<kernel>(src, a.size, a.stride, weight, dst);
             }
+        };
+
+        //---------------------------------------------------------------------
 
-            size_t last = (a.body + 2 * a.half - 1) % kernel;
-            for (size_t row = a.body, b = row % kernel + 2 * a.half, w = kernel - row % kernel; row < p.height; ++row, ++b, --w)
+        template<class T, int channels> Base::BlurDefaultPtr GetBlurDefaultPtr(const BlurParam& p, const Base::AlgDefault& a)
+        {
+            switch (a.kernel)
             {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + w, dst), dst += dstStride;
+            case 3: return BlurImage<T, channels, BlurKernel<T, 3>>;
+            case 5: return BlurImage<T, channels, BlurKernel<T, 5>>;
+            case 7: return BlurImage<T, channels, BlurKernel<T, 7>>;
+            case 9: return BlurImage<T, channels, BlurKernel<T, 9>>;
+            default: return BlurImage<T, channels, BlurAny<T>>;
             }
         }
 
-        //---------------------------------------------------------------------
-
-        template<int channels> Base::BlurDefaultPtr GetBlurDefaultPtr(const BlurParam& p, const Base::AlgDefault& a)
+        template<class T> Base::BlurDefaultPtr GetBlurDefaultPtr(const BlurParam& p, const Base::AlgDefault& a)
         {
-            switch (a.kernel)
+            switch (p.channels)
             {
-            case 3: return BlurImage<channels, 3>;
-            case 5: return BlurImage<channels, 5>;
-            case 7: return BlurImage<channels, 7>;
-            case 9: return BlurImage<channels, 9>;
-            default: return BlurImageAny<channels>;
+            case 1: return GetBlurDefaultPtr<T, 1>(p, a);
+            case 2: return GetBlurDefaultPtr<T, 2>(p, a);
+            case 3: return GetBlurDefaultPtr<T, 3>(p, a);
+            case 4: return GetBlurDefaultPtr<T, 4>(p, a);
+            default: return NULL;
             }
         }
 
@@ -200,7 +173,7 @@ namespace Simd
         GaussianBlurDefault::GaussianBlurDefault(const BlurParam& param)
             : Simd::GaussianBlur(param)
         {
-            _alg.half = (int)::floor(::sqrt(-::log(_param.epsilon)) * _param.sigma);
+            _alg.half = _param.Half();
             _alg.kernel = 2 * _alg.half + 1;
             _alg.weight.Resize(2 * _alg.kernel);
             _alg.weight[_alg.half] = 1.0f;
@@ -217,22 +190,23 @@ namespace Simd
                 _alg.weight[i] /= sum;
                 _alg.weight[_alg.kernel + i] = _alg.weight[i];
             }
+            size_t pixel = _param.channels * _param.ChannelSize();
             _alg.size = _param.width * _param.channels;
             _alg.stride = AlignHi(_alg.size, _param.align / sizeof(float));
-            _alg.edge = AlignHi(_alg.half * _param.channels, _param.align);
-            _alg.start = _alg.edge - _alg.half * _param.channels;
-            _alg.nose = Simd::Min(_alg.half + 1, _param.height);
-            _alg.body = Simd::Max<ptrdiff_t>(_param.height - _alg.half, 1);
+            _alg.edge = AlignHi(_alg.half * pixel, _param.align);
+            _alg.start = _alg.edge - _alg.half * pixel;
 
-            _cols.Resize(_alg.size + 2 * _alg.edge, true);
-            _rows.Resize(_alg.kernel * _alg.stride);
+            _colsSize = AlignHi(_param.width * pixel, _param.align) + 2 * _alg.edge;
+            _rowsSize = _alg.kernel * _alg.stride;
+            _cols.Resize(_colsSize * _threads, true);
+            _rows.Resize(_rowsSize * _threads);
 
-            switch (_param.channels)
+            switch (_param.Channel())
             {
-            case 1: _blur = GetBlurDefaultPtr<1>(_param, _alg); break;
-            case 2: _blur = GetBlurDefaultPtr<2>(_param, _alg); break;
-            case 3: _blur = GetBlurDefaultPtr<3>(_param, _alg); break;
-            case 4: _blur = GetBlurDefaultPtr<4>(_param, _alg); break;
+            case SimdGaussianBlurChannelByte: _blur = GetBlurDefaultPtr<uint8_t>(_param, _alg); break;
+            case SimdGaussianBlurChannelShort: _blur = GetBlurDefaultPtr<uint16_t>(_param, _alg); break;
+            case SimdGaussianBlurChannelFloat: _blur = GetBlurDefaultPtr<float>(_param, _alg); break;
+            default: _blur = NULL;
             }
         }
 
@@ -241,19 +215,116 @@ namespace Simd
             if (_alg.half == 0)
             {
                 if (src != dst)
-                    Copy(src, srcStride, _param.width, _param.height, _param.channels, dst, dstStride);
+                    Copy(src, srcStride, _param.width, _param.height, _param.channels * _param.ChannelSize(), dst, dstStride);
             }
             else
-                _blur(_param, _alg, src, srcStride, _cols.data + _alg.start, _rows.data, dst, dstStride);
+            {
+                Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+                {
+                    _blur(_param, _alg, begin, end, src, srcStride, _cols.data + thread * _colsSize + _alg.start, 
+                        _rows.data + thread * _rowsSize, dst, dstStride);
+                }, _threads, _alg.kernel);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<class T> void RecursiveRows(const BlurParam& p, const AlgRecursive& a, size_t xBeg, size_t xEnd, float* buf, uint8_t* dst, size_t dstStride)
+        {
+            for (size_t y = 0; y < p.height; ++y)
+            {
+                const float* p1 = buf + (y > 0 ? y - 1 : 0) * a.stride;
+                const float* p2 = buf + (y > 1 ? y - 2 : 0) * a.stride;
+                const float* p3 = buf + (y > 2 ? y - 3 : 0) * a.stride;
+                float* pb = buf + y * a.stride;
+                for (size_t x = xBeg; x < xEnd; ++x)
+                    pb[x] = a.b * pb[x] + a.a1 * p1[x] + a.a2 * p2[x] + a.a3 * p3[x];
+            }
+            for (ptrdiff_t y = p.height - 1, last = y; y >= 0; --y)
+            {
+                const float* n1 = buf + Simd::Min(y + 1, last) * a.stride;
+                const float* n2 = buf + Simd::Min(y + 2, last) * a.stride;
+                const float* n3 = buf + Simd::Min(y + 3, last) * a.stride;
+                float* pb = buf + y * a.stride;
+                T* pd = (T*)(dst + y * dstStride);
+                for (size_t x = xBeg; x < xEnd; ++x)
+                {
+                    pb[x] = a.b * pb[x] + a.a1 * n1[x] + a.a2 * n2[x] + a.a3 * n3[x];
+                    pd[x] = BlurCast<T>(pb[x]);
+                }
+            }
+        }
+
+        template<class T> Base::RecursiveColsPtr GetRecursiveColsPtr(const BlurParam& p)
+        {
+            switch (p.channels)
+            {
+            case 1: return RecursiveCols<T, 1>;
+            case 2: return RecursiveCols<T, 2>;
+            case 3: return RecursiveCols<T, 3>;
+            case 4: return RecursiveCols<T, 4>;
+            default: return NULL;
+            }
+        }
+
+        GaussianBlurRecursive::GaussianBlurRecursive(const BlurParam& param)
+            : Simd::GaussianBlur(param)
+        {
+            double s = _param.sigma, q = s >= 2.5 ? 0.98711 * s - 0.96330 : 3.97156 - 4.14554 * ::sqrt(1.0 - 0.26891 * s);
+            double b0 = 1.57825 + 2.44413 * q + 1.4281 * q * q + 0.422205 * q * q * q;
+            double b1 = 2.44413 * q + 2.85619 * q * q + 1.26661 * q * q * q;
+            double b2 = -(1.4281 * q * q + 1.26661 * q * q * q);
+            double b3 = 0.422205 * q * q * q;
+            _alg.a1 = float(b1 / b0);
+            _alg.a2 = float(b2 / b0);
+            _alg.a3 = float(b3 / b0);
+            _alg.b = 1.0f - (_alg.a1 + _alg.a2 + _alg.a3);
+            _alg.size = _param.width * _param.channels;
+            _alg.stride = AlignHi(_alg.size, _param.align / sizeof(float));
+            _buf.Resize(_alg.stride * _param.height);
+
+            switch (_param.Channel())
+            {
+            case SimdGaussianBlurChannelByte:
+                _blurCols = GetRecursiveColsPtr<uint8_t>(_param);
+                _blurRows = RecursiveRows<uint8_t>;
+                break;
+            case SimdGaussianBlurChannelShort:
+                _blurCols = GetRecursiveColsPtr<uint16_t>(_param);
+                _blurRows = RecursiveRows<uint16_t>;
+                break;
+            case SimdGaussianBlurChannelFloat:
+                _blurCols = GetRecursiveColsPtr<float>(_param);
+                _blurRows = RecursiveRows<float>;
+                break;
+            default:
+                _blurCols = NULL;
+                _blurRows = NULL;
+            }
+        }
+
+        void GaussianBlurRecursive::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            float* buf = _buf.data;
+            Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                _blurCols(_param, _alg, begin, end, src, srcStride, buf);
+            }, _threads, 1);
+            Simd::Parallel(0, _alg.size, [&](size_t thread, size_t begin, size_t end)
+            {
+                _blurRows(_param, _alg, begin, end, buf, dst, dstStride);
+            }, _threads, _param.align);
         }
 
         //---------------------------------------------------------------------
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags)
         {
-            BlurParam param(width, height, channels, sigma, epsilon, sizeof(void*));
+            BlurParam param(width, height, channels, sigma, epsilon, flags, sizeof(void*));
             if (!param.Valid())
                 return NULL;
+            if (param.IsRecursive())
+                return new GaussianBlurRecursive(param);
             return new GaussianBlurDefault(param);
         }
 
@@ -23,6 +23,11 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdCompare.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdHistogram.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -208,5 +213,101 @@ namespace Simd
 
             ChangeColors(src, srcStride, width, height, colors, dst, dstStride);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void AdaptiveHistogramLut(const uint8_t* src, size_t srcStride, size_t width, size_t height, float clipLimit, float* lut)
+        {
+            uint32_t histogram[HISTOGRAM_SIZE];
+            Histogram(src, width, height, srcStride, histogram);
+            size_t area = width * height;
+            if (clipLimit > 0.0f)
+            {
+                uint32_t clip = Simd::Max(uint32_t(clipLimit * area / HISTOGRAM_SIZE), uint32_t(1)), excess = 0;
+                for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+                {
+                    if (histogram[i] > clip)
+                    {
+                        excess += histogram[i] - clip;
+                        histogram[i] = clip;
+                    }
+                }
+                uint32_t batch = excess / HISTOGRAM_SIZE, residual = excess - batch * HISTOGRAM_SIZE;
+                for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+                    histogram[i] += batch;
+                if (residual)
+                {
+                    size_t step = Simd::Max<size_t>(HISTOGRAM_SIZE / residual, 1);
+                    for (size_t i = 0; i < HISTOGRAM_SIZE && residual > 0; i += step, residual--)
+                        histogram[i]++;
+                }
+            }
+            float scale = 255.0f / float(area);
+            for (size_t i = 0, sum = 0; i < HISTOGRAM_SIZE; ++i)
+            {
+                sum += histogram[i];
+                lut[i] = (float)Simd::Min(Round(float(sum) * scale), 255);
+            }
+        }
+
+        void AdaptiveHistogramLuts(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t tilesX, size_t tilesY, float clipLimit, float* luts)
+        {
+            Simd::Parallel(0, tilesY, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t ty = begin; ty < end; ++ty)
+                {
+                    size_t y0 = ty * height / tilesY, y1 = (ty + 1) * height / tilesY;
+                    for (size_t tx = 0; tx < tilesX; ++tx)
+                    {
+                        size_t x0 = tx * width / tilesX, x1 = (tx + 1) * width / tilesX;
+                        AdaptiveHistogramLut(src + y0 * srcStride + x0, srcStride, x1 - x0, y1 - y0, clipLimit, luts + (ty * tilesX + tx) * HISTOGRAM_SIZE);
+                    }
+                }
+            }, GetThreadNumber());
+        }
+
+        void AdaptiveHistogramCols(size_t width, size_t tilesX, int32_t* index0, int32_t* index1, float* weight)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                float pos = float(x) * float(tilesX) / float(width) - 0.5f;
+                ptrdiff_t tile = (ptrdiff_t)::floor(pos);
+                weight[x] = pos - float(tile);
+                index0[x] = int32_t(Simd::Max<ptrdiff_t>(tile, 0) * HISTOGRAM_SIZE);
+                index1[x] = int32_t(Simd::Min<ptrdiff_t>(tile + 1, tilesX - 1) * HISTOGRAM_SIZE);
+            }
+        }
+
+        void NormalizeHistogramAdaptive(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t tilesX, size_t tilesY, float clipLimit, uint8_t* dst, size_t dstStride)
+        {
+            assert(tilesX >= 1 && tilesY >= 1 && tilesX <= width && tilesY <= height);
+            Array32f luts(tilesX * tilesY * HISTOGRAM_SIZE), weights(width);
+            Array32i indices(2 * width);
+            AdaptiveHistogramLuts(src, srcStride, width, height, tilesX, tilesY, clipLimit, luts.data);
+            AdaptiveHistogramCols(width, tilesX, indices.data, indices.data + width, weights.data);
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                const int32_t* i0 = indices.data, * i1 = indices.data + width;
+                for (size_t y = begin; y < end; ++y)
+                {
+                    size_t offset0, offset1;
+                    float wy;
+                    AdaptiveHistogramRow(y, height, tilesY, tilesX, offset0, offset1, wy);
+                    const float* lut0 = luts.data + offset0, * lut1 = luts.data + offset1;
+                    const uint8_t* ps = src + y * srcStride;
+                    uint8_t* pd = dst + y * dstStride;
+                    for (size_t x = 0; x < width; ++x)
+                    {
+                        int v = ps[x];
+                        float wx = weights[x];
+                        float r0 = lut0[i0[x] + v] * (1.0f - wx) + lut0[i1[x] + v] * wx;
+                        float r1 = lut1[i0[x] + v] * (1.0f - wx) + lut1[i1[x] + v] * wx;
+                        pd[x] = uint8_t(r0 * (1.0f - wy) + r1 * wy + 0.5f);
+                    }
+                }
+            }, GetThreadNumber());
+        }
     }
 }
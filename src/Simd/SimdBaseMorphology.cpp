@@ -0,0 +1,372 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        struct MorphRun
+        {
+            ptrdiff_t offset;
+            size_t length;
+            std::vector<ptrdiff_t> dy;
+        };
+
+        typedef std::vector<MorphRun> MorphRuns;
+
+        static void MorphologyRuns(SimdMorphologyShape shape, size_t kernelX, size_t kernelY, MorphRuns& runs)
+        {
+            const ptrdiff_t ax = kernelX / 2, ay = kernelY / 2;
+            const int r = int(kernelY / 2), c = int(kernelX / 2);
+            const double invR2 = r ? 1.0 / (double(r) * r) : 0.0;
+            runs.clear();
+            for (ptrdiff_t i = 0; i < (ptrdiff_t)kernelY; ++i)
+            {
+                ptrdiff_t j1 = 0, j2 = 0;
+                if (shape == SimdMorphologyRect || (shape == SimdMorphologyCross && i == ay))
+                    j2 = kernelX;
+                else if (shape == SimdMorphologyCross)
+                    j1 = ax, j2 = ax + 1;
+                else
+                {
+                    int dy = int(i) - r;
+                    if (dy >= -r && dy <= r)
+                    {
+                        int dx = int(c * ::sqrt((r * r - dy * dy) * invR2) + 0.5);
+                        j1 = Simd::Max(c - dx, 0);
+                        j2 = Simd::Min(c + dx + 1, (int)kernelX);
+                    }
+                }
+                if (j2 <= j1)
+                    continue;
+                size_t k = 0;
+                while (k < runs.size() && (runs[k].offset != j1 - ax || runs[k].length != size_t(j2 - j1)))
+                    k++;
+                if (k == runs.size())
+                {
+                    runs.push_back(MorphRun());
+                    runs[k].offset = j1 - ax;
+                    runs[k].length = j2 - j1;
+                }
+                runs[k].dy.push_back(i - ay);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void MorphologyVertical(MorphRowPtr op, uint8_t neutral, const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            ptrdiff_t offset, size_t length, uint8_t* dst, size_t dstStride)
+        {
+            Simd::Parallel(0, height, [&](size_t thread, size_t yBeg, size_t yEnd)
+            {
+                Array8u buf((length + 2) * width);
+                uint8_t* hist = buf.data, * gain = hist + length * width, * empty = gain + width;
+                memset(empty, neutral, width);
+                for (ptrdiff_t b = yBeg + offset, e = yEnd + offset; b < e; b += length)
+                {
+                    const uint8_t* prev = empty;
+                    for (ptrdiff_t s = b + length - 1; s >= b; --s)
+                    {
+                        const uint8_t* row = s >= 0 && s < (ptrdiff_t)height ? src + s * srcStride : empty;
+                        op(row, prev, hist + (s - b) * width, width);
+                        prev = hist + (s - b) * width;
+                    }
+                    for (ptrdiff_t s = b, n = Simd::Min<ptrdiff_t>(b + length, e); s < n; ++s)
+                    {
+                        uint8_t* pd = dst + (s - offset) * dstStride;
+                        ptrdiff_t g = s + length - 1;
+                        const uint8_t* row = g >= 0 && g < (ptrdiff_t)height ? src + g * srcStride : empty;
+                        if (s == b)
+                            memcpy(pd, hist, width);
+                        else
+                        {
+                            op(s == b + 1 ? empty : gain, row, gain, width);
+                            op(hist + (s - b) * width, gain, pd, width);
+                        }
+                    }
+                }
+            }, GetThreadNumber(), length);
+        }
+
+        static void MorphologyTranspose(MorphTransposePtr transpose, const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride)
+        {
+            Simd::Parallel(0, height, [&](size_t thread, size_t yBeg, size_t yEnd)
+            {
+                transpose(src + yBeg * srcStride, srcStride, width, yEnd - yBeg, dst + yBeg, dstStride);
+            }, GetThreadNumber(), 16);
+        }
+
+        static void MorphologyRows(MorphRowPtr op, const uint8_t* a, size_t aStride, const uint8_t* b, size_t bStride, size_t width, size_t height, uint8_t* dst, size_t dstStride)
+        {
+            Simd::Parallel(0, height, [&](size_t thread, size_t yBeg, size_t yEnd)
+            {
+                for (size_t y = yBeg; y < yEnd; ++y)
+                    op(a + y * aStride, b + y * bStride, dst + y * dstStride, width);
+            }, GetThreadNumber());
+        }
+
+        static void MorphologyGray(const MorphOps& ops, bool erode, const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t* dst, size_t dstStride)
+        {
+            MorphRowPtr op = erode ? ops.min : ops.max;
+            uint8_t neutral = erode ? 0xFF : 0x00;
+            ptrdiff_t ax = kernelX / 2, ay = kernelY / 2;
+            Array8u buf0(width * height), buf1(width * height);
+            if (shape == SimdMorphologyRect)
+            {
+                MorphologyVertical(op, neutral, src, srcStride, width, height, -ay, kernelY, buf0.data, width);
+                MorphologyTranspose(ops.transpose, buf0.data, width, width, height, buf1.data, height);
+                MorphologyVertical(op, neutral, buf1.data, height, height, width, -ax, kernelX, buf0.data, height);
+                MorphologyTranspose(ops.transpose, buf0.data, height, height, width, dst, dstStride);
+            }
+            else if (shape == SimdMorphologyCross)
+            {
+                Array8u buf2(width * height);
+                MorphologyVertical(op, neutral, src, srcStride, width, height, -ay, kernelY, buf2.data, width);
+                MorphologyTranspose(ops.transpose, src, srcStride, width, height, buf1.data, height);
+                MorphologyVertical(op, neutral, buf1.data, height, height, width, -ax, kernelX, buf0.data, height);
+                MorphologyTranspose(ops.transpose, buf0.data, height, height, width, dst, dstStride);
+                MorphologyRows(op, dst, dstStride, buf2.data, width, width, height, dst, dstStride);
+            }
+            else
+            {
+                MorphRuns runs;
+                MorphologyRuns(shape, kernelX, kernelY, runs);
+                Array8u buf2(width * height);
+                memset(buf2.data, neutral, buf2.size);
+                MorphologyTranspose(ops.transpose, src, srcStride, width, height, buf1.data, height);
+                for (size_t r = 0; r < runs.size(); ++r)
+                {
+                    MorphologyVertical(op, neutral, buf1.data, height, height, width, runs[r].offset, runs[r].length, buf0.data, height);
+                    for (size_t i = 0; i < runs[r].dy.size(); ++i)
+                    {
+                        ptrdiff_t dy = runs[r].dy[i];
+                        size_t beg = Simd::Max<ptrdiff_t>(0, -dy), end = Simd::Min<ptrdiff_t>(height, height - dy);
+                        if (beg < end)
+                            MorphologyRows(op, buf2.data + beg, height, buf0.data + beg + dy, height, end - beg, width, buf2.data + beg, height);
+                    }
+                }
+                MorphologyTranspose(ops.transpose, buf2.data, height, height, width, dst, dstStride);
+            }
+        }
+
+        void Morphology(const MorphOps& ops, const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t* dst, size_t dstStride)
+        {
+            assert(kernelX >= 1 && kernelY >= 1);
+            if (type == SimdMorphologyErode || type == SimdMorphologyDilate)
+                MorphologyGray(ops, type == SimdMorphologyErode, src, srcStride, width, height, shape, kernelX, kernelY, dst, dstStride);
+            else
+            {
+                Array8u buf(width * height);
+                MorphologyGray(ops, type == SimdMorphologyOpen, src, srcStride, width, height, shape, kernelX, kernelY, buf.data, width);
+                MorphologyGray(ops, type != SimdMorphologyOpen, buf.data, width, width, height, shape, kernelX, kernelY, dst, dstStride);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE uint64_t MorphWord(const uint64_t* src, ptrdiff_t index, ptrdiff_t beg, ptrdiff_t end, uint64_t neutral)
+        {
+            return index >= beg && index < end ? src[index] : neutral;
+        }
+
+        SIMD_INLINE uint64_t MorphShifted(const uint64_t* src, ptrdiff_t index, ptrdiff_t shift, ptrdiff_t beg, ptrdiff_t end, uint64_t neutral)
+        {
+            ptrdiff_t words = shift >= 0 ? shift / 64 : -((63 - shift) / 64), bits = shift - words * 64;
+            uint64_t lo = MorphWord(src, index + words, beg, end, neutral);
+            return bits ? (lo >> bits) | (MorphWord(src, index + words + 1, beg, end, neutral) << (64 - bits)) : lo;
+        }
+
+        SIMD_INLINE uint64_t MorphOp(bool erode, uint64_t a, uint64_t b)
+        {
+            return erode ? a & b : a | b;
+        }
+
+        static void MorphologyHorizontalBits(bool erode, const uint8_t* src, size_t width, ptrdiff_t offset, size_t length, size_t margin, uint64_t* buf, uint8_t* dst)
+        {
+            const uint64_t neutral = erode ? uint64_t(-1) : 0;
+            const ptrdiff_t beg = -(ptrdiff_t)margin, end = DivHi(width, 64);
+            uint64_t* cur = buf + margin, * res = cur + end;
+            for (ptrdiff_t i = beg; i < end; ++i)
+                cur[i] = neutral;
+            memcpy(cur, src, DivHi(width, 8));
+            if (width & 63)
+            {
+                uint64_t tail = uint64_t(-1) << (width & 63);
+                cur[end - 1] = erode ? cur[end - 1] | tail : cur[end - 1] & ~tail;
+            }
+            for (ptrdiff_t i = 0; i < end; ++i)
+                res[i] = neutral;
+            for (size_t rest = length, len = 1; rest; rest >>= 1)
+            {
+                if (rest & 1)
+                {
+                    for (ptrdiff_t i = 0; i < end; ++i)
+                        res[i] = MorphOp(erode, res[i], MorphShifted(cur, i, offset, beg, end, neutral));
+                    offset += len;
+                }
+                if (rest > 1)
+                {
+                    for (ptrdiff_t i = beg; i < end; ++i)
+                        cur[i] = MorphOp(erode, cur[i], MorphShifted(cur, i, len, beg, end, neutral));
+                    len *= 2;
+                }
+            }
+            memcpy(dst, res, DivHi(width, 8));
+        }
+
+        SIMD_INLINE void MorphologyClearTail(uint8_t* dst, size_t width)
+        {
+            if (width & 7)
+                dst[width / 8] &= uint8_t((1 << (width & 7)) - 1);
+        }
+
+        static void MorphologyMask(const MorphOps& ops, bool erode, const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t* dst, size_t dstStride)
+        {
+            MorphRowPtr op = erode ? ops.and_ : ops.or_;
+            uint8_t neutral = erode ? 0xFF : 0x00;
+            ptrdiff_t ax = kernelX / 2, ay = kernelY / 2;
+            size_t bytes = DivHi(width, 8), words = DivHi(width, 64), margin = DivHi(kernelX, 64) + 1;
+            if (shape == SimdMorphologyRect)
+            {
+                Array8u buf(bytes * height);
+                MorphologyVertical(op, neutral, src, srcStride, bytes, height, -ay, kernelY, buf.data, bytes);
+                Simd::Parallel(0, height, [&](size_t thread, size_t yBeg, size_t yEnd)
+                {
+                    Array<uint64_t> line(margin + 2 * words);
+                    for (size_t y = yBeg; y < yEnd; ++y)
+                    {
+                        MorphologyHorizontalBits(erode, buf.data + y * bytes, width, -ax, kernelX, margin, line.data, dst + y * dstStride);
+                        MorphologyClearTail(dst + y * dstStride, width);
+                    }
+                }, GetThreadNumber());
+            }
+            else
+            {
+                MorphRuns runs;
+                MorphologyRuns(shape, kernelX, kernelY, runs);
+                Array8u copy;
+                if (src == dst)
+                {
+                    copy.Resize(bytes * height);
+                    for (size_t y = 0; y < height; ++y)
+                        memcpy(copy.data + y * bytes, src + y * srcStride, bytes);
+                    src = copy.data, srcStride = bytes;
+                }
+                Simd::Parallel(0, height, [&](size_t thread, size_t yBeg, size_t yEnd)
+                {
+                    Array<uint64_t> line(margin + 2 * words);
+                    Array8u part(bytes);
+                    for (size_t y = yBeg; y < yEnd; ++y)
+                    {
+                        uint8_t* pd = dst + y * dstStride;
+                        memset(pd, neutral, bytes);
+                        for (size_t r = 0; r < runs.size(); ++r)
+                        {
+                            for (size_t i = 0; i < runs[r].dy.size(); ++i)
+                            {
+                                ptrdiff_t sy = y + runs[r].dy[i];
+                                if (sy < 0 || sy >= (ptrdiff_t)height)
+                                    continue;
+                                MorphologyHorizontalBits(erode, src + sy * srcStride, width, runs[r].offset, runs[r].length, margin, line.data, part.data);
+                                op(pd, part.data, pd, bytes);
+                            }
+                        }
+                        MorphologyClearTail(pd, width);
+                    }
+                }, GetThreadNumber());
+            }
+        }
+
+        void MorphologyBits(const MorphOps& ops, const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t* dst, size_t dstStride)
+        {
+            assert(kernelX >= 1 && kernelY >= 1);
+            if (type == SimdMorphologyErode || type == SimdMorphologyDilate)
+                MorphologyMask(ops, type == SimdMorphologyErode, src, srcStride, width, height, shape, kernelX, kernelY, dst, dstStride);
+            else
+            {
+                size_t bytes = DivHi(width, 8);
+                Array8u buf(bytes * height);
+                MorphologyMask(ops, type == SimdMorphologyOpen, src, srcStride, width, height, shape, kernelX, kernelY, buf.data, bytes);
+                MorphologyMask(ops, type != SimdMorphologyOpen, buf.data, bytes, width, height, shape, kernelX, kernelY, dst, dstStride);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void MorphMin(const uint8_t* a, const uint8_t* b, uint8_t* dst, size_t size)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = Simd::Min(a[i], b[i]);
+        }
+
+        static void MorphMax(const uint8_t* a, const uint8_t* b, uint8_t* dst, size_t size)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = Simd::Max(a[i], b[i]);
+        }
+
+        static void MorphAnd(const uint8_t* a, const uint8_t* b, uint8_t* dst, size_t size)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = a[i] & b[i];
+        }
+
+        static void MorphOr(const uint8_t* a, const uint8_t* b, uint8_t* dst, size_t size)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = a[i] | b[i];
+        }
+
+        static void MorphTranspose(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride)
+        {
+            TransformImage(src, srcStride, width, height, 1, SimdTransformTransposeRotate0, dst, dstStride);
+        }
+
+        static const MorphOps MORPH_OPS = { MorphMin, MorphMax, MorphAnd, MorphOr, MorphTranspose };
+
+        void Morphology(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t* dst, size_t dstStride)
+        {
+            Morphology(MORPH_OPS, src, srcStride, width, height, type, shape, kernelX, kernelY, dst, dstStride);
+        }
+
+        void MorphologyBits(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t* dst, size_t dstStride)
+        {
+            MorphologyBits(MORPH_OPS, src, srcStride, width, height, type, shape, kernelX, kernelY, dst, dstStride);
+        }
+    }
+}
@@ -0,0 +1,395 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdRemap.h"
+#include "Simd/SimdWarpAffineCommon.h"
+#include "Simd/SimdCopy.h"
+#include "Simd/SimdBase.h"
+
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    RemapParam::RemapParam(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border)
+    {
+        this->srcW = srcW;
+        this->srcH = srcH;
+        this->srcS = srcS;
+        this->dstW = dstW;
+        this->dstH = dstH;
+        this->dstS = dstS;
+        this->channels = channels;
+        this->flags = flags;
+        memset(this->border, 0, BorderSizeMax);
+        if (border && NeedFill() && channels <= 4)
+            memcpy(this->border, border, this->PixelSize());
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        template<int N> void NearestRun(const RemapParam& p, const RemapTab& t, int yBeg, int yEnd, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                const RemapEdge* beg = t.edges + t.rows[y], * end = t.edges + t.rows[y + 1];
+                int ib = t.ib[y], ie = t.ie[y];
+                uint8_t* row = dst + y * p.dstS;
+                if (fill)
+                {
+                    FillBorder<N>(row, ib, p.border);
+                    FillBorder<N>(row + ie * N, width - ie, p.border);
+                }
+                else
+                    RemapSaveEdge<N>(beg, end, row, buf);
+                NearestGather<N>(src, (uint32_t*)t.offs + y * width + ib, ie - ib, row + ib * N);
+                RemapNearestEdge<N>(p, beg, end, buf, row);
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        template<int N> void ByteBilinearRun(const RemapParam& p, const RemapTab& t, int yBeg, int yEnd, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            constexpr int M = (N == 3 ? 4 : N);
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS;
+            uint8_t* rb0 = buf, * rb1 = rb0 + width * M * 2, * eb = rb1 + width * M * 2;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                const uint8_t* fx = t.fx + 2 * y * width;
+                const uint16_t* fy = t.fy + 2 * y * width;
+                const RemapEdge* beg = t.edges + t.rows[y], * end = t.edges + t.rows[y + 1];
+                int ib = t.ib[y], ie = t.ie[y];
+                uint8_t* row = dst + y * p.dstS;
+                if (fill)
+                {
+                    FillBorder<N>(row, ib, p.border);
+                    FillBorder<N>(row + ie * N, width - ie, p.border);
+                }
+                else
+                    RemapSaveEdge<N>(beg, end, row, eb);
+                ByteBilinearGather<M>(src, src + s, (uint32_t*)t.offs + y * width + ib, ie - ib, rb0, rb1);
+                for (int x = ib; x < ie; ++x)
+                    ByteBilinearInterpMain<N>(rb0 + (x - ib) * M * 2, rb1 + (x - ib) * M * 2, fx + 2 * x, fy + 2 * x, row + x * N);
+                ByteBilinearRemapEdge<N>(p, beg, end, fx, fy, src, eb, row);
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        template<int N> void FloatBilinearRun(const RemapParam& p, const RemapTab& t, int yBeg, int yEnd, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                const uint32_t* offs = t.offs + y * width;
+                const float* wx = t.wx + y * width;
+                const float* wy = t.wy + y * width;
+                const RemapEdge* beg = t.edges + t.rows[y], * end = t.edges + t.rows[y + 1];
+                int ib = t.ib[y], ie = t.ie[y];
+                uint8_t* row = dst + y * p.dstS;
+                if (fill)
+                {
+                    FillBorder<N * 4>(row, ib, p.border);
+                    FillBorder<N * 4>(row + ie * N * 4, width - ie, p.border);
+                }
+                else
+                    RemapSaveEdge<N * 4>(beg, end, row, buf);
+                for (int x = ib; x < ie; ++x)
+                {
+                    const uint8_t* src0 = src + offs[x];
+                    FloatBilinearInterpMain<N>((float*)src0, (float*)(src0 + s), wx[x], wy[x], (float*)row + x * N);
+                }
+                FloatBilinearRemapEdge<N>(p, beg, end, wx, wy, src, buf, row);
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        Remap::Remap(const RemapParam& param)
+            : _param(param)
+            , _threads(Base::GetThreadNumber())
+            , _size(0)
+            , _run(NULL)
+        {
+            if (_param.IsNearest())
+            {
+                switch (_param.PixelSize())
+                {
+                case 1: _run = NearestRun<1>; break;
+                case 2: _run = NearestRun<2>; break;
+                case 3: _run = NearestRun<3>; break;
+                case 4: _run = NearestRun<4>; break;
+                case 8: _run = NearestRun<8>; break;
+                case 12: _run = NearestRun<12>; break;
+                case 16: _run = NearestRun<16>; break;
+                }
+            }
+            else if (_param.IsFloat())
+            {
+                switch (_param.channels)
+                {
+                case 1: _run = FloatBilinearRun<1>; break;
+                case 2: _run = FloatBilinearRun<2>; break;
+                case 3: _run = FloatBilinearRun<3>; break;
+                case 4: _run = FloatBilinearRun<4>; break;
+                }
+            }
+            else
+            {
+                switch (_param.channels)
+                {
+                case 1: _run = ByteBilinearRun<1>; break;
+                case 2: _run = ByteBilinearRun<2>; break;
+                case 3: _run = ByteBilinearRun<3>; break;
+                case 4: _run = ByteBilinearRun<4>; break;
+                }
+            }
+        }
+
+        bool Remap::SetMap(const void* map, SimdTensorDataType type)
+        {
+            const RemapParam& p = _param;
+            if (map == NULL || (type != SimdTensorData32f && type != SimdTensorData32i))
+                return false;
+            Reserve();
+            Array32f buf(p.dstW * 2);
+            for (size_t y = 0; y < p.dstH; ++y)
+            {
+                if (type == SimdTensorData32f)
+                    SetRow(y, (const float*)map + y * p.dstW * 2);
+                else
+                {
+                    const int32_t* fixed = (const int32_t*)map + y * p.dstW * 2;
+                    for (size_t i = 0; i < buf.size; ++i)
+                        buf[i] = float(double(fixed[i]) / 65536.0);
+                    SetRow(y, buf.data);
+                }
+            }
+            SetTab();
+            return true;
+        }
+
+        bool Remap::SetPerspective(const float* mat)
+        {
+            const RemapParam& p = _param;
+            double m[9], inv[9];
+            for (int i = 0; i < 9; ++i)
+                m[i] = mat[i];
+            double det = m[0] * (m[4] * m[8] - m[5] * m[7]) - m[1] * (m[3] * m[8] - m[5] * m[6]) + m[2] * (m[3] * m[7] - m[4] * m[6]);
+            if (det == 0.0)
+                return false;
+            det = 1.0 / det;
+            inv[0] = (m[4] * m[8] - m[5] * m[7]) * det;
+            inv[1] = (m[2] * m[7] - m[1] * m[8]) * det;
+            inv[2] = (m[1] * m[5] - m[2] * m[4]) * det;
+            inv[3] = (m[5] * m[6] - m[3] * m[8]) * det;
+            inv[4] = (m[0] * m[8] - m[2] * m[6]) * det;
+            inv[5] = (m[2] * m[3] - m[0] * m[5]) * det;
+            inv[6] = (m[3] * m[7] - m[4] * m[6]) * det;
+            inv[7] = (m[1] * m[6] - m[0] * m[7]) * det;
+            inv[8] = (m[0] * m[4] - m[1] * m[3]) * det;
+            Reserve();
+            Array32f buf(p.dstW * 2);
+            for (size_t y = 0; y < p.dstH; ++y)
+            {
+                for (size_t x = 0; x < p.dstW; ++x)
+                {
+                    double sx = double(x), sy = double(y);
+                    double X = sx * inv[0] + sy * inv[1] + inv[2];
+                    double Y = sx * inv[3] + sy * inv[4] + inv[5];
+                    double W = sx * inv[6] + sy * inv[7] + inv[8];
+                    buf[2 * x + 0] = W != 0.0 ? float(X / W) : -1.0f;
+                    buf[2 * x + 1] = W != 0.0 ? float(Y / W) : -1.0f;
+                }
+                SetRow(y, buf.data);
+            }
+            SetTab();
+            return true;
+        }
+
+        void Remap::Run(const uint8_t* src, uint8_t* dst)
+        {
+            Simd::Parallel(0, _param.dstH, [&](size_t thread, size_t begin, size_t end)
+            {
+                _run(_param, _tab, (int)begin, (int)end, src, dst, _buf.data + thread * _size);
+            }, _threads, 1);
+        }
+
+        void Remap::Reserve()
+        {
+            const RemapParam& p = _param;
+            size_t size = p.dstW * p.dstH;
+            _offs.Resize(size);
+            _rows.Resize(p.dstH + 1);
+            _rows[0] = 0;
+            _ib.Resize(p.dstH);
+            _ie.Resize(p.dstH);
+            if (!p.IsNearest())
+            {
+                if (p.IsFloat())
+                {
+                    _wx.Resize(size);
+                    _wy.Resize(size);
+                }
+                else
+                {
+                    _fx.Resize(size * 2);
+                    _fy.Resize(size * 2);
+                }
+            }
+            _edges.clear();
+        }
+
+        void Remap::SetRow(size_t y, const float* map)
+        {
+            const RemapParam& p = _param;
+            int w = (int)p.srcW, h = (int)p.srcH, s = (int)p.srcS, n = (int)p.PixelSize();
+            int last = (h - 1) * s + w * n, ib = (int)p.dstW, ie = 0;
+            float fw = (float)w, fh = (float)h;
+            size_t o = y * p.dstW;
+            _cand.clear();
+            for (size_t x = 0; x < p.dstW; ++x, map += 2, ++o)
+            {
+                float sx = map[0], sy = map[1];
+                bool inside = sx > -1.0f && sx < fw && sy > -1.0f && sy < fh;
+                int ix, iy, offs;
+                bool main;
+                if (p.IsNearest())
+                {
+                    ix = inside ? Round(sx) : -1;
+                    iy = inside ? Round(sy) : -1;
+                    offs = iy * s + ix * n;
+                    main = ix >= 0 && ix < w && iy >= 0 && iy < h;
+                }
+                else
+                {
+                    ix = -2;
+                    iy = -2;
+                    float dx = 0.0f, dy = 0.0f;
+                    if (inside)
+                    {
+                        ix = (int)floor(sx);
+                        iy = (int)floor(sy);
+                        dx = sx - (float)ix;
+                        dy = sy - (float)iy;
+                    }
+                    offs = iy * s + ix * n;
+                    main = ix >= 0 && iy >= 0 && ix + 1 < w && iy + 1 < h;
+                    if (p.IsFloat())
+                    {
+                        _wx[o] = dx;
+                        _wy[o] = dy;
+                    }
+                    else
+                    {
+                        int fx = Round(dx * WA_FRACTION_RANGE);
+                        int fy = Round(dy * WA_FRACTION_RANGE);
+                        _fx[2 * o + 0] = WA_FRACTION_RANGE - fx;
+                        _fx[2 * o + 1] = fx;
+                        _fy[2 * o + 0] = WA_FRACTION_RANGE - fy;
+                        _fy[2 * o + 1] = fy;
+                        if (n == 3 && main)
+                            main = offs + s + 8 <= last;
+                    }
+                }
+                if (main)
+                {
+                    _offs[o] = offs;
+                    ib = Simd::Min(ib, (int)x);
+                    ie = (int)x + 1;
+                }
+                else
+                {
+                    _offs[o] = 0;
+                    _cand.push_back(RemapEdge({ (int32_t)x, ix, iy }));
+                }
+            }
+            if (ib > ie)
+                ib = ie = 0;
+            for (size_t i = 0; i < _cand.size(); ++i)
+            {
+                const RemapEdge& e = _cand[i];
+                bool partial = !p.IsNearest() && e.ix + 1 >= 0 && e.ix < w && e.iy + 1 >= 0 && e.iy < h;
+                if (partial || (e.x >= ib && e.x < ie))
+                    _edges.push_back(e);
+            }
+            _ib[y] = ib;
+            _ie[y] = ie;
+            _rows[y + 1] = (uint32_t)_edges.size();
+        }
+
+        void Remap::SetTab()
+        {
+            const RemapParam& p = _param;
+            _tab.offs = _offs.data;
+            _tab.fx = _fx.data;
+            _tab.fy = _fy.data;
+            _tab.wx = _wx.data;
+            _tab.wy = _wy.data;
+            _tab.edges = _edges.data();
+            _tab.rows = _rows.data;
+            _tab.ib = _ib.data;
+            _tab.ie = _ie.data;
+            _size = AlignHi(p.dstW * (16 + p.PixelSize()), SIMD_ALIGN) + SIMD_ALIGN;
+            _buf.Resize(_size * _threads);
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const void* map, SimdTensorDataType mapType, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border);
+            if (!param.Valid())
+                return NULL;
+            Remap* remap = new Remap(param);
+            if (!remap->SetMap(map, mapType))
+            {
+                delete remap;
+                return NULL;
+            }
+            return remap;
+        }
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border);
+            if (!param.Valid() || mat == NULL)
+                return NULL;
+            Remap* remap = new Remap(param);
+            if (!remap->SetPerspective(mat))
+            {
+                delete remap;
+                return NULL;
+            }
+            return remap;
+        }
+    }
+}
@@ -0,0 +1,391 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetCalibration.h"
+#include "Simd/SimdSynetQuantizeLinear.h"
+#include "Simd/SimdMath.h"
+
+#include <float.h>
+#include <vector>
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        void SynetCalibrationMinMax(const float* src, size_t channels, size_t spatial, SimdTensorFormatType format, float* min, float* max)
+        {
+            if (format == SimdTensorFormatNchw)
+            {
+                for (size_t c = 0; c < channels; ++c, src += spatial)
+                {
+                    float _min = min[c], _max = max[c];
+                    for (size_t s = 0; s < spatial; ++s)
+                    {
+                        _min = Simd::Min(_min, src[s]);
+                        _max = Simd::Max(_max, src[s]);
+                    }
+                    min[c] = _min, max[c] = _max;
+                }
+            }
+            else
+            {
+                for (size_t s = 0; s < spatial; ++s, src += channels)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        min[c] = Simd::Min(min[c], src[c]);
+                        max[c] = Simd::Max(max[c], src[c]);
+                    }
+                }
+            }
+        }
+
+        void SynetCalibrationHistogram(const float* src, size_t size, float norm, float shift, size_t bins, uint32_t* hist)
+        {
+            float top = float(bins - 1);
+            for (size_t i = 0; i < size; ++i)
+                hist[(int)Simd::Min(Simd::Max((src[i] + shift) * norm, 0.0f), top)]++;
+        }
+
+        void SynetCalibrationHistogramNhwc(const float* src, size_t spatial, size_t channels, const float* norm, const float* shift, size_t bins, uint32_t* hist)
+        {
+            float top = float(bins - 1);
+            for (size_t s = 0; s < spatial; ++s, src += channels)
+                for (size_t c = 0; c < channels; ++c)
+                    hist[c * bins + (int)Simd::Min(Simd::Max((src[c] + shift[c]) * norm[c], 0.0f), top)]++;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetCalibration::SynetCalibration(const SynetCalibrationParam& p)
+            : _param(p)
+        {
+            _count = p.perChannel ? p.channels : 1;
+            _min.Resize(p.channels);
+            _max.Resize(p.channels);
+            _bMin.Resize(p.channels);
+            _bMax.Resize(p.channels);
+            for (size_t c = 0; c < p.channels; ++c)
+                _min[c] = FLT_MAX, _max[c] = -FLT_MAX;
+            _range.Resize(_count, true);
+            _norm.Resize(_count, true);
+            _shift.Resize(_count, true);
+            _hist.Resize(_count * p.bins, true);
+            _minMax = SynetCalibrationMinMax;
+            _histogram = SynetCalibrationHistogram;
+            _histogramNhwc = SynetCalibrationHistogramNhwc;
+        }
+
+        void SynetCalibration::Update(const float* src, size_t batch, size_t spatial)
+        {
+            const SynetCalibrationParam& p = _param;
+            size_t size = p.channels * spatial;
+            if (size == 0 || batch == 0)
+                return;
+            for (size_t c = 0; c < p.channels; ++c)
+                _bMin[c] = FLT_MAX, _bMax[c] = -FLT_MAX;
+            for (size_t b = 0; b < batch; ++b)
+                _minMax(src + b * size, p.channels, spatial, p.format, _bMin.data, _bMax.data);
+            float absMax = 0.0f;
+            for (size_t c = 0; c < p.channels; ++c)
+            {
+                _min[c] = Simd::Min(_min[c], _bMin[c]);
+                _max[c] = Simd::Max(_max[c], _bMax[c]);
+                absMax = Simd::Max(absMax, Simd::Max(::fabs(_bMin[c]), ::fabs(_bMax[c])));
+                if (p.perChannel)
+                    Expand(c, Simd::Max(::fabs(_bMin[c]), ::fabs(_bMax[c])));
+            }
+            if (!p.perChannel)
+                Expand(0, absMax);
+            for (size_t b = 0; b < batch; ++b, src += size)
+            {
+                if (!p.perChannel)
+                    _histogram(src, size, _norm[0], _shift[0], p.bins, _hist.data);
+                else if (p.format == SimdTensorFormatNchw)
+                {
+                    for (size_t c = 0; c < p.channels; ++c)
+                        _histogram(src + c * spatial, spatial, _norm[c], _shift[c], p.bins, _hist.data + c * p.bins);
+                }
+                else
+                    _histogramNhwc(src, spatial, p.channels, _norm.data, _shift.data, p.bins, _hist.data);
+            }
+        }
+
+        void SynetCalibration::Expand(size_t index, float absMax)
+        {
+            size_t bins = _param.bins, half = bins / 2;
+            float & range = _range[index];
+            if (range == 0.0f)
+                range = Simd::Max(absMax, FLT_EPSILON);
+            else if (absMax > range)
+            {
+                uint32_t* hist = _hist.data + index * bins;
+                Array32u buf(bins);
+                while (absMax > range)
+                {
+                    buf.Clear();
+                    for (size_t i = 0; i < bins; ++i)
+                        buf[(half + i) / 2] += hist[i];
+                    memcpy(hist, buf.data, bins * sizeof(uint32_t));
+                    range *= 2.0f;
+                }
+            }
+            _norm[index] = float(half) / range;
+            _shift[index] = range;
+        }
+
+        void SynetCalibration::GetMinMax(float* min, float* max) const
+        {
+            for (size_t c = 0; c < _param.channels; ++c)
+            {
+                if (min)
+                    min[c] = _min[c];
+                if (max)
+                    max[c] = _max[c];
+            }
+        }
+
+        bool SynetCalibration::GetHistogram(size_t index, float* range, uint32_t* hist) const
+        {
+            if (index >= _count)
+                return false;
+            if (range)
+                *range = _range[index];
+            if (hist)
+                memcpy(hist, _hist.data + index * _param.bins, _param.bins * sizeof(uint32_t));
+            return true;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void FoldHistogram(const uint32_t* hist, size_t bins, std::vector<double>& fold)
+        {
+            size_t half = bins / 2;
+            fold.assign(half, 0.0);
+            for (size_t k = 0; k < half; ++k)
+                fold[k] = double(hist[half + k]) + double(hist[half - 1 - k]);
+        }
+
+        static size_t KlThreshold(const std::vector<double>& fold, size_t levels)
+        {
+            size_t size = fold.size();
+            if (size <= levels)
+                return size;
+            double best = DBL_MAX;
+            size_t threshold = size;
+            std::vector<double> p(size), q(size);
+            for (size_t i = levels; i <= size; ++i)
+            {
+                double outliers = 0;
+                for (size_t j = i; j < size; ++j)
+                    outliers += fold[j];
+                for (size_t j = 0; j < i; ++j)
+                    p[j] = fold[j];
+                p[i - 1] += outliers;
+                double sum = 0;
+                for (size_t j = 0; j < i; ++j)
+                    sum += p[j];
+                if (sum == 0)
+                    continue;
+                for (size_t l = 0; l < levels; ++l)
+                {
+                    size_t beg = l * i / levels, end = (l + 1) * i / levels;
+                    double total = 0, nonZero = 0;
+                    for (size_t j = beg; j < end; ++j)
+                    {
+                        total += fold[j];
+                        nonZero += fold[j] != 0 ? 1 : 0;
+                    }
+                    for (size_t j = beg; j < end; ++j)
+                        q[j] = fold[j] != 0 ? total / nonZero : 0;
+                }
+                double qSum = 0;
+                for (size_t j = 0; j < i; ++j)
+                    qSum += q[j];
+                double kl = 0;
+                for (size_t j = 0; j < i; ++j)
+                {
+                    if (p[j] == 0)
+                        continue;
+                    double pj = p[j] / sum, qj = q[j] / qSum;
+                    kl += qj > 0 ? pj * ::log(pj / qj) : pj * 1e3;
+                }
+                if (kl < best)
+                {
+                    best = kl;
+                    threshold = i;
+                }
+            }
+            return threshold;
+        }
+
+        SIMD_INLINE void RangeToParams(float lo, float hi, float& scale, int32_t& zero)
+        {
+            lo = Simd::Min(lo, 0.0f);
+            hi = Simd::Max(hi, 0.0f);
+            if (hi - lo <= FLT_EPSILON)
+            {
+                scale = 1.0f;
+                zero = 0;
+                return;
+            }
+            scale = (hi - lo) / 255.0f;
+            zero = Simd::RestrictRange(NearByInt(-lo / scale), 0, 255);
+        }
+
+        static double QuantizationError(const uint32_t* hist, size_t bins, float range, float lo, float hi)
+        {
+            float scale;
+            int32_t zero;
+            RangeToParams(lo, hi, scale, zero);
+            float width = 2.0f * range / float(bins), norm = 1.0f / scale;
+            double error = 0;
+            for (size_t b = 0; b < bins; ++b)
+            {
+                if (hist[b] == 0)
+                    continue;
+                float x = -range + (float(b) + 0.5f) * width;
+                float d = x - DequantizeLinear(QuantizeLinear(x, norm, zero, 0, 255), -zero, scale);
+                error += double(hist[b]) * d * d;
+            }
+            return error;
+        }
+
+        void SynetCalibration::GetRange(size_t index, SimdSynetCalibrationMethodType method, float percentile, bool symmetric, float& lo, float& hi) const
+        {
+            size_t bins = _param.bins, half = bins / 2;
+            const uint32_t* hist = _hist.data + index * bins;
+            float min = FLT_MAX, max = -FLT_MAX;
+            if (_param.perChannel)
+                min = _min[index], max = _max[index];
+            else
+            {
+                for (size_t c = 0; c < _param.channels; ++c)
+                    min = Simd::Min(min, _min[c]), max = Simd::Max(max, _max[c]);
+            }
+            if (min > max)
+            {
+                lo = hi = 0.0f;
+                return;
+            }
+            float absMax = Simd::Max(::fabs(min), ::fabs(max));
+            float range = _range[index], width = 2.0f * range / float(bins);
+            if (symmetric)
+                min = -absMax, max = absMax;
+            lo = min, hi = max;
+            if (method == SimdSynetCalibrationMinMax)
+                return;
+            double total = 0;
+            for (size_t b = 0; b < bins; ++b)
+                total += hist[b];
+            if (method == SimdSynetCalibrationPercentile)
+            {
+                if (symmetric)
+                {
+                    std::vector<double> fold;
+                    FoldHistogram(hist, bins, fold);
+                    double cum = 0, need = percentile * total;
+                    size_t k = 0;
+                    for (; k < half - 1; ++k)
+                    {
+                        cum += fold[k];
+                        if (cum >= need)
+                            break;
+                    }
+                    float t = Simd::Min(float(k + 1) * width, absMax);
+                    lo = -t, hi = t;
+                }
+                else
+                {
+                    double cum = 0, need = (1.0 - percentile) * 0.5 * total;
+                    size_t i = 0, j = bins - 1;
+                    for (; i < bins - 1; ++i)
+                    {
+                        cum += hist[i];
+                        if (cum > need)
+                            break;
+                    }
+                    for (cum = 0; j > 0; --j)
+                    {
+                        cum += hist[j];
+                        if (cum > need)
+                            break;
+                    }
+                    lo = Simd::Max(min, -range + float(i) * width);
+                    hi = Simd::Min(max, -range + float(j + 1) * width);
+                }
+            }
+            else if (method == SimdSynetCalibrationKl)
+            {
+                std::vector<double> fold;
+                FoldHistogram(hist, bins, fold);
+                float t = Simd::Min(float(KlThreshold(fold, 128)) * width, absMax);
+                lo = Simd::Max(min, -t), hi = Simd::Min(max, t);
+            }
+            else if (method == SimdSynetCalibrationMse)
+            {
+                const size_t steps = 128;
+                double best = DBL_MAX;
+                float bLo = lo, bHi = hi;
+                for (size_t s = 1; s <= steps; ++s)
+                {
+                    float alpha = float(s) / float(steps);
+                    double error = QuantizationError(hist, bins, range, min * alpha, max * alpha);
+                    if (error < best)
+                    {
+                        best = error;
+                        bLo = min * alpha, bHi = max * alpha;
+                    }
+                }
+                lo = bLo, hi = bHi;
+            }
+        }
+
+        bool SynetCalibration::GetParams(SimdSynetCalibrationMethodType method, float percentile, SimdBool symmetric, float* scale, int32_t* zero) const
+        {
+            if (method < SimdSynetCalibrationMinMax || method > SimdSynetCalibrationMse)
+                return false;
+            if (method == SimdSynetCalibrationPercentile && (percentile <= 0.0f || percentile > 1.0f))
+                return false;
+            for (size_t i = 0; i < _count; ++i)
+            {
+                float lo, hi;
+                GetRange(i, method, percentile, symmetric == SimdTrue, lo, hi);
+                RangeToParams(lo, hi, scale[i], zero[i]);
+            }
+            return true;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetCalibrationInit(size_t channels, SimdTensorFormatType format, size_t bins, SimdBool perChannel)
+        {
+            SynetCalibrationParam param(channels, format, bins, perChannel);
+            if (!param.Valid())
+                return NULL;
+            return new SynetCalibration(param);
+        }
+    }
+#endif
+}
@@ -40,6 +40,10 @@ namespace Simd
             _convert = 0;
             _convolutions[0] = 0;
             _convolutions[1] = 0;
+            _addConvolution = 0;
+            _addActivate[0] = 0;
+            _addActivate[1] = 0;
+            _packedWeight = NULL;
         }
 
         String SynetConvolution16bNhwcGemm::Desc() const
@@ -112,55 +116,78 @@ namespace Simd
             const ConvParam& p = _param;
             const AlgParam& a = _alg;
             size_t D = DivHi(p.dstC, _alg.F);
-            _weight.Resize(a.bufK * a.bufD, true);
-            uint16_t* dst = _weight.data;
-            for (size_t d = 0; d < D; d++)
+            std::stringstream key;
+            key << Ext() << "::NhwcGemm-" << p.kernelY << "x" << p.kernelX << "x" << p.srcC << "x" << p.dstC << "-" << a.F << "-" << a.microK;
+            _packedWeight = SynetPackWeight(key.str(), weight, p.SizeW(), a.bufK * a.bufD, _weight, _sharedWeight, [&](uint16_t* dst)
             {
-                for (size_t k = 0; k < a.bufK; k += 2)
+                for (size_t d = 0; d < D; d++)
                 {
-                    const float* src = weight + k * p.dstC + d * _alg.F;
-                    for (size_t f = 0; f < _alg.F; ++f)
+                    for (size_t k = 0; k < a.bufK; k += 2)
                     {
-                        for (size_t i = 0; i < 2; ++i)
+                        const float* src = weight + k * p.dstC + d * _alg.F;
+                        for (size_t f = 0; f < _alg.F; ++f)
                         {
-                            if (d * _alg.F + f < p.dstC && k + i < a.K)
-                                *(dst++) = Float32ToBFloat16(src[i * p.dstC]);
-                            else
-                                *(dst++) = 0;
+                            for (size_t i = 0; i < 2; ++i)
+                            {
+                                if (d * _alg.F + f < p.dstC && k + i < a.K)
+                                    *(dst++) = Float32ToBFloat16(src[i * p.dstC]);
+                                else
+                                    *(dst++) = 0;
+                            }
+                            src++;
                         }
-                        src++;
                     }
                 }
-            }
+            });
         }
 
         void SynetConvolution16bNhwcGemm::Forward(const uint8_t* src, uint8_t* buf8, uint8_t* dst)
+        {
+            Forward(src, NULL, 0, buf8, dst);
+        }
+
+        bool SynetConvolution16bNhwcGemm::ForwardAdd(const uint8_t* src, const uint8_t* add, SimdTensorDataType addType, uint8_t* buf8, uint8_t* dst)
+        {
+            if (addType != SimdTensorData32f && addType != SimdTensorData16b)
+                return false;
+            if (_addConvolution == NULL || _addActivate[addType == SimdTensorData16b ? 1 : 0] == NULL)
+                return false;
+            Forward(src, add, addType == SimdTensorData16b ? 2 : 4, buf8, dst);
+            return true;
+        }
+
+        void SynetConvolution16bNhwcGemm::Forward(const uint8_t* src, const uint8_t* add, size_t addElem, uint8_t* buf8, uint8_t* dst)
         {
             const ConvParam& p = _param;
             const AlgParam& a = _alg;
             buf8 = Buffer(buf8);
             uint16_t* bufB = _convert ? Allocate<uint16_t>(buf8, a.bufM * a.bufK) : NULL;
             float* bufS = a.sumBuf ? Allocate<float>(buf8, a.macroD * a.bufM) : NULL;
+            size_t stepA = p.dstH * p.dstW * p.dstC * a.batch * addElem;
             for (size_t b = 0; b < p.batch; b += a.batch)
             {
                 uint16_t* buf = _convert ? bufB : (uint16_t*)src;
                 float* sum = a.sumBuf ? bufS : (float*)dst;
-                Forward(src, buf, sum, dst);
+                Forward(src, add, addElem, buf, sum, dst);
                 src += _stepS;
+                if (add)
+                    add += stepA;
                 dst += _stepD;
             }
         }
 
-        void SynetConvolution16bNhwcGemm::Forward(const uint8_t* src, uint16_t* buf, float* sum, uint8_t* dst)
+        void SynetConvolution16bNhwcGemm::Forward(const uint8_t* src, const uint8_t* add, size_t addElem, uint16_t* buf, float* sum, uint8_t* dst)
         {
+            static const float identity[2] = { -FLT_MAX, FLT_MAX };
             const ConvParam& p = _param;
             const AlgParam& a = _alg;
             const float* bias = _bias.data, * params = _params.data;
+            AddActivatePtr addActivate = add ? _addActivate[addElem == 2 ? 1 : 0] : NULL;
             size_t dstH = p.dstH * a.batch;
             for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
             {
                 size_t macroD = Simd::Min(p.dstC, dc + a.macroD) - dc;
-                const uint16_t* weight = _weight.data + dc * a.bufK;
+                const uint16_t* weight = _packedWeight + dc * a.bufK;
                 for (size_t mak = 0; mak < a.K; mak += a.macroK)
                 {
                     size_t macroK = Simd::Min(a.bufK, mak + a.macroK) - mak;
@@ -184,8 +211,17 @@ namespace Simd
                                 _convert(src, p, a, yBeg, yEnd, buf + bufOffs);
                         }
                         if (mak + macroK == a.bufK)
-                            _convolutions[1](buf + bufOffs, p, a, macroD, yEnd - yBeg, macroK, macroK == a.bufK ? 1 : 0,
-                                weight, bias, params, sum + sumOffs, dst + dstOffs);
+                        {
+                            if (add)
+                            {
+                                _addConvolution(buf + bufOffs, p, a, macroD, yEnd - yBeg, macroK, macroK == a.bufK ? 1 : 0,
+                                    weight, bias, identity, sum + sumOffs, dst + dstOffs);
+                                addActivate(add + yBeg * p.dstW * p.dstC * addElem, p, macroD, yEnd - yBeg, params, dst + dstOffs);
+                            }
+                            else
+                                _convolutions[1](buf + bufOffs, p, a, macroD, yEnd - yBeg, macroK, macroK == a.bufK ? 1 : 0,
+                                    weight, bias, params, sum + sumOffs, dst + dstOffs);
+                        }
                         else
                             _convolutions[0](buf + bufOffs, p, a, macroD, yEnd - yBeg, macroK, mak == 0 ? 1 : 0,
                                 weight, bias, params, sum + sumOffs, dst + dstOffs);
@@ -197,6 +233,8 @@ namespace Simd
                 if (p.activation == ::SimdConvolutionActivationPrelu)
                     params += macroD;
                 dst += macroD * _elemD;
+                if (add)
+                    add += macroD * addElem;
                 if (!a.sumBuf)
                     sum += macroD;
             }
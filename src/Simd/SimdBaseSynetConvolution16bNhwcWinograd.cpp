@@ -0,0 +1,202 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution16b.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdAlignment.h"
+#include "Simd/SimdCpu.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        SynetConvolution16bNhwcWinograd::SynetConvolution16bNhwcWinograd(const ConvParam& p)
+            : SynetConvolution16b(p)
+        {
+            SetBlock(4, 4);
+            _setFilter = Base::WinogradKernel3x3Block4x4SetFilter;
+            _setInput = Base::WinogradKernel3x3Block4x4SetInput;
+            _setOutput = Base::WinogradKernel3x3Block4x4SetOutput;
+            _biasAndActivation = Base::ConvolutionBiasAndActivation;
+            _bFloat16ToFloat32 = Base::BFloat16ToFloat32;
+            _float32ToBFloat16 = Base::Float32ToBFloat16;
+            SetGemm(Base::SynetInnerProduct16bInit);
+        }
+
+        SynetConvolution16bNhwcWinograd::~SynetConvolution16bNhwcWinograd()
+        {
+            for (size_t i = 0; i < _gemms.size(); ++i)
+                delete _gemms[i];
+        }
+
+        String SynetConvolution16bNhwcWinograd::Desc() const
+        {
+            const ConvParam& p = _param;
+            std::stringstream desc;
+            desc << Ext() << "::NhwcWinograd F(" << _blockY << "x" << _blockX << "," << p.kernelY << "x" << p.kernelX << ")";
+            if (_merge > 1)
+                desc << "*" << _merge;
+            if (_split > 1)
+                desc << "/" << _split;
+            return desc.str();
+        }
+
+        size_t SynetConvolution16bNhwcWinograd::ExternalBufferSize() const
+        {
+            size_t size = 0;
+            if (_src16b)
+                size += AlignHi(_sizeS * _merge * sizeof(float), SIMD_ALIGN);
+            size += AlignHi(_strideS * _count * _merge * sizeof(float), SIMD_ALIGN);
+            size += AlignHi(_strideD * _count * _merge * sizeof(float), SIMD_ALIGN);
+            if (_dst16b)
+                size += AlignHi(_sizeO * sizeof(float), SIMD_ALIGN);
+            return size + _gemms[0]->ExternalBufferSize();
+        }
+
+        size_t SynetConvolution16bNhwcWinograd::InternalBufferSize() const
+        {
+            size_t size = SynetConvolution16b::InternalBufferSize();
+            for (size_t i = 0; i < _gemms.size(); ++i)
+                size += _gemms[i]->InternalBufferSize();
+            return size;
+        }
+
+        void SynetConvolution16bNhwcWinograd::SetParams(const float* weight, const float* bias, const float* params)
+        {
+            const ConvParam& p = _param;
+            size_t size = p.srcC * p.dstC;
+            Array32f buffer(size * _count);
+            _setFilter(weight, size, buffer.data, SimdTrue);
+            for (size_t i = 0; i < _count; ++i)
+                _gemms[i]->SetParams(buffer.data + i * size, NULL);
+            SynetConvolution16b::SetBias(bias, Alignment());
+            SynetConvolution16b::SetParams(params, Alignment());
+        }
+
+        void SynetConvolution16bNhwcWinograd::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        {
+            buf = Buffer(buf);
+            float* bufI = _src16b ? Allocate<float>(buf, _sizeS * _merge) : NULL;
+            float* bufS = Allocate<float>(buf, _strideS * _count * _merge);
+            float* bufD = Allocate<float>(buf, _strideD * _count * _merge);
+            float* bufO = _dst16b ? Allocate<float>(buf, _sizeO) : NULL;
+            for (size_t b = 0; b < _batch; b += _merge)
+            {
+                if (_src16b)
+                    _bFloat16ToFloat32((uint16_t*)src, _sizeS * _merge, bufI);
+                Forward(_src16b ? bufI : (float*)src, bufS, bufD, bufO, buf, dst);
+                src += _sizeS * _merge * _elemS;
+                dst += _sizeD * _merge * _elemD;
+            }
+        }
+
+        bool SynetConvolution16bNhwcWinograd::Preferable(const ConvParam& p)
+        {
+            if (!Bf16Winograd(p.compatibility))
+                return false;
+            if (!(p.trans && p.IsKernel(3) && p.IsStride(1) && p.IsDilation(1) && p.group == 1 && (p.IsPad(0) || p.IsPad(1))))
+                return false;
+            return p.srcC >= 64 && p.dstC >= 64 && p.dstH >= 16 && p.dstW >= 16;
+        }
+
+        void SynetConvolution16bNhwcWinograd::SetBlock(size_t blockY, size_t blockX)
+        {
+            const ConvParam& p = _param;
+            _blockY = blockY;
+            _blockX = blockX;
+            _count = (_blockY + p.kernelY - 1) * (_blockX + p.kernelX - 1);
+            _tileH = DivHi(p.dstH, _blockY);
+            _tileW = DivHi(p.dstW, _blockX);
+            _batch = p.batch;
+            _sizeS = p.srcC * p.srcH * p.srcW;
+            _sizeD = p.dstC * p.dstH * p.dstW;
+            _merge = 1;
+            _split = 1;
+            _tileHs = _tileH;
+            if (_batch > 1)
+            {
+                for (size_t merge = 1; merge <= _batch; ++merge)
+                    if (_batch % merge == 0 && _tileH * _tileW * merge <= 256)
+                        _merge = merge;
+            }
+            if (_merge == 1)
+            {
+                size_t cacheL2 = Base::AlgCacheL2() / sizeof(float);
+                size_t bufferSize = _count * (p.srcC + p.dstC) * _tileW * _tileH;
+                if (bufferSize > cacheL2)
+                {
+                    size_t minH = Simd::Min(DivHi(64, _tileW), _tileH);
+                    _tileHs = Simd::RestrictRange<size_t>(cacheL2 / 2 * _tileH / bufferSize, minH, _tileH);
+                    _split = DivHi(_tileH, _tileHs);
+                    _tileHs = DivHi(_tileH, _split);
+                }
+            }
+            _strideS = p.srcC * _tileHs * _tileW;
+            _strideD = p.dstC * _tileHs * _tileW;
+            _sizeO = Simd::Min(_tileHs * _blockY, p.dstH) * p.dstW * p.dstC * _merge;
+        }
+
+        void SynetConvolution16bNhwcWinograd::SetGemm(GemmInitPtr init)
+        {
+            const ConvParam& p = _param;
+            for (size_t i = 0; i < _gemms.size(); ++i)
+                delete _gemms[i];
+            _gemms.resize(_count);
+            for (size_t i = 0; i < _count; ++i)
+                _gemms[i] = (SynetInnerProduct16b*)init(_tileW * _tileHs * _merge, p.dstC, p.srcC,
+                    SimdTensorData32f, SimdTensorData32f, SimdTensorData32f, SimdFalse, SimdTrue, SimdFalse);
+        }
+
+        void SynetConvolution16bNhwcWinograd::Forward(const float* src, float* bufS, float* bufD, float* bufO, uint8_t* bufG, uint8_t* dst)
+        {
+            const ConvParam& p = _param;
+            for (size_t s = 0; s < _split; ++s)
+            {
+                size_t padY = s ? 0 : p.padY;
+                size_t padH = s == _split - 1 ? p.padH : 0;
+                size_t srcY = s * _tileHs * _blockY + padY - p.padY;
+                size_t srcH = Simd::Min(_tileHs * _blockY + p.kernelY - 1 - padY - padH, p.srcH - srcY);
+                size_t dstY = s * _tileHs * _blockY;
+                size_t dstH = Simd::Min(_tileHs * _blockY, p.dstH - dstY);
+                for (size_t m = 0; m < _merge; ++m)
+                    _setInput(src + m * _sizeS + srcY * p.srcW * p.srcC, p.srcC, srcH, p.srcW, padY, p.padX, padH, p.padW, bufS + m * _strideS, _strideS * _merge, SimdTrue);
+                for (size_t i = 0; i < _count; ++i)
+                    _gemms[i]->Forward((uint8_t*)(bufS + i * _strideS * _merge), NULL, bufG, (uint8_t*)(bufD + i * _strideD * _merge));
+                for (size_t m = 0; m < _merge; ++m)
+                {
+                    size_t offset = m * _sizeD + dstY * p.dstW * p.dstC, size = dstH * p.dstW * p.dstC;
+                    float* dst32f = _dst16b ? bufO + m * size : (float*)dst + offset;
+                    _setOutput(bufD + m * _strideD, _strideD * _merge, dst32f, p.dstC, dstH, p.dstW, SimdTrue);
+                    _biasAndActivation(_bias.data, p.dstC, dstH * p.dstW, p.activation, _params.data, SimdTrue, dst32f);
+                    if (_dst16b)
+                        _float32ToBFloat16(dst32f, size, (uint16_t*)dst + offset);
+                }
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,114 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution16b.h"
+#include "Simd/SimdSynetWeightCache.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        SynetConvolution16bReshapable::SynetConvolution16bReshapable(const ConvParam& p, InitPtr init, size_t plans)
+            : SynetConvolution16b(p)
+            , _init(init)
+            , _capacity(Simd::Max(plans, size_t(1)))
+            , _srcWeight(NULL)
+            , _srcBias(NULL)
+            , _srcParams(NULL)
+        {
+            Plan plan = { p.batch, p.srcH, p.srcW, (SynetConvolution16b*)_init(p.batch, &p, p.compatibility) };
+            if (plan.conv)
+                _plans.push_back(plan);
+        }
+
+        SynetConvolution16bReshapable::~SynetConvolution16bReshapable()
+        {
+            for (size_t i = 0; i < _plans.size(); ++i)
+                delete _plans[i].conv;
+        }
+
+        size_t SynetConvolution16bReshapable::InternalBufferSize() const
+        {
+            size_t size = 0;
+            for (size_t i = 0; i < _plans.size(); ++i)
+                size += _plans[i].conv->InternalBufferSize();
+            return size;
+        }
+
+        void SynetConvolution16bReshapable::SetParams(const float* weight, const float* bias, const float* params)
+        {
+            _srcWeight = weight;
+            _srcBias = bias;
+            _srcParams = params;
+            SynetWeightCacheForce force;
+            for (size_t i = 0; i < _plans.size(); ++i)
+                _plans[i].conv->SetParams(weight, bias, params);
+        }
+
+        void SynetConvolution16bReshapable::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        {
+            Current()->Forward(src, buf, dst);
+        }
+
+        bool SynetConvolution16bReshapable::ForwardAdd(const uint8_t* src, const uint8_t* add, SimdTensorDataType addType, uint8_t* buf, uint8_t* dst)
+        {
+            return Current()->ForwardAdd(src, add, addType, buf, dst);
+        }
+
+        bool SynetConvolution16bReshapable::Reshape(size_t batch, size_t srcH, size_t srcW)
+        {
+            for (size_t i = 0; i < _plans.size(); ++i)
+            {
+                Plan plan = _plans[i];
+                if (plan.batch == batch && plan.srcH == srcH && plan.srcW == srcW)
+                {
+                    _plans.erase(_plans.begin() + i);
+                    _plans.insert(_plans.begin(), plan);
+                    _param = plan.conv->Param();
+                    return true;
+                }
+            }
+            ConvParam p = _param;
+            if (!p.Reshape(batch, srcH, srcW))
+                return false;
+            Plan plan = { batch, srcH, srcW, (SynetConvolution16b*)_init(batch, &p, p.compatibility) };
+            if (plan.conv == NULL)
+                return false;
+            if (_srcWeight)
+            {
+                SynetWeightCacheForce force;
+                plan.conv->SetParams(_srcWeight, _srcBias, _srcParams);
+            }
+            _plans.insert(_plans.begin(), plan);
+            if (_plans.size() > _capacity)
+            {
+                delete _plans.back().conv;
+                _plans.pop_back();
+            }
+            _param = p;
+            return true;
+        }
+    }
+#endif
+}
@@ -70,10 +70,14 @@ namespace Simd
                     *internal = SimdTrue;
             }
             else
-            if (_rWeight.data)
+            if (_rWeight.data || _sharedWeight)
             {
-                ReorderWeight(weight, _rWeight.data);
-                _weight = _rWeight.data;
+                const ConvParam& p = _param;
+                const AlgParam& a = _run.At(0).alg;
+                std::stringstream key;
+                key << Ext() << "::NhwcDirect-" << p.kernelY << "x" << p.kernelX << "x" << p.srcC << "x" << p.dstC << "-" << a.F;
+                _weight = SynetPackWeight(key.str(), weight, p.SizeW(), DivHi(p.dstC, a.F) * a.stepW,
+                    _rWeight, _sharedWeight, [this, weight](float* dst) { ReorderWeight(weight, dst); });
                 if (internal)
                     *internal = SimdTrue;
             }
@@ -0,0 +1,104 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynetWeightCache.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        SynetConvolution32fReshapable::SynetConvolution32fReshapable(const ConvParam& p, InitPtr init, size_t plans)
+            : SynetConvolution32f(p)
+            , _init(init)
+            , _capacity(Simd::Max(plans, size_t(1)))
+        {
+            Plan plan = { p.batch, p.srcH, p.srcW, (SynetConvolution32f*)_init(p.batch, &p) };
+            if (plan.conv)
+                _plans.push_back(plan);
+        }
+
+        SynetConvolution32fReshapable::~SynetConvolution32fReshapable()
+        {
+            for (size_t i = 0; i < _plans.size(); ++i)
+                delete _plans[i].conv;
+        }
+
+        size_t SynetConvolution32fReshapable::InternalBufferSize() const
+        {
+            size_t size = 0;
+            for (size_t i = 0; i < _plans.size(); ++i)
+                size += _plans[i].conv->InternalBufferSize();
+            return size;
+        }
+
+        void SynetConvolution32fReshapable::SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params)
+        {
+            SynetConvolution32f::SetParams(weight, internal, bias, params);
+            SynetWeightCacheForce force;
+            for (size_t i = 0; i < _plans.size(); ++i)
+                _plans[i].conv->SetParams(weight, NULL, bias, params);
+        }
+
+        void SynetConvolution32fReshapable::Forward(const float* src, float* buf, float* dst)
+        {
+            Current()->Forward(src, buf, dst);
+        }
+
+        bool SynetConvolution32fReshapable::Reshape(size_t batch, size_t srcH, size_t srcW)
+        {
+            for (size_t i = 0; i < _plans.size(); ++i)
+            {
+                Plan plan = _plans[i];
+                if (plan.batch == batch && plan.srcH == srcH && plan.srcW == srcW)
+                {
+                    _plans.erase(_plans.begin() + i);
+                    _plans.insert(_plans.begin(), plan);
+                    _param = plan.conv->Param();
+                    return true;
+                }
+            }
+            ConvParam p = _param;
+            if (!p.Reshape(batch, srcH, srcW))
+                return false;
+            Plan plan = { batch, srcH, srcW, (SynetConvolution32f*)_init(batch, &p) };
+            if (plan.conv == NULL)
+                return false;
+            if (_weight)
+            {
+                SynetWeightCacheForce force;
+                plan.conv->SetParams(_weight, NULL, _bias, _params);
+            }
+            _plans.insert(_plans.begin(), plan);
+            if (_plans.size() > _capacity)
+            {
+                delete _plans.back().conv;
+                _plans.pop_back();
+            }
+            _param = p;
+            return true;
+        }
+    }
+#endif
+}
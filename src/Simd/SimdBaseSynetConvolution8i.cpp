@@ -241,11 +241,7 @@ namespace Simd
 
     void SynetConvolution8i::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
     {
-        if (buf == NULL)
-        {
-            _buffer.Resize(ExternalBufferSize());
-            buf = _buffer.data;
-        }
+        buf = SynetBuffer(buf, ExternalBufferSize(), _buffer);
         const ConvParam& p = _param;
         uint8_t* src8u = _src8u ? NULL : Allocate<uint8_t>(buf, _sizeS * _merge);
         for (size_t b = 0; b < p.batch; b += _merge)
@@ -0,0 +1,133 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetDeconvolution16b.h"
+#include "Simd/SimdSynetConvolution16b.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdMemory.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        SynetDeconvolution16bNhwcSubPixel::SynetDeconvolution16bNhwcSubPixel(const DeconvParam& p)
+            : SynetDeconvolution16b(p)
+        {
+            assert(p.trans && p.group == 1);
+            _phases.resize(p.strideY * p.strideX);
+            _sizeB = 0;
+            for (size_t py = 0, i = 0; py < p.strideY; ++py)
+            {
+                for (size_t px = 0; px < p.strideX; ++px, ++i)
+                {
+                    _phases[i].Init(p, py, px);
+                    _sizeB = Simd::Max(_sizeB, _phases[i].conv.dstH * _phases[i].conv.dstW * p.dstC);
+                }
+            }
+            _stepS = p.srcH * p.srcW * p.srcC * _elemS;
+            _stepD = p.dstH * p.dstW * p.dstC * _elemD;
+            SetConvolutions(Base::SynetConvolution16bInit);
+        }
+
+        SynetDeconvolution16bNhwcSubPixel::~SynetDeconvolution16bNhwcSubPixel()
+        {
+            for (size_t i = 0; i < _convs.size(); ++i)
+                delete _convs[i];
+        }
+
+        String SynetDeconvolution16bNhwcSubPixel::Desc() const
+        {
+            return Ext() + "::NhwcSubPixel-" + ToStr(_convs.size()) + "[" + _convs[0]->Desc() + "]";
+        }
+
+        size_t SynetDeconvolution16bNhwcSubPixel::ExternalBufferSize() const
+        {
+            size_t size = 0;
+            for (size_t i = 0; i < _convs.size(); ++i)
+                size = Simd::Max(size, _convs[i]->ExternalBufferSize());
+            if (_convs.size() > 1)
+                size += AlignHi(_sizeB * _elemD, SIMD_ALIGN);
+            return size;
+        }
+
+        size_t SynetDeconvolution16bNhwcSubPixel::InternalBufferSize() const
+        {
+            size_t size = _buffer.RawSize();
+            for (size_t i = 0; i < _convs.size(); ++i)
+                size += _convs[i]->InternalBufferSize();
+            return size;
+        }
+
+        void SynetDeconvolution16bNhwcSubPixel::SetParams(const float* weight, const float* bias, const float* params)
+        {
+            const DeconvParam& p = _param;
+            Array32f buf;
+            for (size_t i = 0; i < _convs.size(); ++i)
+            {
+                const SimdConvolutionParameters& c = _phases[i].conv;
+                buf.Resize(c.kernelY * c.kernelX * c.srcC * c.dstC);
+                _phases[i].SetWeight(p, weight, buf.data);
+                _convs[i]->SetParams(buf.data, bias, params);
+            }
+        }
+
+        void SynetDeconvolution16bNhwcSubPixel::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        {
+            const DeconvParam& p = _param;
+            buf = Buffer(buf);
+            uint8_t* bufD = _convs.size() > 1 ? Allocate<uint8_t>(buf, _sizeB * _elemD) : NULL;
+            for (size_t b = 0; b < p.batch; ++b)
+            {
+                if (bufD)
+                {
+                    for (size_t i = 0; i < _convs.size(); ++i)
+                    {
+                        _convs[i]->Forward(src, buf, bufD);
+                        _phases[i].SetDst(p, bufD, _elemD, dst);
+                    }
+                }
+                else
+                    _convs[0]->Forward(src, buf, dst);
+                src += _stepS;
+                dst += _stepD;
+            }
+        }
+
+        bool SynetDeconvolution16bNhwcSubPixel::Preferable(const DeconvParam& p)
+        {
+            return false;
+        }
+
+        void SynetDeconvolution16bNhwcSubPixel::SetConvolutions(ConvolutionInitPtr init)
+        {
+            const DeconvParam& p = _param;
+            for (size_t i = 0; i < _convs.size(); ++i)
+                delete _convs[i];
+            _convs.resize(_phases.size());
+            for (size_t i = 0; i < _phases.size(); ++i)
+                _convs[i] = (SynetConvolution16b*)init(1, &_phases[i].conv, p.compatibility);
+        }
+    }
+#endif
+}
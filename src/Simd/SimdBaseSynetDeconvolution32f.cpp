@@ -437,6 +437,120 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        SynetDeconvolution32fNhwcSubPixel::SynetDeconvolution32fNhwcSubPixel(const DeconvParam & p)
+            : SynetDeconvolution32f(p)
+        {
+            assert(p.trans && p.group == 1);
+            _phases.resize(p.strideY * p.strideX);
+            _sizeB = 0;
+            for (size_t py = 0, i = 0; py < p.strideY; ++py)
+            {
+                for (size_t px = 0; px < p.strideX; ++px, ++i)
+                {
+                    _phases[i].Init(p, py, px);
+                    _sizeB = Simd::Max(_sizeB, _phases[i].conv.dstH * _phases[i].conv.dstW * p.dstC);
+                }
+            }
+            _sizeS = p.srcC * p.srcH * p.srcW;
+            _sizeD = p.dstC * p.dstH * p.dstW;
+            SetConvolutions(Base::SynetConvolution32fInit);
+        }
+
+        SynetDeconvolution32fNhwcSubPixel::~SynetDeconvolution32fNhwcSubPixel()
+        {
+            for (size_t i = 0; i < _convs.size(); ++i)
+                delete _convs[i];
+        }
+
+        String SynetDeconvolution32fNhwcSubPixel::Desc() const
+        {
+            return Ext() + "::NhwcSubPixel-" + ToStr(_convs.size()) + "[" + _convs[0]->Desc() + "]";
+        }
+
+        size_t SynetDeconvolution32fNhwcSubPixel::ExternalBufferSize() const
+        {
+            size_t size = 0;
+            for (size_t i = 0; i < _convs.size(); ++i)
+                size = Simd::Max(size, _convs[i]->ExternalBufferSize());
+            if (_convs.size() > 1)
+                size += AlignHi(_sizeB, SIMD_ALIGN);
+            return size;
+        }
+
+        size_t SynetDeconvolution32fNhwcSubPixel::InternalBufferSize() const
+        {
+            size_t size = _buffer.size + _weightS.size;
+            for (size_t i = 0; i < _convs.size(); ++i)
+                size += _convs[i]->InternalBufferSize();
+            return size;
+        }
+
+        void SynetDeconvolution32fNhwcSubPixel::SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
+        {
+            const DeconvParam & p = _param;
+            SynetDeconvolution32f::SetParams(weight, internal, bias, params);
+            _weightS.Resize(p.kernelY * p.kernelX * p.srcC * p.dstC);
+            float * dst = _weightS.data;
+            bool external = false;
+            for (size_t i = 0; i < _convs.size(); ++i)
+            {
+                const SimdConvolutionParameters & c = _phases[i].conv;
+                _phases[i].SetWeight(p, weight, dst);
+                SimdBool own = SimdFalse;
+                _convs[i]->SetParams(dst, &own, bias, params);
+                if (own == SimdFalse)
+                    external = true;
+                dst += c.kernelY * c.kernelX * c.srcC * c.dstC;
+            }
+            if (!external)
+                _weightS.Resize(0);
+            if (internal)
+                *internal = SimdTrue;
+        }
+
+        void SynetDeconvolution32fNhwcSubPixel::Forward(const float * src, float * buf, float * dst)
+        {
+            const DeconvParam & p = _param;
+            buf = Buffer(buf);
+            float * bufD = NULL;
+            if (_convs.size() > 1)
+            {
+                bufD = buf;
+                buf += AlignHi(_sizeB, SIMD_ALIGN);
+            }
+            for (size_t b = 0; b < p.batch; ++b)
+            {
+                if (bufD)
+                {
+                    for (size_t i = 0; i < _convs.size(); ++i)
+                    {
+                        _convs[i]->Forward(src, buf, bufD);
+                        _phases[i].SetDst(p, (uint8_t*)bufD, sizeof(float), (uint8_t*)dst);
+                    }
+                }
+                else
+                    _convs[0]->Forward(src, buf, dst);
+                src += _sizeS;
+                dst += _sizeD;
+            }
+        }
+
+        bool SynetDeconvolution32fNhwcSubPixel::Preferable(const DeconvParam & p)
+        {
+            return false;
+        }
+
+        void SynetDeconvolution32fNhwcSubPixel::SetConvolutions(ConvolutionInitPtr init)
+        {
+            for (size_t i = 0; i < _convs.size(); ++i)
+                delete _convs[i];
+            _convs.resize(_phases.size());
+            for (size_t i = 0; i < _phases.size(); ++i)
+                _convs[i] = (SynetConvolution32f*)init(1, &_phases[i].conv);
+        }
+
+        //---------------------------------------------------------------------
+
         void * SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility)
         {
             DeconvParam param(batch, conv, compatibility);
@@ -34,7 +34,10 @@ namespace Simd
             GridSample2dParam param(batch, channels, srcH, srcW, dstH, dstW, type, interp, padding, align);
             if (!param.Valid())
                 return NULL;
-            return new SynetGridSample2dRef(param);
+            if (param.Is32fBlZ())
+                return new Base::SynetGridSample2d32fBlZ(param);
+            else
+                return new Base::SynetGridSample2dGather(param);
         }
     }
 #endif
@@ -0,0 +1,246 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetGridSample.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        template<SimdGridSamplePaddingType padding> SIMD_INLINE void SetTap(ptrdiff_t y, ptrdiff_t x, float w, ptrdiff_t H, ptrdiff_t W, const float* border, uint32_t& idx, float& wgt)
+        {
+            if (padding == SimdGridSamplePaddingZeros)
+            {
+                bool inside = x >= 0 && x < W && y >= 0 && y < H;
+                idx = inside ? uint32_t(y * W + x) : 0;
+                wgt = inside ? w : 0.0f;
+                return;
+            }
+            else if (padding == SimdGridSamplePaddingBorder)
+            {
+                x = Simd::RestrictRange<ptrdiff_t>(x, 0, W - 1);
+                y = Simd::RestrictRange<ptrdiff_t>(y, 0, H - 1);
+            }
+            else if (padding == SimdGridSamplePaddingReflect)
+            {
+                x = ptrdiff_t(Reflect(float(x), border[0], border[2]));
+                y = ptrdiff_t(Reflect(float(y), border[1], border[3]));
+            }
+            idx = uint32_t(y * W + x);
+            wgt = w;
+        }
+
+        template<SimdGridSampleInterpType interp, SimdGridSamplePaddingType padding, SimdBool align>
+        void IndexCoeffs(const float* grd, size_t size, int srcH, int srcW, size_t stride, uint32_t* idx, float* wgt)
+        {
+            float border[4];
+            if (align)
+            {
+                border[0] = 0.0f;
+                border[1] = 0.0f;
+                border[2] = srcW - 1.0f;
+                border[3] = srcH - 1.0f;
+            }
+            else
+            {
+                border[0] = -0.5f;
+                border[1] = -0.5f;
+                border[2] = srcW - 0.5f;
+                border[3] = srcH - 0.5f;
+            }
+            for (size_t d = 0; d < size; ++d, grd += 2)
+            {
+                float x = Denormalize<float, align>(grd[0], srcW);
+                float y = Denormalize<float, align>(grd[1], srcH);
+                if (interp == SimdGridSampleInterpNearest)
+                {
+                    x = float(Round(x));
+                    y = float(Round(y));
+                }
+                if (x < border[0] || x > border[2] || y < border[1] || y > border[3])
+                {
+                    if (padding == SimdGridSamplePaddingBorder)
+                    {
+                        x = Simd::RestrictRange<float>(x, 0, float(srcW - 1));
+                        y = Simd::RestrictRange<float>(y, 0, float(srcH - 1));
+                    }
+                    else if (padding == SimdGridSamplePaddingReflect)
+                    {
+                        x = Reflect(x, border[0], border[2]);
+                        y = Reflect(y, border[1], border[3]);
+                    }
+                }
+                if (interp == SimdGridSampleInterpNearest)
+                    SetTap<padding>(ptrdiff_t(y), ptrdiff_t(x), 1.0f, srcH, srcW, border, idx[d], wgt[d]);
+                if (interp == SimdGridSampleInterpBilinear)
+                {
+                    ptrdiff_t x0 = ptrdiff_t(std::floor(x));
+                    ptrdiff_t y0 = ptrdiff_t(std::floor(y));
+                    float dx1 = x - float(x0), dx0 = float(x0 + 1) - x;
+                    float dy1 = y - float(y0), dy0 = float(y0 + 1) - y;
+                    SetTap<padding>(y0 + 0, x0 + 0, dy0 * dx0, srcH, srcW, border, idx[0 * stride + d], wgt[0 * stride + d]);
+                    SetTap<padding>(y0 + 0, x0 + 1, dy0 * dx1, srcH, srcW, border, idx[1 * stride + d], wgt[1 * stride + d]);
+                    SetTap<padding>(y0 + 1, x0 + 0, dy1 * dx0, srcH, srcW, border, idx[2 * stride + d], wgt[2 * stride + d]);
+                    SetTap<padding>(y0 + 1, x0 + 1, dy1 * dx1, srcH, srcW, border, idx[3 * stride + d], wgt[3 * stride + d]);
+                }
+                if (interp == SimdGridSampleInterpBicubic)
+                {
+                    ptrdiff_t x0 = ptrdiff_t(std::floor(x)) - 1;
+                    ptrdiff_t y0 = ptrdiff_t(std::floor(y)) - 1;
+                    float kx[4], ky[4];
+                    CubicCoeffs(x - float(x0) - 1.0f, kx);
+                    CubicCoeffs(y - float(y0) - 1.0f, ky);
+                    for (ptrdiff_t h = 0, t = 0; h < 4; ++h)
+                        for (ptrdiff_t w = 0; w < 4; ++w, ++t)
+                            SetTap<padding>(y0 + h, x0 + w, ky[h] * kx[w], srcH, srcW, border, idx[t * stride + d], wgt[t * stride + d]);
+                }
+            }
+        }
+
+        template<SimdGridSampleInterpType interp, SimdGridSamplePaddingType padding> SynetGridSample2dGather::IndexCoeffsPtr GetIndexCoeffs(SimdBool align)
+        {
+            return align ? IndexCoeffs<interp, padding, SimdTrue> : IndexCoeffs<interp, padding, SimdFalse>;
+        }
+
+        template<SimdGridSampleInterpType interp> SynetGridSample2dGather::IndexCoeffsPtr GetIndexCoeffs(SimdGridSamplePaddingType padding, SimdBool align)
+        {
+            switch (padding)
+            {
+            case SimdGridSamplePaddingZeros: return GetIndexCoeffs<interp, SimdGridSamplePaddingZeros>(align);
+            case SimdGridSamplePaddingBorder: return GetIndexCoeffs<interp, SimdGridSamplePaddingBorder>(align);
+            case SimdGridSamplePaddingReflect: return GetIndexCoeffs<interp, SimdGridSamplePaddingReflect>(align);
+            default:
+                return NULL;
+            }
+        }
+
+        SynetGridSample2dGather::IndexCoeffsPtr GetIndexCoeffs(SimdGridSampleInterpType interp, SimdGridSamplePaddingType padding, SimdBool align)
+        {
+            switch (interp)
+            {
+            case SimdGridSampleInterpBilinear: return GetIndexCoeffs<SimdGridSampleInterpBilinear>(padding, align);
+            case SimdGridSampleInterpNearest: return GetIndexCoeffs<SimdGridSampleInterpNearest>(padding, align);
+            case SimdGridSampleInterpBicubic: return GetIndexCoeffs<SimdGridSampleInterpBicubic>(padding, align);
+            default:
+                return NULL;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int taps> void Gather32f(const float* src, const uint32_t* idx, const float* wgt, size_t stride, size_t size, float* dst)
+        {
+            for (size_t d = 0; d < size; ++d)
+            {
+                float sum = 0.0f;
+                for (int t = 0; t < taps; ++t)
+                    sum += src[idx[t * stride + d]] * wgt[t * stride + d];
+                dst[d] = sum;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetGridSample2dGather::SynetGridSample2dGather(const GridSample2dParam& param)
+            : Simd::SynetGridSample2d(param)
+            , _threads(Base::GetThreadNumber())
+        {
+            const GridSample2dParam& p = _param;
+            _srcS = p.srcH * p.srcW;
+            _dstS = p.dstH * p.dstW;
+            _taps = p.interp == SimdGridSampleInterpNearest ? 1 : (p.interp == SimdGridSampleInterpBilinear ? 4 : 16);
+            _rows = Simd::RestrictRange<size_t>(Base::AlgCacheL1() / (_taps * 2 * sizeof(float) * p.dstW), 1, p.dstH);
+            _block = _rows * p.dstW;
+            _index.Resize(_block * _taps * _threads);
+            _coeffs.Resize(_block * _taps * _threads);
+            if (p.type == SimdTensorData16b)
+            {
+                _src32f.Resize(_srcS * p.channels);
+                _grd32f.Resize(_dstS * 2);
+                _dst32f.Resize(_block * _threads);
+            }
+            _indexCoeffs = GetIndexCoeffs(p.interp, p.padding, p.align);
+            switch (_taps)
+            {
+            case 1: _gather = Gather32f<1>; break;
+            case 4: _gather = Gather32f<4>; break;
+            case 16: _gather = Gather32f<16>; break;
+            }
+            _bFloat16ToFloat32 = Base::BFloat16ToFloat32;
+            _float32ToBFloat16 = Base::Float32ToBFloat16;
+        }
+
+        size_t SynetGridSample2dGather::InternalBufferSize() const
+        {
+            return _index.RawSize() + _coeffs.RawSize() + _src32f.RawSize() + _grd32f.RawSize() + _dst32f.RawSize();
+        }
+
+        void SynetGridSample2dGather::Forward(const uint8_t* src, const uint8_t* grd, uint8_t* dst)
+        {
+            const GridSample2dParam& p = _param;
+            bool is16b = p.type == SimdTensorData16b;
+            size_t elem = is16b ? 2 : 4;
+            for (size_t b = 0; b < p.batch; ++b)
+            {
+                const float* src32f = (const float*)src;
+                const float* grd32f = (const float*)grd;
+                if (is16b)
+                {
+                    _bFloat16ToFloat32((const uint16_t*)src, _srcS * p.channels, _src32f.data);
+                    _bFloat16ToFloat32((const uint16_t*)grd, _dstS * 2, _grd32f.data);
+                    src32f = _src32f.data;
+                    grd32f = _grd32f.data;
+                }
+                Simd::Parallel(0, p.dstH, [&](size_t thread, size_t begin, size_t end)
+                {
+                    uint32_t* idx = _index.data + thread * _block * _taps;
+                    float* wgt = _coeffs.data + thread * _block * _taps;
+                    float* buf = is16b ? _dst32f.data + thread * _block : NULL;
+                    for (size_t y = begin; y < end; y += _rows)
+                    {
+                        size_t offs = y * p.dstW, size = (Simd::Min(y + _rows, end) - y) * p.dstW;
+                        _indexCoeffs(grd32f + 2 * offs, size, (int)p.srcH, (int)p.srcW, _block, idx, wgt);
+                        for (size_t c = 0; c < p.channels; ++c)
+                        {
+                            if (is16b)
+                            {
+                                _gather(src32f + c * _srcS, idx, wgt, _block, size, buf);
+                                _float32ToBFloat16(buf, size, (uint16_t*)dst + c * _dstS + offs);
+                            }
+                            else
+                                _gather(src32f + c * _srcS, idx, wgt, _block, size, (float*)dst + c * _dstS + offs);
+                        }
+                    }
+                }, _threads);
+                src += _srcS * p.channels * elem;
+                grd += _dstS * 2 * elem;
+                dst += _dstS * p.channels * elem;
+            }
+        }
+    }
+#endif
+}
@@ -28,46 +28,6 @@ namespace Simd
 #if defined(SIMD_SYNET_ENABLE)
     namespace Base
     {
-        template <typename T, SimdBool align> SIMD_INLINE T Denormalize(T pos, ptrdiff_t dim)
-        {
-            if (align)
-                return T((pos + 1) / 2.0f * (dim - 1));
-            else
-                return T(((pos + 1) * dim - 1) / 2.0f);
-        }
-
-        template <typename T> SIMD_INLINE T Reflect(T x, float min, float max)
-        {
-            float fx = float(x);
-            float range = max - min;
-            if (fx < min)
-            {
-                float dx = min - fx;
-                int n = int(dx / range);
-                float r = dx - n * range;
-                return n % 2 == 0 ? T(min + r) : T(max - r);
-            }
-            else if (fx > max)
-            {
-                float dx = fx - max;
-                int n = int(dx / range);
-                float r = dx - n * range;
-                return n % 2 == 0 ? T(max - r) : T(min + r);
-            }
-            else
-                return T(fx);
-        }
-
-        SIMD_INLINE void CubicCoeffs(float x, float k[4])
-        {
-            static const float a = -0.75f;
-            x = std::abs(x);
-            k[0] = ((a * (x + 1.0f) - 5.0f * a) * (x + 1.0f) + 8.0f * a) * (x + 1.0f) - 4.0f * a;
-            k[1] = ((a + 2.0f) * x - (a + 3.0f)) * x * x + 1.0f;
-            k[2] = ((a + 2.0f) * (1.0f - x) - (a + 3.0f)) * (1.0f - x) * (1.0f - x) + 1.0f;
-            k[3] = ((a * (2.0f - x) - 5.0f * a) * (2.0f - x) + 8.0f * a) * (2.0f - x) - 4.0f * a;
-        }
-
         template <typename T> SIMD_INLINE T BicubicInterp(T p[4][4], float x, float y)
         {
             float v[4];
@@ -49,7 +49,21 @@ namespace Simd
         void SynetInnerProduct16bRef::SetParams(const float* weight, const float* bias)
         {
             const InnerProductParam16b& p = _param;
-            if (p.constB)
+            if (p.qBits)
+            {
+                assert(weight);
+                Array8i quant(p.K * p.N);
+                Array32f scale(DivHi(p.K, p.qGroup) * p.N);
+                SynetInnerProduct16bQuantizeWeight(weight, p, quant.data, scale.data);
+                _weight.Resize(p.K * p.N);
+                for (size_t k = 0; k < p.K; ++k)
+                {
+                    const float* s = scale.data + k / p.qGroup * p.N;
+                    for (size_t j = 0; j < p.N; ++j)
+                        _weight[p.transB ? j * p.K + k : k * p.N + j] = Float32ToBFloat16(float(quant[k * p.N + j]) * s[j]);
+                }
+            }
+            else if (p.constB)
             {
                 assert(weight);
                 _weight.Resize(p.K * p.N);
@@ -129,6 +143,14 @@ namespace Simd
                 return NULL;
             return new SynetInnerProduct16bRef(param);
         }
+
+        void* SynetInnerProduct16bInitWq(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeC, SimdBool transB, SimdBool bias, size_t bits, size_t group)
+        {
+            InnerProductParam16b param(M, N, K, typeA, SimdTensorData32f, typeC, transB, SimdTrue, bias, bits, group);
+            if (!param.Valid())
+                return NULL;
+            return new SynetInnerProduct16bRef(param);
+        }
     }
 #endif
 }
@@ -87,6 +87,56 @@ namespace Simd
 
         //-----------------------------------------------------------------------------------------
 
+        template<int bits> static void InnerProduct16bGemmNN_DequantB(const uint8_t* src, const float* scale, const InnerProductParam16b& p, const AlgParam& a, size_t N, size_t k, size_t K, uint16_t* dst)
+        {
+            size_t Kh = AlignHi(K, a.microK), gap = (a.bK - Kh) * a.F, G = p.qGroup, nG = DivHi(a.aK, G);
+            size_t srcStep = a.aK * a.F * bits / 8, scaleStep = nG * a.F;
+            for (size_t j = 0; j < N; j += a.F)
+            {
+                for (size_t kk = 0; kk < Kh; kk += 2)
+                {
+                    const float* s = scale + (k + kk) / G * a.F;
+                    const uint8_t* ps = src + (k + kk) * a.F * bits / 8;
+                    for (size_t f = 0; f < a.F; ++f)
+                    {
+                        int q0 = bits == 4 ? (ps[f] & 0xF) - 8 : (int8_t)ps[f];
+                        int q1 = bits == 4 ? (ps[f] >> 4) - 8 : (int8_t)ps[a.F + f];
+                        *(dst++) = Float32ToBFloat16(float(q0) * s[f]);
+                        *(dst++) = Float32ToBFloat16(float(q1) * s[f]);
+                    }
+                }
+                dst += gap;
+                src += srcStep;
+                scale += scaleStep;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void SynetInnerProduct16bQuantizeWeight(const float* weight, const InnerProductParam16b& p, int8_t* dst, float* scale)
+        {
+            int qMax = (1 << (p.qBits - 1)) - 1;
+            for (size_t k0 = 0; k0 < p.K; k0 += p.qGroup)
+            {
+                size_t k1 = Simd::Min(p.K, k0 + p.qGroup);
+                for (size_t j = 0; j < p.N; ++j)
+                {
+                    float max = 0.0f;
+                    for (size_t k = k0; k < k1; ++k)
+                        max = Simd::Max(max, Simd::Abs(p.transB ? weight[j * p.K + k] : weight[k * p.N + j]));
+                    float inv = max > 0.0f ? float(qMax) / max : 0.0f;
+                    scale[k0 / p.qGroup * p.N + j] = max / float(qMax);
+                    for (size_t k = k0; k < k1; ++k)
+                    {
+                        float w = p.transB ? weight[j * p.K + k] : weight[k * p.N + j];
+                        dst[k * p.N + j] = (int8_t)Simd::RestrictRange(Round(w * inv), -qMax, qMax);
+                    }
+                }
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
         bool SynetInnerProduct16bGemmNN::Preferable(const InnerProductParam16b& p)
         {
             return true;// p.constB == SimdTrue || p.typeB == SimdTensorData32f;
@@ -98,6 +148,8 @@ namespace Simd
             , _prepA(0)
             , _prepB(0)
             , _gemm(0)
+            , _dequantB(0)
+            , _gemv(0)
         {
             if (p.typeB == SimdTensorData32f || p.constB)
             {
@@ -106,6 +158,15 @@ namespace Simd
                 else
                     _prepB = InnerProduct16bGemmNN_ConvertBn;
             }
+            if (p.qBits == 4)
+                _dequantB = InnerProduct16bGemmNN_DequantB<4>;
+            if (p.qBits == 8)
+                _dequantB = InnerProduct16bGemmNN_DequantB<8>;
+        }
+
+        size_t SynetInnerProduct16bGemmNN::InternalBufferSize() const
+        {
+            return SynetInnerProduct16b::InternalBufferSize() + _qWeight.RawSize() + _qScale.RawSize();
         }
 
         String SynetInnerProduct16bGemmNN::Desc() const
@@ -128,17 +189,17 @@ namespace Simd
             a.aN = AlignHi(p.N, a.F);
             a.aM = AlignHi(p.M, a.microM);
             a.macroK = Simd::RestrictRange(AlignLo(L1 / a.microN / 2, a.microK), a.microK, a.aK);
-            a.macroN = Simd::RestrictRange(AlignLo(L3 / a.macroK / 2, a.microN), a.microN, a.aN);
+            a.macroN = Simd::RestrictRange(AlignLo((p.qBits ? L2 : L3) / a.macroK / 2, a.microN), a.microN, a.aN);
             a.macroM = Simd::RestrictRange(AlignLo(L2 / a.macroK / 2, a.microM), a.microM, a.aM);
             a.eA = p.typeA == SimdTensorData32f ? 4 : 2;
             a.eB = p.typeB == SimdTensorData32f ? 4 : 2;
             a.eC = p.typeC == SimdTensorData32f ? 4 : 2;
 
             _sizeA = (p.typeA == SimdTensorData32f || p.K != a.aK) ? a.aM * a.aK : 0;
-            _sizeB = p.constB ? 0 : a.macroK * a.macroN;
+            _sizeB = p.constB && p.qBits == 0 ? 0 : a.macroK * a.macroN;
             _sizeC = (p.typeC == SimdTensorData16b || a.aM != p.M || a.aN != p.N) ? a.macroN * a.aM : 0;
 
-            a.bK = p.constB ? a.aK : a.macroK;
+            a.bK = p.constB && p.qBits == 0 ? a.aK : a.macroK;
             a.cN = _sizeC ? a.macroN : p.N;
 
             _bias.Resize(a.aN, true);
@@ -148,7 +209,12 @@ namespace Simd
         {
             const InnerProductParam16b& p = _param;
             const AlgParam& a = _alg;
-            if (p.constB)
+            if (p.qBits)
+            {
+                assert(weight);
+                SetQuantizedWeight(weight);
+            }
+            else if (p.constB)
             {
                 assert(weight);
                 _weight.Resize(a.aK * a.aN, true);
@@ -158,13 +224,80 @@ namespace Simd
                 memcpy(_bias.data, bias, p.N * 4);
         }
 
+        void SynetInnerProduct16bGemmNN::SetQuantizedWeight(const float* weight)
+        {
+            const InnerProductParam16b& p = _param;
+            const AlgParam& a = _alg;
+            size_t G = p.qGroup, nG = DivHi(a.aK, G);
+            Array8i quant(p.K * p.N);
+            Array32f scale(DivHi(p.K, G) * p.N);
+            SynetInnerProduct16bQuantizeWeight(weight, p, quant.data, scale.data);
+            _qScale.Resize(a.aN * nG, true);
+            _qWeight.Resize(a.aN * a.aK * p.qBits / 8);
+            memset(_qWeight.data, p.qBits == 4 ? 0x88 : 0x00, _qWeight.size);
+            for (size_t j = 0; j < p.N; ++j)
+            {
+                size_t f = j % a.F, jF = j - f;
+                for (size_t g = 0; g < scale.size / p.N; ++g)
+                    _qScale[jF * nG + g * a.F + f] = scale[g * p.N + j];
+                uint8_t* dst = _qWeight.data + jF * a.aK * p.qBits / 8 + f;
+                for (size_t k = 0; k < p.K; ++k)
+                {
+                    int q = quant[k * p.N + j];
+                    if (p.qBits == 4)
+                    {
+                        uint8_t& d = dst[k / 2 * a.F];
+                        d = (k & 1) ? uint8_t((d & 0x0F) | ((q + 8) << 4)) : uint8_t((d & 0xF0) | (q + 8));
+                    }
+                    else
+                        dst[k * a.F] = (uint8_t)q;
+                }
+            }
+        }
+
+        void SynetInnerProduct16bGemmNN::SetGemv(GemvPtr gemv)
+        {
+            const InnerProductParam16b& p = _param;
+            _gemv = gemv;
+            if (_gemv)
+            {
+                _sizeA = p.M * _alg.aK * 2;
+                _sizeB = 0;
+                _sizeC = 0;
+            }
+        }
+
         void SynetInnerProduct16bGemmNN::Forward(const uint8_t* A, const uint8_t* B, uint8_t* buf, uint8_t* C)
         {
             const InnerProductParam16b& p = _param;
             const AlgParam& a = _alg;
             buf = Buffer(buf);
+            if (_gemv)
+            {
+                float* bufA = Allocate<float>(buf, p.M * a.aK);
+                for (size_t i = 0; i < p.M; ++i)
+                {
+                    float* dst = bufA + i * a.aK;
+                    if (p.typeA == SimdTensorData32f)
+                    {
+                        const float* src = (float*)A + i * p.K;
+                        for (size_t k = 0; k < p.K; ++k)
+                            dst[k] = RoundToBFloat16(src[k]);
+                    }
+                    else
+                    {
+                        const uint16_t* src = (uint16_t*)A + i * p.K;
+                        for (size_t k = 0; k < p.K; ++k)
+                            dst[k] = BFloat16ToFloat32(src[k]);
+                    }
+                    for (size_t k = p.K; k < a.aK; ++k)
+                        dst[k] = 0.0f;
+                }
+                _gemv(bufA, p, a, _qWeight.data, _qScale.data, _bias.data, C);
+                return;
+            }
             uint16_t* bufA = _prepA ? Allocate<uint16_t>(buf, _sizeA) : (uint16_t*)A;
-            uint16_t* bufB = p.constB ? _weight.data : Allocate<uint16_t>(buf, _sizeB);
+            uint16_t* bufB = p.constB && p.qBits == 0 ? _weight.data : Allocate<uint16_t>(buf, _sizeB);
             float* bufC = _sizeC ? Allocate<float>(buf, _sizeC) : (float*)C;
             for (size_t j = 0; j < p.N; j += a.macroN)
             {
@@ -176,11 +309,13 @@ namespace Simd
                     {
                         size_t macroM = Simd::Min(p.M, i + a.macroM) - i;
                         size_t offsA = (a.macroN == a.aN && a.macroK == a.aK && _prepA) ? 0 : i * a.aK;
-                        size_t offsB = p.constB ? j * a.bK + k * a.F : 0;
+                        size_t offsB = p.constB && p.qBits == 0 ? j * a.bK + k * a.F : 0;
                         size_t offsC = _sizeC ? (a.macroK < a.aK ? i * a.cN : 0) : i * a.cN + j;
                         if (j == 0 && k == 0 && _prepA)
                             _prepA(A + i * p.K * a.eA, p, a, macroM, p.K, bufA + offsA);
-                        if (i == 0 && _prepB && !p.constB)
+                        if (i == 0 && p.qBits)
+                            _dequantB(_qWeight.data + j * a.aK * p.qBits / 8, _qScale.data + j * DivHi(a.aK, p.qGroup), p, a, macroN, k, macroK, bufB);
+                        else if (i == 0 && _prepB && !p.constB)
                             _prepB(B + (p.transB ? j * p.K + k : k * p.N + j) * a.eB, p, a, macroN, macroK, bufB + offsB);
                         _gemm(bufA + offsA + k, p, a, macroM, macroN, macroK, (int)k, bufB + offsB, bufC + offsC, 
                             k + macroK == p.K && (_sizeC || p.bias), _bias.data + j, C + (i * p.N + j) * a.eC);
@@ -621,13 +621,7 @@ namespace Simd
 
         uint8_t* SynetMergedConvolution16b::Buffer(uint8_t* buffer)
         {
-            if (buffer)
-                return buffer;
-            else
-            {
-                _buffer.Resize(ExternalBufferSize());
-                return _buffer.data;
-            }
+            return SynetBuffer(buffer, ExternalBufferSize(), _buffer);
         }
 
         //-----------------------------------------------------------------------------------------
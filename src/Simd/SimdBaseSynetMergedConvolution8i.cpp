@@ -297,13 +297,7 @@ namespace Simd
 
         uint8_t* SynetMergedConvolution8i::GetBuffer(uint8_t* buffer)
         {
-            if (buffer)
-                return buffer;
-            else
-            {
-                _buffer.Resize(ExternalBufferSize());
-                return _buffer.data;
-            }
+            return SynetBuffer(buffer, ExternalBufferSize(), _buffer);
         }
 
         void SynetMergedConvolution8i::Quantize(const float* weight, const float* bias, size_t i, size_t q)
@@ -51,13 +51,7 @@ namespace Simd
 
     uint8_t* SynetQuantizedMergedConvolution::Buffer(uint8_t* buffer)
     {
-        if (buffer)
-            return buffer;
-        else
-        {
-            _buffer.Resize(ExternalBufferSize());
-            return _buffer.data;
-        }
+        return SynetBuffer(buffer, ExternalBufferSize(), _buffer);
     }
 
     const char* SynetQuantizedMergedConvolution::Info() const
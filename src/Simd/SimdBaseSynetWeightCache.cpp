@@ -0,0 +1,196 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetWeightCache.h"
+#include "Simd/SimdMemory.h"
+
+#include <map>
+#include <mutex>
+#include <sstream>
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE void Hash(const uint8_t* data, size_t size, uint64_t hash[2])
+        {
+            hash[0] = 0xCBF29CE484222325ULL;
+            hash[1] = 0x9E3779B97F4A7C15ULL ^ size;
+            size_t size8 = AlignLo(size, 8), i = 0;
+            for (; i < size8; i += 8)
+            {
+                uint64_t value;
+                memcpy(&value, data + i, 8);
+                hash[0] = (hash[0] ^ value) * 0x100000001B3ULL;
+                hash[1] = (hash[1] ^ (value * 0xBF58476D1CE4E5B9ULL)) * 0x94D049BB133111EBULL;
+                hash[1] ^= hash[1] >> 31;
+            }
+            for (; i < size; ++i)
+            {
+                hash[0] = (hash[0] ^ data[i]) * 0x100000001B3ULL;
+                hash[1] = (hash[1] ^ data[i]) * 0x94D049BB133111EBULL;
+            }
+        }
+
+        SIMD_INLINE size_t& WeightCacheForce()
+        {
+            static thread_local size_t force = 0;
+            return force;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        class WeightCache
+        {
+        public:
+            WeightCache()
+                : _enable(false)
+            {
+                memset(&_stat, 0, sizeof(_stat));
+            }
+
+            void Enable(bool enable)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _enable = enable;
+            }
+
+            bool Enabled()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _enable;
+            }
+
+            SynetWeightCacheStat Statistics()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _stat;
+            }
+
+            SynetWeightPtr Get(const String& key, const void* src, size_t srcSize, size_t dstSize, const SynetWeightPackPtr& pack)
+            {
+                if ((!Enabled() && WeightCacheForce() == 0) || src == NULL || dstSize == 0)
+                    return SynetWeightPtr();
+                uint64_t hash[2];
+                Hash((const uint8_t*)src, srcSize, hash);
+                std::stringstream ss;
+                ss << key << "-" << std::hex << hash[0] << "-" << hash[1] << "-" << std::dec << srcSize << "-" << dstSize;
+                String name = ss.str();
+
+                std::lock_guard<std::mutex> lock(_mutex);
+                Entries::iterator it = _entries.find(name);
+                if (it != _entries.end())
+                {
+                    SynetWeightPtr weight = it->second.lock();
+                    if (weight)
+                    {
+                        _stat.hits++;
+                        _stat.saved += dstSize;
+                        return weight;
+                    }
+                }
+                void* dst = Allocate(dstSize, SIMD_ALIGN);
+                if (dst == NULL)
+                    return SynetWeightPtr();
+                memset(dst, 0, dstSize);
+                pack(dst);
+                SynetWeightPtr weight(dst, Deleter(this, dstSize));
+                _entries[name] = weight;
+                _stat.misses++;
+                _stat.entries++;
+                _stat.bytes += dstSize;
+                return weight;
+            }
+
+        private:
+            typedef std::map<String, std::weak_ptr<const void>> Entries;
+
+            struct Deleter
+            {
+                WeightCache* cache;
+                size_t size;
+
+                Deleter(WeightCache* c, size_t s) : cache(c), size(s) {}
+
+                void operator()(const void* data) const
+                {
+                    cache->Release(data, size);
+                }
+            };
+
+            void Release(const void* data, size_t size)
+            {
+                Free((void*)data);
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stat.entries--;
+                _stat.bytes -= size;
+                for (Entries::iterator it = _entries.begin(); it != _entries.end();)
+                {
+                    if (it->second.expired())
+                        it = _entries.erase(it);
+                    else
+                        ++it;
+                }
+            }
+
+            std::mutex _mutex;
+            bool _enable;
+            Entries _entries;
+            SynetWeightCacheStat _stat;
+        };
+
+        SIMD_INLINE WeightCache& GlobalWeightCache()
+        {
+            static WeightCache* cache = new WeightCache();
+            return *cache;
+        }
+
+        void SetSynetWeightCache(bool enable)
+        {
+            GlobalWeightCache().Enable(enable);
+        }
+
+        bool GetSynetWeightCache()
+        {
+            return GlobalWeightCache().Enabled();
+        }
+
+        void ForceSynetWeightCache(bool force)
+        {
+            if (force)
+                WeightCacheForce()++;
+            else if (WeightCacheForce())
+                WeightCacheForce()--;
+        }
+
+        SynetWeightCacheStat SynetWeightCacheStatistics()
+        {
+            return GlobalWeightCache().Statistics();
+        }
+
+        SynetWeightPtr SynetWeightCacheGet(const String& key, const void* src, size_t srcSize, size_t dstSize, const SynetWeightPackPtr& pack)
+        {
+            return GlobalWeightCache().Get(key, src, srcSize, dstSize, pack);
+        }
+    }
+}
@@ -0,0 +1,127 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetWorkspace.h"
+#include "Simd/SimdMemory.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+        class Workspace
+        {
+        public:
+            Workspace()
+                : _data(NULL)
+                , _size(0)
+                , _mapped(false)
+            {
+            }
+
+            ~Workspace()
+            {
+                Release();
+            }
+
+            bool Reset(size_t size, bool hugePages)
+            {
+                Release();
+                if (size == 0)
+                    return true;
+#if defined(__linux__)
+                if (hugePages)
+                {
+                    size_t mapped = AlignHi(size, HUGE_PAGE_SIZE);
+                    void* data = ::mmap(NULL, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                    if (data != MAP_FAILED)
+                    {
+                        ::madvise(data, mapped, MADV_HUGEPAGE);
+                        _data = (uint8_t*)data;
+                        _size = mapped;
+                        _mapped = true;
+                        return true;
+                    }
+                }
+#endif
+                _data = (uint8_t*)Allocate(size, hugePages ? HUGE_PAGE_SIZE : SIMD_ALIGN);
+                _size = _data ? size : 0;
+                return _data != NULL;
+            }
+
+            void* Get(size_t size) const
+            {
+                return size <= _size ? _data : NULL;
+            }
+
+            size_t Size() const
+            {
+                return _size;
+            }
+
+        private:
+            uint8_t* _data;
+            size_t _size;
+            bool _mapped;
+
+            void Release()
+            {
+#if defined(__linux__)
+                if (_mapped)
+                    ::munmap(_data, _size);
+                else
+#endif
+                    Free(_data);
+                _data = NULL;
+                _size = 0;
+                _mapped = false;
+            }
+        };
+
+        SIMD_INLINE Workspace& ThreadWorkspace()
+        {
+            static thread_local Workspace workspace;
+            return workspace;
+        }
+
+        bool SetSynetWorkspace(size_t size, bool hugePages)
+        {
+            return ThreadWorkspace().Reset(size, hugePages);
+        }
+
+        size_t GetSynetWorkspace()
+        {
+            return ThreadWorkspace().Size();
+        }
+
+        void* SynetWorkspace(size_t size)
+        {
+            return ThreadWorkspace().Get(size);
+        }
+    }
+}
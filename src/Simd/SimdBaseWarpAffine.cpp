@@ -76,28 +76,23 @@ namespace Simd
     {
     }
 
-    //---------------------------------------------------------------------------------------------
-
-    namespace Base
+    void WarpAffine::SetMatrix(const float* mat)
     {
-        template<int N> SIMD_INLINE void FillBorder(uint8_t* dst, int count, const uint8_t* bs)
-        {
-            int i = 0, size = count * N;
-            for (int i = 0; i < size; i += N)
-                Base::CopyPixel<N>(bs, dst + i);
-        }
+        memcpy(_param.mat, mat, 6 * sizeof(float));
+        SetInv(_param.mat, _param.inv);
+        _first = true;
+    }
 
-        template<> SIMD_INLINE void FillBorder<3>(uint8_t* dst, int count, const uint8_t* bs)
-        {
-            int i = 0, size = count * 3, size3 = size - 3;
-            for (; i < size3; i += 3)
-                Base::CopyPixel<4>(bs, dst + i);
-            for (; i < size; i += 3)
-                Base::CopyPixel<3>(bs, dst + i);
-        }
+    void WarpAffine::SetThreads(size_t threads)
+    {
+        _threads = threads;
+        _first = true;
+    }
 
-        //---------------------------------------------------------------------------------------------
+    //---------------------------------------------------------------------------------------------
 
+    namespace Base
+    {
         template<int N> void NearestRun(const WarpAffParam& p, int yBeg, int yEnd, const int32_t* beg, const int32_t* end, const uint8_t* src, uint8_t* dst, uint32_t* buf)
         {
             bool fill = p.NeedFill();
@@ -132,12 +127,16 @@ namespace Simd
         WarpAffineNearest::WarpAffineNearest(const WarpAffParam& param)
             : WarpAffine(param)
         {
-            switch (_param.channels)
+            switch (_param.PixelSize())
             {
             case 1: _run = NearestRun<1>; break;
             case 2: _run = NearestRun<2>; break;
             case 3: _run = NearestRun<3>; break;
             case 4: _run = NearestRun<4>; break;
+            case 6: _run = NearestRun<6>; break;
+            case 8: _run = NearestRun<8>; break;
+            case 12: _run = NearestRun<12>; break;
+            case 16: _run = NearestRun<16>; break;
             }
         }
 
@@ -272,19 +271,74 @@ namespace Simd
 
         //---------------------------------------------------------------------------------------------
 
-        WarpAffineByteBilinear::WarpAffineByteBilinear(const WarpAffParam& param)
+        template<class T, int N> void BilinearRun(const WarpAffParam& p, int yBeg, int yEnd, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            constexpr int P = N * sizeof(T);
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 2, h = (int)p.srcH - 2;
+            const T* brd = (T*)p.border;
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                int iB = ib[y], iE = ie[y], oB = ob[y], oE = oe[y];
+                T* row = (T*)dst;
+                if (fill)
+                    FillBorder<P>(dst, oB, p.border);
+                for (int x = oB; x < iB; ++x)
+                    BilinearInterpEdge<T, N>(x, y, p.inv, w, h, s, src, fill ? brd : row + x * N, row + x * N);
+                for (int x = iB; x < iE; ++x)
+                {
+                    uint32_t offs;
+                    float fx, fy;
+                    BilinearPrepMain(x, y, p.inv, P, s, &offs, &fx, &fy);
+                    BilinearInterpMain<T, N>(src, s, offs, fx, fy, row + x * N);
+                }
+                for (int x = iE; x < oE; ++x)
+                    BilinearInterpEdge<T, N>(x, y, p.inv, w, h, s, src, fill ? brd : row + x * N, row + x * N);
+                if (fill)
+                    FillBorder<P>(dst + oE * P, width - oE, p.border);
+                dst += p.dstS;
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        WarpAffineBilinear::WarpAffineBilinear(const WarpAffParam& param)
             : WarpAffine(param)
         {
-            switch (_param.channels)
+            if (_param.IsByte())
             {
-            case 1: _run = ByteBilinearRun<1>; break;
-            case 2: _run = ByteBilinearRun<2>; break;
-            case 3: _run = ByteBilinearRun<3>; break;
-            case 4: _run = ByteBilinearRun<4>; break;
+                switch (_param.channels)
+                {
+                case 1: _run = ByteBilinearRun<1>; break;
+                case 2: _run = ByteBilinearRun<2>; break;
+                case 3: _run = ByteBilinearRun<3>; break;
+                case 4: _run = ByteBilinearRun<4>; break;
+                }
+            }
+            else if (_param.IsShort())
+            {
+                switch (_param.channels)
+                {
+                case 1: _run = BilinearRun<uint16_t, 1>; break;
+                case 2: _run = BilinearRun<uint16_t, 2>; break;
+                case 3: _run = BilinearRun<uint16_t, 3>; break;
+                case 4: _run = BilinearRun<uint16_t, 4>; break;
+                }
+            }
+            else
+            {
+                switch (_param.channels)
+                {
+                case 1: _run = BilinearRun<float, 1>; break;
+                case 2: _run = BilinearRun<float, 2>; break;
+                case 3: _run = BilinearRun<float, 3>; break;
+                case 4: _run = BilinearRun<float, 4>; break;
+                }
             }
         }
 
-        void WarpAffineByteBilinear::Run(const uint8_t* src, uint8_t* dst)
+        void WarpAffineBilinear::Run(const uint8_t* src, uint8_t* dst)
         {
             if (_first)
                 Init();
@@ -297,7 +351,7 @@ namespace Simd
             _first = false;
         }
 
-        void WarpAffineByteBilinear::Init()
+        void WarpAffineBilinear::Init()
         {
             const WarpAffParam& p = _param;
             _range.Resize(p.dstH * 4);
@@ -306,7 +360,7 @@ namespace Simd
             _ob = _range.data + 2 * p.dstH;
             _oe = _range.data + 3 * p.dstH;
             size_t na = (p.channels == 3 ? 4 : p.channels), wa = AlignHi(p.dstW, p.align) + p.align;
-            _size = Simd::Max(wa * 10 + wa * na * 4, p.dstH * 8);
+            _size = Simd::Max(p.IsByte() ? wa * 10 + wa * na * 4 : wa * 12, p.dstH * 8);
             _buf.Resize(_size * _threads);
             float z, h, w, e = 0.0001f;
             Point rect[4];
@@ -324,7 +378,7 @@ namespace Simd
             SetRange(rect, _ib, _ie, _ob, _oe);
         }
 
-        void WarpAffineByteBilinear::SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi)
+        void WarpAffineBilinear::SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi)
         {
             const WarpAffParam& p = _param;
             float* min = (float*)_buf.data;
@@ -379,8 +433,8 @@ namespace Simd
                 return NULL;
             if (param.IsNearest())
                 return new WarpAffineNearest(param);
-            else if (param.IsByteBilinear())
-                return new WarpAffineByteBilinear(param);
+            else if (param.IsBilinear())
+                return new WarpAffineBilinear(param);
             else
                 return NULL;
         }
@@ -0,0 +1,130 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdWarpAffine.h"
+#include "Simd/SimdBase.h"
+
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        static void Convert8uTo32f(const uint8_t* src, size_t size, const float* scale, const float* shift, float* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = float(src[i]) * scale[i] + shift[i];
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        WarpAffineBatch::WarpAffineBatch(const WarpAffParam& param, SimdTensorDataType type, const float* mean, const float* std)
+            : _param(param)
+            , _type(type)
+            , _threads(Base::GetThreadNumber())
+        {
+            const WarpAffParam& p = _param;
+            _rowSize = p.dstW * p.channels;
+            _dstSize = p.dstH * _rowSize;
+            if (_type != SimdTensorData8u)
+            {
+                _scale.Resize(_rowSize);
+                _shift.Resize(_rowSize);
+                for (size_t i = 0; i < _rowSize; ++i)
+                {
+                    size_t c = i % p.channels;
+                    float m = mean ? mean[c] : 0.0f, s = std ? std[c] : 1.0f;
+                    _scale[i] = 1.0f / s;
+                    _shift[i] = -m / s;
+                }
+                _dst8u.Resize(_dstSize * _threads);
+                if (_type == SimdTensorData16b)
+                    _dst32f.Resize(_rowSize * _threads);
+            }
+            _convert8uTo32f = Base::Convert8uTo32f;
+            _float32ToBFloat16 = Base::Float32ToBFloat16;
+            SetWarps(Base::WarpAffineInit);
+        }
+
+        WarpAffineBatch::~WarpAffineBatch()
+        {
+            for (size_t i = 0; i < _warps.size(); ++i)
+                delete _warps[i];
+        }
+
+        void WarpAffineBatch::Run(const uint8_t* src, const float* mats, size_t batch, uint8_t* dst)
+        {
+            Simd::Parallel(0, batch, [&](size_t thread, size_t begin, size_t end)
+            {
+                WarpAffine* warp = _warps[thread];
+                for (size_t b = begin; b < end; ++b)
+                {
+                    warp->SetMatrix(mats + 6 * b);
+                    if (_type == SimdTensorData8u)
+                        warp->Run(src, dst + b * _dstSize);
+                    else
+                    {
+                        uint8_t* dst8u = _dst8u.data + thread * _dstSize;
+                        warp->Run(src, dst8u);
+                        for (size_t y = 0, offs = b * _dstSize; y < _param.dstH; ++y, offs += _rowSize, dst8u += _rowSize)
+                        {
+                            if (_type == SimdTensorData32f)
+                                _convert8uTo32f(dst8u, _rowSize, _scale.data, _shift.data, (float*)dst + offs);
+                            else
+                            {
+                                float* dst32f = _dst32f.data + thread * _rowSize;
+                                _convert8uTo32f(dst8u, _rowSize, _scale.data, _shift.data, dst32f);
+                                _float32ToBFloat16(dst32f, _rowSize, (uint16_t*)dst + offs);
+                            }
+                        }
+                    }
+                }
+            }, _threads, 1);
+        }
+
+        void WarpAffineBatch::SetWarps(WarpAffineInitPtr init)
+        {
+            const WarpAffParam& p = _param;
+            for (size_t i = 0; i < _warps.size(); ++i)
+                delete _warps[i];
+            _warps.resize(_threads);
+            for (size_t i = 0; i < _threads; ++i)
+            {
+                _warps[i] = (WarpAffine*)init(p.srcW, p.srcH, p.srcS, p.dstW, p.dstH, _rowSize, p.channels, p.mat, p.flags, p.border);
+                _warps[i]->SetThreads(1);
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels,
+            SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* mean, const float* std)
+        {
+            const float mat[6] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstW * channels, channels, mat, flags, border, 1);
+            if (!WarpAffineBatch::Valid(param, type))
+                return NULL;
+            return new WarpAffineBatch(param, type, mean, std);
+        }
+    }
+}
@@ -0,0 +1,68 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdConnectedComponents_h__
+#define __SimdConnectedComponents_h__
+
+#include "Simd/SimdDefs.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Simd
+{
+    namespace Base
+    {
+        typedef void (*CcMaskRowPtr)(const uint8_t* src, size_t width, uint8_t threshold, uint64_t* dst);
+        typedef uint64_t (*CcSumRowPtr)(const uint8_t* src, size_t size);
+
+        struct CcOps
+        {
+            CcMaskRowPtr maskRow;
+            CcSumRowPtr sumRow;
+        };
+
+        size_t ConnectedComponents(const CcOps& ops, const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t threshold,
+            SimdConnectedComponentsFlags flags, uint32_t* labels, size_t labelsStride, SimdConnectedComponentStat* stats, size_t capacity);
+
+        SIMD_INLINE size_t CcTrailingZeros(uint64_t value)
+        {
+            assert(value);
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+            unsigned long index;
+            _BitScanForward64(&index, value);
+            return index;
+#elif defined(__GNUC__)
+            return __builtin_ctzll(value);
+#else
+            size_t index = 0;
+            while ((value & 1) == 0)
+                value >>= 1, index++;
+            return index;
+#endif
+        }
+    }
+}
+
+#endif
@@ -30,6 +30,7 @@
 
 #include <vector>
 #include <map>
+#include <algorithm>
 #include <memory>
 
 #include <limits.h>
@@ -308,10 +309,13 @@ namespace Simd
             \param [in] motionMask - an using of motion detection flag. Useful for dynamical restriction of detection region to addition to ROI.
             \param [in] motionRegions - a set of rectangles (motion regions) to restrict detection region to addition to ROI.
                                         The regions affect to the center of detected object.
+            \param [in] overlapMax - a maximal IoU (intersection over union) of two detected objects with the same tag.
+                                     If it is less than 1 then excess overlapped objects with smaller weight are removed
+                                     with using of non-maximum suppression (see ::SimdDetectionNms32f). By default it is disabled.
             \return a result of this operation.
         */
         bool Detect(const View & src, Objects & objects, int groupSizeMin = 3, double sizeDifferenceMax = 0.2,
-            bool motionMask = false, const Rects & motionRegions = Rects())
+            bool motionMask = false, const Rects & motionRegions = Rects(), double overlapMax = 1.0)
         {
             SIMD_CHECK_PERFORMANCE();
 
@@ -348,7 +352,12 @@ namespace Simd
 
             objects.clear();
             for (typename Candidates::iterator it = candidates.begin(); it != candidates.end(); ++it)
+            {
+                size_t begin = objects.size();
                 GroupObjects(objects, it->second, groupSizeMin, sizeDifferenceMax);
+                if (overlapMax < 1.0)
+                    SuppressObjects(objects, begin, overlapMax);
+            }
 
             return true;
         }
@@ -735,6 +744,29 @@ namespace Simd
                     dst.push_back(buffer[i]);
             }
         }
+
+        void SuppressObjects(Objects & objects, size_t begin, double overlapMax)
+        {
+            size_t size = objects.size() - begin;
+            if (size < 2)
+                return;
+            std::vector<float> boxes(size * 4), scores(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                const Object & object = objects[begin + i];
+                boxes[i * 4 + 0] = (float)object.rect.left;
+                boxes[i * 4 + 1] = (float)object.rect.top;
+                boxes[i * 4 + 2] = (float)object.rect.right;
+                boxes[i * 4 + 3] = (float)object.rect.bottom;
+                scores[i] = (float)object.weight;
+            }
+            std::vector<uint32_t> keep(size);
+            size_t count = SimdDetectionNms32f(boxes.data(), scores.data(), NULL, size, (float)overlapMax, 0.0f, 0.0f, keep.data(), NULL);
+            std::sort(keep.begin(), keep.begin() + count);
+            for (size_t i = 0; i < count; ++i)
+                objects[begin + i] = objects[begin + keep[i]];
+            objects.resize(begin + count);
+        }
     };
 }
 
@@ -0,0 +1,116 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdDetectionNms_h__
+#define __SimdDetectionNms_h__
+
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+#include <float.h>
+
+namespace Simd
+{
+    namespace Base
+    {
+        struct NmsBuffer
+        {
+            float* x0, * y0, * x1, * y1, * area, * label, * score;
+            uint32_t* index;
+
+            void Resize(size_t size)
+            {
+                _data.Resize(size * 7);
+                _index.Resize(size);
+                x0 = _data.data + 0 * size;
+                y0 = _data.data + 1 * size;
+                x1 = _data.data + 2 * size;
+                y1 = _data.data + 3 * size;
+                area = _data.data + 4 * size;
+                label = _data.data + 5 * size;
+                score = _data.data + 6 * size;
+                index = _index.data;
+            }
+
+            void Swap(size_t i, size_t j)
+            {
+                std::swap(x0[i], x0[j]);
+                std::swap(y0[i], y0[j]);
+                std::swap(x1[i], x1[j]);
+                std::swap(y1[i], y1[j]);
+                std::swap(area[i], area[j]);
+                std::swap(label[i], label[j]);
+                std::swap(score[i], score[j]);
+                std::swap(index[i], index[j]);
+            }
+
+        private:
+            Array32f _data;
+            Array32u _index;
+        };
+
+        typedef size_t(*DetectionFilterScoresPtr)(const float* scores, size_t size, float threshold, uint32_t* indices);
+        typedef void(*DetectionSuppressPtr)(const NmsBuffer& buf, size_t curr, size_t begin, size_t end, float iouThreshold, float sigma, bool labeled);
+        typedef size_t(*DetectionArgMaxPtr)(const float* src, size_t size);
+
+        SIMD_INLINE size_t ArgMax(const float* src, size_t size)
+        {
+            size_t idx = 0;
+            for (size_t i = 1; i < size; ++i)
+                if (src[i] > src[idx])
+                    idx = i;
+            return idx;
+        }
+
+        SIMD_INLINE void DetectionSuppress(const NmsBuffer& buf, size_t curr, size_t begin, size_t end, float iouThreshold, float sigma, bool labeled)
+        {
+            float x0 = buf.x0[curr], y0 = buf.y0[curr], x1 = buf.x1[curr], y1 = buf.y1[curr];
+            float area = buf.area[curr], label = buf.label[curr];
+            for (size_t j = begin; j < end; ++j)
+            {
+                if (labeled && buf.label[j] != label)
+                    continue;
+                float w = Simd::Max(Simd::Min(x1, buf.x1[j]) - Simd::Max(x0, buf.x0[j]), 0.0f);
+                float h = Simd::Max(Simd::Min(y1, buf.y1[j]) - Simd::Max(y0, buf.y0[j]), 0.0f);
+                float inter = w * h;
+                float uni = area + buf.area[j] - inter;
+                if (sigma > 0.0f)
+                {
+                    float iou = uni > 0.0f ? inter / uni : 0.0f;
+                    buf.score[j] *= ::expf(-iou * iou / sigma);
+                }
+                else if (inter > iouThreshold * uni)
+                    buf.score[j] = -FLT_MAX;
+            }
+        }
+
+        size_t DetectionDecodeYolo32f(const float* src, size_t height, size_t width, size_t anchors, size_t classes, const float* anchorSizes,
+            float threshold, float* boxes, float* scores, uint32_t* labels, size_t capacity, DetectionArgMaxPtr argMax);
+
+        size_t DetectionNms32f(const float* boxes, const float* scores, const uint32_t* labels, size_t size, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* keepScores, DetectionFilterScoresPtr filterScores, DetectionSuppressPtr suppress);
+    }
+}
+
+#endif
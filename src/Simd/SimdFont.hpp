@@ -26,10 +26,13 @@
 
 #include "Simd/SimdLib.hpp"
 #include "Simd/SimdDrawing.hpp"
+#include "Simd/SimdFrame.hpp"
 
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <map>
+#include <memory>
 
 namespace Simd
 {
@@ -66,6 +69,7 @@ namespace Simd
         typedef std::string String; /*!< String type definition. */
         typedef Simd::Point<ptrdiff_t> Point; /*!< Point type definition. */
         typedef Simd::View<Simd::Allocator> View; /*!< Image time definition. */
+        typedef Simd::Frame<Simd::Allocator> Frame; /*!< Frame type definition. */
 
         /*!
             Creates a new Font class with given height.
@@ -83,13 +87,16 @@ namespace Simd
         /*!
             Sets a new height value to font.
 
+            \note Glyphs of every used height are rendered once into an atlas (anti-aliased 8-bit alpha masks) and are kept in the cache.
+                So switching between a few heights is cheap.
+
             \param [in] height - a new height value. 
 
             \return a result of the operation.
         */
         bool Resize(size_t height)
         {
-            if (height == _currentSize.y)
+            if (height == (size_t)_currentSize.y)
                 return true;
 
             if (height < 4u || height > (size_t)_originalSize.y*4)
@@ -100,25 +107,10 @@ namespace Simd
             _currentIndent.x = height*_originalIndent.x / _originalSize.y;
             _currentIndent.y = height*_originalIndent.y / _originalSize.y;
 
-            size_t level = 0;
-            for (; (height << (level + 1)) < (size_t)_originalSize.y; level++);
-            Point size = _currentSize << level;
-
-            _currentSymbols.resize(_originalSymbols.size());
-            for (size_t i = 0; i < _originalSymbols.size(); ++i)
-            {
-                _currentSymbols[i].value = _originalSymbols[i].value;
-                _currentSymbols[i].image.Recreate(_currentSize, View::Gray8);
-                if (level)
-                {
-                    Pyramid pyramid(size, level + 1);
-                    Simd::Resize(_originalSymbols[i].image, pyramid[0], SimdResizeMethodBilinear);
-                    Simd::Build(pyramid, SimdReduce2x2);
-                    Simd::Copy(pyramid[level], _currentSymbols[i].image);
-                }
-                else
-                    Simd::Resize(_originalSymbols[i].image, _currentSymbols[i].image, SimdResizeMethodBilinear);
-            }
+            Atlases::const_iterator it = _atlases.find(height);
+            if (it == _atlases.end())
+                it = _atlases.insert(Atlases::value_type(height, CreateAtlas())).first;
+            _atlas = it->second;
 
             return true;
         }
@@ -217,6 +209,129 @@ namespace Simd
             return Draw(region, text, Point(0, 0), color);
         }
 
+        /*!
+            Draws a text at the frame. It draws the text directly at the planes of the frame without its conversion.
+
+            \note Supported frame formats: Gray8, Bgr24, Bgra32, Rgb24, Rgba32, Nv12, Yuv420p and Yuv444p.
+                Chroma planes of Nv12 and Yuv420p frames are blended with 2x2 reduced alpha mask of the text.
+
+            \param [out] canvas - a canvas (frame where we draw text).
+            \param [in] text - a text to draw.
+            \param [in] position - a start position to draw text.
+            \param [in] color - a color of the text.
+
+            \return a result of the operation.
+        */
+        bool Draw(Frame & canvas, const String & text, const Point & position, const Simd::Pixel::Bgr24 & color) const
+        {
+            View alpha;
+            Rect canvasRect, alphaRect;
+            CreateAlpha(text, Rect(canvas.Size()), position, alpha, canvasRect, alphaRect);
+            if (alpha.Area() == 0)
+                return true;
+            View mask = alpha.Region(alphaRect);
+
+            switch (canvas.format)
+            {
+            case Frame::Gray8:
+            {
+                uint8_t gray;
+                ::SimdBgrToGray(&color.blue, 1, 1, 3, &gray, 1);
+                Fill(canvas.planes[0], canvasRect, &gray, 1, mask);
+                return true;
+            }
+            case Frame::Bgr24:
+                Fill(canvas.planes[0], canvasRect, &color.blue, 3, mask);
+                return true;
+            case Frame::Bgra32:
+            {
+                uint8_t bgra[4] = { color.blue, color.green, color.red, 0xFF };
+                Fill(canvas.planes[0], canvasRect, bgra, 4, mask);
+                return true;
+            }
+            case Frame::Rgb24:
+            {
+                uint8_t rgb[3] = { color.red, color.green, color.blue };
+                Fill(canvas.planes[0], canvasRect, rgb, 3, mask);
+                return true;
+            }
+            case Frame::Rgba32:
+            {
+                uint8_t rgba[4] = { color.red, color.green, color.blue, 0xFF };
+                Fill(canvas.planes[0], canvasRect, rgba, 4, mask);
+                return true;
+            }
+            case Frame::Nv12:
+            case Frame::Yuv420p:
+            case Frame::Yuv444p:
+            {
+                uint8_t bgr[12], y[4], u, v;
+                for (size_t i = 0; i < 4; ++i)
+                    bgr[i * 3 + 0] = color.blue, bgr[i * 3 + 1] = color.green, bgr[i * 3 + 2] = color.red;
+                ::SimdBgrToYuv420pV2(bgr, 6, 2, 2, y, 2, &u, 1, &v, 1, canvas.yuvType == SimdYuvUnknown ? SimdYuvBt601 : canvas.yuvType);
+                Fill(canvas.planes[0], canvasRect, y, 1, mask);
+                if (canvas.format == Frame::Yuv444p)
+                {
+                    Fill(canvas.planes[1], canvasRect, &u, 1, mask);
+                    Fill(canvas.planes[2], canvasRect, &v, 1, mask);
+                    return true;
+                }
+
+                Rect uvRect(canvasRect.left / 2, canvasRect.top / 2, (canvasRect.right + 1) / 2, (canvasRect.bottom + 1) / 2);
+                uvRect &= Rect(canvas.planes[1].Size());
+                if (uvRect.Empty())
+                    return true;
+                View padded(uvRect.Width() * 2, uvRect.Height() * 2, View::Gray8), reduced(uvRect.Size(), View::Gray8);
+                Simd::Fill(padded, 0);
+                Rect maskRect = Rect(mask.Size()).Shifted(canvasRect.TopLeft() - uvRect.TopLeft() * 2).Intersection(Rect(padded.Size()));
+                Simd::Copy(mask.Region(maskRect.Shifted(uvRect.TopLeft() * 2 - canvasRect.TopLeft())), padded.Region(maskRect).Ref());
+                ::SimdReduceGray2x2(padded.data, padded.width, padded.height, padded.stride, reduced.data, reduced.width, reduced.height, reduced.stride);
+                if (canvas.format == Frame::Nv12)
+                {
+                    uint8_t uv[2] = { u, v };
+                    Fill(canvas.planes[1], uvRect, uv, 2, reduced);
+                }
+                else
+                {
+                    Fill(canvas.planes[1], uvRect, &u, 1, reduced);
+                    Fill(canvas.planes[2], uvRect, &v, 1, reduced);
+                }
+                return true;
+            }
+            default:
+                return false;
+            }
+        }
+
+        /*!
+            Creates an alpha mask (8-bit gray image) of given text. It can be used to draw the text later (see Simd::Overlay).
+
+            \param [in] text - a text to draw.
+            \param [out] mask - an output 8-bit gray mask. Its size is equal to result of Font::Measure.
+
+            \return a result of the operation.
+        */
+        bool CreateMask(const String & text, View & mask) const
+        {
+            Point size = Measure(text);
+            if (size.x == 0 || size.y == 0)
+            {
+                mask.Clear();
+                return true;
+            }
+            mask.Recreate(size, View::Gray8);
+            Simd::Fill(mask, 0);
+
+            View alpha;
+            Rect canvasRect, alphaRect;
+            CreateAlpha(text, Rect(size), Point(0, 0), alpha, canvasRect, alphaRect);
+
+            if (alpha.Area())
+                Simd::Copy(alpha.Region(alphaRect), mask.Region(canvasRect).Ref());
+
+            return true;
+        }
+
     private:
         typedef Simd::Rectangle<ptrdiff_t> Rect;
         typedef std::vector<Rect> Rects;
@@ -230,10 +345,50 @@ namespace Simd
         };
         typedef std::vector<Symbol> Symbols;
 
-        Symbols _originalSymbols, _currentSymbols;
+        typedef std::shared_ptr<View> AtlasPtr;
+        typedef std::map<size_t, AtlasPtr> Atlases;
+
+        Symbols _originalSymbols;
+        Atlases _atlases;
+        AtlasPtr _atlas;
         Point _originalSize, _currentSize, _originalIndent, _currentIndent;
         char _symbolMin, _symbolMax;
 
+        AtlasPtr CreateAtlas() const
+        {
+            AtlasPtr atlas(new View(_currentSize.x * _originalSymbols.size(), _currentSize.y, View::Gray8));
+
+            size_t level = 0;
+            for (; (_currentSize.y << (level + 1)) < _originalSize.y; level++);
+            Point size = _currentSize << level;
+
+            for (size_t i = 0; i < _originalSymbols.size(); ++i)
+            {
+                View glyph = atlas->Region(Glyph(i));
+                if (level)
+                {
+                    Pyramid pyramid(size, level + 1);
+                    Simd::Resize(_originalSymbols[i].image, pyramid[0], SimdResizeMethodBilinear);
+                    Simd::Build(pyramid, SimdReduce2x2);
+                    Simd::Copy(pyramid[level], glyph);
+                }
+                else
+                    Simd::Resize(_originalSymbols[i].image, glyph, SimdResizeMethodBilinear);
+            }
+            return atlas;
+        }
+
+        SIMD_INLINE Rect Glyph(size_t index) const
+        {
+            return Rect(index * _currentSize.x, 0, (index + 1) * _currentSize.x, _currentSize.y);
+        }
+
+        static void Fill(View & plane, const Rect & rect, const uint8_t * channel, size_t channelCount, const View & alpha)
+        {
+            ::SimdAlphaFilling(plane.data + rect.top * plane.stride + rect.left * channelCount, plane.stride, rect.Width(), rect.Height(),
+                channel, channelCount, alpha.data, alpha.stride);
+        }
+
         void CreateAlpha(const String & text, const Rect & canvas, const Point & shift, View & alpha, Rect & canvasRect, Rect & alphaRect) const
         {
             Rects rects;
@@ -266,7 +421,7 @@ namespace Simd
             alpha.Recreate(alphaRect.Size(), View::Gray8);
             Simd::Fill(alpha, 0);
             for (size_t i = 0; i < symbols.size(); ++i)
-                Simd::Copy(_currentSymbols[symbols[i] - _symbolMin].image, alpha.Region(rects[i].Shifted(-alphaRect.TopLeft())).Ref());
+                Simd::Copy(_atlas->Region(Glyph(symbols[i] - _symbolMin)), alpha.Region(rects[i].Shifted(-alphaRect.TopLeft())).Ref());
             Rect old = canvasRect;
             canvasRect &= canvas;
             alphaRect.Shift(-alphaRect.TopLeft());
@@ -425,6 +425,21 @@ namespace Simd
     */
     template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst);
 
+    /*! @ingroup cpp_frame_functions
+
+        \fn template <template<class> class A> void NormalizeHistogramAdaptive(Frame<A> & frame, size_t tilesX, size_t tilesY, float clipLimit);
+
+        \short Performs contrast limited adaptive histogram equalization (CLAHE) of frame brightness in place.
+
+        The frame must have Gray8, NV12 or YUV420P format (only gray or Y plane is processed). See also ::SimdNormalizeHistogramAdaptive.
+
+        \param [in, out] frame - a processed frame.
+        \param [in] tilesX - a number of tiles in horizontal direction.
+        \param [in] tilesY - a number of tiles in vertical direction.
+        \param [in] clipLimit - a clip limit of tile histogram (relative to mean height of histogram bin).
+    */
+    template <template<class> class A> void NormalizeHistogramAdaptive(Frame<A> & frame, size_t tilesX, size_t tilesY, float clipLimit);
+
     //-------------------------------------------------------------------------------------------------
 
     // struct Frame implementation:
@@ -1365,6 +1380,13 @@ namespace Simd
             assert(0);
         }
     }
+
+    template <template<class> class A> SIMD_INLINE void NormalizeHistogramAdaptive(Frame<A> & frame, size_t tilesX, size_t tilesY, float clipLimit)
+    {
+        assert(frame.format == Frame<A>::Gray8 || frame.format == Frame<A>::Nv12 || frame.format == Frame<A>::Yuv420p);
+
+        NormalizeHistogramAdaptive(frame.planes[0], tilesX, tilesY, clipLimit, frame.planes[0]);
+    }
 }
 
 #endif
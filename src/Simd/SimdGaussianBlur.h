@@ -37,10 +37,33 @@ namespace Simd
         size_t channels;
         float sigma;
         float epsilon;
+        SimdGaussianBlurFlags flags;
         size_t align;
 
-        BlurParam(size_t w, size_t h, size_t c, const float* s, const float * e, size_t a);
+        BlurParam(size_t w, size_t h, size_t c, const float* s, const float * e, SimdGaussianBlurFlags f, size_t a);
         bool Valid() const;
+
+        SIMD_INLINE SimdGaussianBlurFlags Channel() const
+        {
+            return SimdGaussianBlurFlags(flags & SimdGaussianBlurChannelMask);
+        }
+
+        SIMD_INLINE SimdGaussianBlurFlags Engine() const
+        {
+            return SimdGaussianBlurFlags(flags & SimdGaussianBlurEngineMask);
+        }
+
+        SIMD_INLINE size_t ChannelSize() const
+        {
+            return Channel() == SimdGaussianBlurChannelByte ? 1 : (Channel() == SimdGaussianBlurChannelShort ? 2 : 4);
+        }
+
+        SIMD_INLINE size_t Half() const
+        {
+            return (size_t)::floor(::sqrt(-::log(epsilon)) * sigma);
+        }
+
+        bool IsRecursive() const;
     };
 
     class GaussianBlur : Deletable
@@ -52,6 +75,7 @@ namespace Simd
 
     protected:
         BlurParam _param;
+        size_t _threads;
     };
 
     namespace Base
@@ -65,15 +89,57 @@ namespace Simd
                 Base::CopyPixel<channels>(src, dst);
         }
 
+        template<class T> SIMD_INLINE T BlurCast(float value);
+
+        template<> SIMD_INLINE uint8_t BlurCast<uint8_t>(float value)
+        {
+            return (uint8_t)RestrictRange(Round(value), 0, 0xFF);
+        }
+
+        template<> SIMD_INLINE uint16_t BlurCast<uint16_t>(float value)
+        {
+            return (uint16_t)RestrictRange(Round(value), 0, 0xFFFF);
+        }
+
+        template<> SIMD_INLINE float BlurCast<float>(float value)
+        {
+            return value;
+        }
+
         //---------------------------------------------------------------------
 
         struct AlgDefault
         {
-            size_t half, kernel, edge, start, size, stride, nose, body;
+            size_t half, kernel, edge, start, size, stride;
             Array32f weight;
         };
 
-        typedef void (*BlurDefaultPtr)(const BlurParam& p, const AlgDefault& a, const uint8_t* src, 
+        /* Blurs output rows [yBeg, yEnd). Rows outside of the image are replicated, so every row band is independent 
+           and costs 2*half extra horizontal passes. Blur::Cols performs horizontal pass of padded row, Blur::Rows 
+           combines kernel rows of ring buffer (weight is shifted to match the ring position). */
+        template<class T, int channels, class Blur> void BlurImage(const BlurParam& p, const AlgDefault& a, size_t yBeg, size_t yEnd,
+            const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        {
+            const ptrdiff_t beg = yBeg - a.half, end = yEnd + a.half, last = p.height - 1;
+            for (ptrdiff_t sy = beg, b = 0; sy < end; ++sy)
+            {
+                float* curr = rows + b * a.stride;
+                if (sy == beg || (sy > 0 && sy <= last))
+                {
+                    PadCols<channels * sizeof(T)>(src + Simd::RestrictRange<ptrdiff_t>(sy, 0, last) * srcStride, a.half, a.size * sizeof(T), cols);
+                    Blur::Cols(a, (T*)cols, channels, curr);
+                }
+                else
+                    memcpy(curr, rows + (b ? b - 1 : a.kernel - 1) * a.stride, a.size * sizeof(float));
+                if (++b == (ptrdiff_t)a.kernel)
+                    b = 0;
+                ptrdiff_t dy = sy - a.half;
+                if (dy >= (ptrdiff_t)yBeg)
+                    Blur::Rows(a, rows, a.weight.data + (a.kernel - (dy - yBeg) % a.kernel) % a.kernel, (T*)(dst + dy * dstStride));
+            }
+        }
+
+        typedef void (*BlurDefaultPtr)(const BlurParam& p, const AlgDefault& a, size_t yBeg, size_t yEnd, const uint8_t* src, 
             size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride);
 
         class GaussianBlurDefault : public Simd::GaussianBlur
@@ -85,12 +151,62 @@ namespace Simd
 
         protected:
             AlgDefault _alg;
+            size_t _colsSize, _rowsSize;
             Array8u _cols;
             Array32f _rows;
             BlurDefaultPtr _blur;
         };
 
-        void * GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+        //---------------------------------------------------------------------
+
+        struct AlgRecursive
+        {
+            size_t size, stride;
+            float b, a1, a2, a3;
+        };
+
+        typedef void (*RecursiveColsPtr)(const BlurParam& p, const AlgRecursive& a, size_t yBeg, size_t yEnd, const uint8_t* src, size_t srcStride, float* buf);
+        typedef void (*RecursiveRowsPtr)(const BlurParam& p, const AlgRecursive& a, size_t xBeg, size_t xEnd, float* buf, uint8_t* dst, size_t dstStride);
+
+        template<class T, int channels> void RecursiveCols(const BlurParam& p, const AlgRecursive& a, size_t yBeg, size_t yEnd, const uint8_t* src, size_t srcStride, float* buf)
+        {
+            for (size_t y = yBeg; y < yEnd; ++y)
+            {
+                const T* ps = (const T*)(src + y * srcStride);
+                float* pb = buf + y * a.stride;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    float y1 = float(ps[c]), y2 = y1, y3 = y1;
+                    for (size_t i = c; i < a.size; i += channels)
+                    {
+                        float y0 = a.b * float(ps[i]) + a.a1 * y1 + a.a2 * y2 + a.a3 * y3;
+                        pb[i] = y0, y3 = y2, y2 = y1, y1 = y0;
+                    }
+                    y1 = pb[a.size - channels + c], y2 = y1, y3 = y1;
+                    for (ptrdiff_t i = a.size - channels + c; i >= 0; i -= channels)
+                    {
+                        float y0 = a.b * pb[i] + a.a1 * y1 + a.a2 * y2 + a.a3 * y3;
+                        pb[i] = y0, y3 = y2, y2 = y1, y1 = y0;
+                    }
+                }
+            }
+        }
+
+        class GaussianBlurRecursive : public Simd::GaussianBlur
+        {
+        public:
+            GaussianBlurRecursive(const BlurParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            AlgRecursive _alg;
+            Array32f _buf;
+            RecursiveColsPtr _blurCols;
+            RecursiveRowsPtr _blurRows;
+        };
+
+        void * GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -102,7 +218,13 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+        class GaussianBlurRecursive : public Base::GaussianBlurRecursive
+        {
+        public:
+            GaussianBlurRecursive(const BlurParam& param);
+        };
+
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
     }
 #endif //SIMD_SSE41_ENABLE
 
@@ -115,7 +237,13 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+        class GaussianBlurRecursive : public Sse41::GaussianBlurRecursive
+        {
+        public:
+            GaussianBlurRecursive(const BlurParam& param);
+        };
+
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
     }
 #endif //SIMD_AVX2_ENABLE
 
@@ -128,7 +256,7 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
     }
 #endif //SIMD_AVX512BW_ENABLE
 
@@ -141,7 +269,7 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
     }
 #endif //SIMD_NEON_ENABLE
 }
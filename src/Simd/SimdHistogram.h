@@ -0,0 +1,49 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdHistogram_h__
+#define __SimdHistogram_h__
+
+#include "Simd/SimdDefs.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void AdaptiveHistogramLuts(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t tilesX, size_t tilesY, float clipLimit, float* luts);
+
+        void AdaptiveHistogramCols(size_t width, size_t tilesX, int32_t* index0, int32_t* index1, float* weight);
+
+        SIMD_INLINE void AdaptiveHistogramRow(size_t y, size_t height, size_t tilesY, size_t tilesX, size_t& offset0, size_t& offset1, float& weight)
+        {
+            float pos = float(y) * float(tilesY) / float(height) - 0.5f;
+            ptrdiff_t tile = (ptrdiff_t)::floor(pos);
+            weight = pos - float(tile);
+            offset0 = Simd::Max<ptrdiff_t>(tile, 0) * tilesX * 256;
+            offset1 = Simd::Min<ptrdiff_t>(tile + 1, tilesY - 1) * tilesX * 256;
+        }
+    }
+}
+
+#endif
@@ -69,8 +69,10 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdImageLoad.h"
 #include "Simd/SimdImageSave.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
+#include "Simd/SimdRemap.h"
 #include "Simd/SimdResizer.h"
 #include "Simd/SimdSynetAdd16b.h"
+#include "Simd/SimdSynetCalibration.h"
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetConvolution16b.h"
 #include "Simd/SimdSynetConvolution8i.h"
@@ -89,6 +91,8 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdSynetQuantizedMergedConvolution.h"
 #include "Simd/SimdSynetScale8i.h"
 #include "Simd/SimdSynetScale16b.h"
+#include "Simd/SimdSynetWorkspace.h"
+#include "Simd/SimdSynetWeightCache.h"
 #include "Simd/SimdWarpAffine.h"
 
 #include "Simd/SimdBase.h"
@@ -2040,6 +2044,46 @@ SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask,
         Base::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
+SIMD_API void SimdDetectionDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t size, SimdBool clip, float* dst)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdDetectionDecodeSsd32fPtr) (const float* loc, const float* prior, const float* variance, size_t size, SimdBool clip, float* dst);
+    const static SimdDetectionDecodeSsd32fPtr simdDetectionDecodeSsd32f = SIMD_FUNC3(DetectionDecodeSsd32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdDetectionDecodeSsd32f(loc, prior, variance, size, clip, dst);
+}
+
+SIMD_API size_t SimdDetectionDecodeYolo32f(const float* src, size_t height, size_t width, size_t anchors, size_t classes, const float* anchorSizes,
+    float threshold, float* boxes, float* scores, uint32_t* labels, size_t capacity)
+{
+    SIMD_EMPTY();
+    typedef size_t(*SimdDetectionDecodeYolo32fPtr) (const float* src, size_t height, size_t width, size_t anchors, size_t classes, const float* anchorSizes,
+        float threshold, float* boxes, float* scores, uint32_t* labels, size_t capacity);
+    const static SimdDetectionDecodeYolo32fPtr simdDetectionDecodeYolo32f = SIMD_FUNC3(DetectionDecodeYolo32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdDetectionDecodeYolo32f(src, height, width, anchors, classes, anchorSizes, threshold, boxes, scores, labels, capacity);
+}
+
+SIMD_API size_t SimdDetectionFilterScores32f(const float* scores, size_t size, float threshold, uint32_t* indices)
+{
+    SIMD_EMPTY();
+    typedef size_t(*SimdDetectionFilterScores32fPtr) (const float* scores, size_t size, float threshold, uint32_t* indices);
+    const static SimdDetectionFilterScores32fPtr simdDetectionFilterScores32f = SIMD_FUNC3(DetectionFilterScores32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdDetectionFilterScores32f(scores, size, threshold, indices);
+}
+
+SIMD_API size_t SimdDetectionNms32f(const float* boxes, const float* scores, const uint32_t* labels, size_t size, float iouThreshold, float sigma,
+    float scoreThreshold, uint32_t* indices, float* keepScores)
+{
+    SIMD_EMPTY();
+    typedef size_t(*SimdDetectionNms32fPtr) (const float* boxes, const float* scores, const uint32_t* labels, size_t size, float iouThreshold, float sigma,
+        float scoreThreshold, uint32_t* indices, float* keepScores);
+    const static SimdDetectionNms32fPtr simdDetectionNms32f = SIMD_FUNC3(DetectionNms32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdDetectionNms32f(boxes, scores, labels, size, iouThreshold, sigma, scoreThreshold, indices, keepScores);
+}
+
 SIMD_API void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value)
 {
     SIMD_EMPTY();
@@ -2425,12 +2469,17 @@ SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t
 }
 
 SIMD_API void* SimdGaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
+{
+    return SimdGaussianBlurInitV2(width, height, channels, sigma, epsilon, SimdGaussianBlurChannelByte);
+}
+
+SIMD_API void* SimdGaussianBlurInitV2(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags)
 {
     SIMD_EMPTY();
-    typedef void* (*SimdGaussianBlurInitPtr) (size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+    typedef void* (*SimdGaussianBlurInitPtr) (size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
     const static SimdGaussianBlurInitPtr simdGaussianBlurInit = SIMD_FUNC4(GaussianBlurInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
 
-    return simdGaussianBlurInit(width, height, channels, sigma, epsilon);
+    return simdGaussianBlurInit(width, height, channels, sigma, epsilon, flags);
 }
 
 SIMD_API void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
@@ -2659,6 +2708,23 @@ SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size
         Base::NormalizeHistogram(src, srcStride, width, height, dst, dstStride);
 }
 
+SIMD_API void SimdNormalizeHistogramAdaptive(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    size_t tilesX, size_t tilesY, float clipLimit, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::NormalizeHistogramAdaptive(src, srcStride, width, height, tilesX, tilesY, clipLimit, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::NormalizeHistogramAdaptive(src, srcStride, width, height, tilesX, tilesY, clipLimit, dst, dstStride);
+    else
+#endif
+        Base::NormalizeHistogramAdaptive(src, srcStride, width, height, tilesX, tilesY, clipLimit, dst, dstStride);
+}
+
 SIMD_API void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height, 
                                          size_t cellX, size_t cellY, size_t quantization, float * histograms)
 {
@@ -3175,6 +3241,56 @@ SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, s
         Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+SIMD_API void SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::MedianFilterSquare(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::MedianFilterSquare(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+    else
+#endif
+        Base::MedianFilterSquare(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+}
+
+SIMD_API void SimdMorphology(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::Morphology(src, srcStride, width, height, type, shape, kernelX, kernelY, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::Morphology(src, srcStride, width, height, type, shape, kernelX, kernelY, dst, dstStride);
+    else
+#endif
+        Base::Morphology(src, srcStride, width, height, type, shape, kernelX, kernelY, dst, dstStride);
+}
+
+SIMD_API void SimdMorphologyBits(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::MorphologyBits(src, srcStride, width, height, type, shape, kernelX, kernelY, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::MorphologyBits(src, srcStride, width, height, type, shape, kernelX, kernelY, dst, dstStride);
+    else
+#endif
+        Base::MorphologyBits(src, srcStride, width, height, type, shape, kernelX, kernelY, dst, dstStride);
+}
+
 SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
 {
     SIMD_EMPTY();
@@ -3856,6 +3972,22 @@ SIMD_API void SimdReduceGray5x5(const uint8_t *src, size_t srcWidth, size_t srcH
         Base::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
 }
 
+SIMD_API void* SimdRemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, 
+    const void* map, SimdTensorDataType mapType, SimdWarpAffineFlags flags, const uint8_t* border)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdRemapInitPtr) (size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+        const void* map, SimdTensorDataType mapType, SimdWarpAffineFlags flags, const uint8_t* border);
+    const static SimdRemapInitPtr simdRemapInit = SIMD_FUNC2(RemapInit, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    return simdRemapInit(srcW, srcH, srcS, dstW, dstH, dstS, channels, map, mapType, flags, border);
+}
+
+SIMD_API void SimdRemapRun(const void* context, const uint8_t* src, uint8_t* dst)
+{
+    SIMD_EMPTY();
+    ((Base::Remap*)context)->Run(src, dst);
+}
+
 SIMD_API void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
     SIMD_EMPTY();
@@ -4027,6 +4159,23 @@ SIMD_API void SimdRgbaToGray(const uint8_t* rgba, size_t width, size_t height, s
         Base::RgbaToGray(rgba, width, height, rgbaStride, gray, grayStride);
 }
 
+SIMD_API size_t SimdConnectedComponents(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold,
+    SimdConnectedComponentsFlags flags, uint32_t * labels, size_t labelsStride, SimdConnectedComponentStat * stats, size_t capacity)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::ConnectedComponents(src, srcStride, width, height, threshold, flags, labels, labelsStride, stats, capacity);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        return Sse41::ConnectedComponents(src, srcStride, width, height, threshold, flags, labels, labelsStride, stats, capacity);
+    else
+#endif
+        return Base::ConnectedComponents(src, srcStride, width, height, threshold, flags, labels, labelsStride, stats, capacity);
+}
+
 SIMD_API void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex)
 {
     SIMD_EMPTY();
@@ -4875,6 +5024,62 @@ SIMD_API void SimdSynetAdd8i(const uint8_t* aData, const float* aScale, const fl
 #endif
 }
 
+SIMD_API void* SimdSynetCalibrationInit(size_t channels, SimdTensorFormatType format, size_t bins, SimdBool perChannel)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetCalibrationInitPtr) (size_t channels, SimdTensorFormatType format, size_t bins, SimdBool perChannel);
+    const static SimdSynetCalibrationInitPtr simdSynetCalibrationInit = SIMD_FUNC3(SynetCalibrationInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdSynetCalibrationInit(channels, format, bins, perChannel);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetCalibrationUpdate(void* context, const float* src, size_t batch, size_t spatial)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((Base::SynetCalibration*)context)->Update(src, batch, spatial);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetCalibrationGetMinMax(const void* context, float* min, float* max)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((const Base::SynetCalibration*)context)->GetMinMax(min, max);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API SimdBool SimdSynetCalibrationGetHistogram(const void* context, size_t index, float* range, uint32_t* hist)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((const Base::SynetCalibration*)context)->GetHistogram(index, range, hist) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetCalibrationGetParams(const void* context, SimdSynetCalibrationMethodType method, float percentile, SimdBool symmetric, float* scale, int32_t* zero)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((const Base::SynetCalibration*)context)->GetParams(method, percentile, symmetric, scale, zero) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
 SIMD_API void SimdSynetChannelSum16b(const uint16_t* src, size_t channels, size_t spatial, SimdTensorFormatType format, float* sum)
 {
     SIMD_EMPTY();
@@ -4914,6 +5119,68 @@ SIMD_API void SimdSynetConvert8uTo32f(const uint8_t* src, size_t batch, size_t c
 #endif
 }
 
+SIMD_API size_t SimdSynetWorkspaceSize(const void * const * contexts, size_t count)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    size_t size = 0;
+    for (size_t i = 0; i < count; ++i)
+        if (contexts[i])
+            size = Max(size, ((const Deletable*)contexts[i])->WorkspaceSize());
+    return size;
+#else
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetSetWorkspace(size_t size, SimdBool hugePages)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return Base::SetSynetWorkspace(size, hugePages == SimdTrue) ? SimdTrue : SimdFalse;
+#else
+    return SimdFalse;
+#endif
+}
+
+SIMD_API size_t SimdSynetGetWorkspace()
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return Base::GetSynetWorkspace();
+#else
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetSetWeightCache(SimdBool enable)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    Base::SetSynetWeightCache(enable == SimdTrue);
+#endif
+}
+
+SIMD_API void SimdSynetWeightCacheStatistics(size_t * entries, size_t * bytes, size_t * hits, size_t * misses, size_t * saved)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    Base::SynetWeightCacheStat stat = Base::SynetWeightCacheStatistics();
+#else
+    Base::SynetWeightCacheStat stat = { 0, 0, 0, 0, 0 };
+#endif
+    if (entries)
+        *entries = stat.entries;
+    if (bytes)
+        *bytes = stat.bytes;
+    if (hits)
+        *hits = stat.hits;
+    if (misses)
+        *misses = stat.misses;
+    if (saved)
+        *saved = stat.saved;
+}
+
 SIMD_API void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * params)
 {
     SIMD_EMPTY();
@@ -4983,6 +5250,35 @@ SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src,
 #endif
 }
 
+SIMD_API void * SimdSynetConvolution32fInitReshapable(size_t batch, const SimdConvolutionParameters * conv, size_t plans)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ConvParam param(batch, conv);
+    Base::SynetConvolution32fReshapable* context = new Base::SynetConvolution32fReshapable(param, SimdSynetConvolution32fInit, plans);
+    if (!context->Valid())
+    {
+        delete context;
+        return NULL;
+    }
+    return context;
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetConvolution32fReshape(void * context, size_t batch, size_t srcH, size_t srcW)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution32f*)context)->Reshape(batch, srcH, srcW) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
 SIMD_API void* SimdSynetConvolution16bInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
@@ -5052,6 +5348,48 @@ SIMD_API void SimdSynetConvolution16bForward(void* context, const uint8_t* src,
 #endif
 }
 
+SIMD_API SimdBool SimdSynetConvolution16bForwardAdd(void* context, const uint8_t* src, const uint8_t* add, SimdTensorDataType addType, uint8_t* buf, uint8_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    SynetConvolution16b* c = (SynetConvolution16b*)context;
+    SIMD_PERF_EXT(c);
+    return c->ForwardAdd(src, add, addType, buf, dst) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
+SIMD_API void * SimdSynetConvolution16bInitReshapable(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility, size_t plans)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ConvParam param(batch, conv, compatibility);
+    Base::SynetConvolution16bReshapable* context = new Base::SynetConvolution16bReshapable(param, SimdSynetConvolution16bInit, plans);
+    if (!context->Valid())
+    {
+        delete context;
+        return NULL;
+    }
+    return context;
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetConvolution16bReshape(void * context, size_t batch, size_t srcH, size_t srcW)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution16b*)context)->Reshape(batch, srcH, srcW) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
 SIMD_API void* SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
@@ -5448,6 +5786,20 @@ SIMD_API void* SimdSynetInnerProduct16bInit(size_t M, size_t N, size_t K, SimdTe
 #endif
 }
 
+SIMD_API void* SimdSynetInnerProduct16bInitWq(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeC, SimdBool transB, SimdBool bias, size_t bits, size_t group)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetInnerProduct16bInitWqPtr) (size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeC, SimdBool transB, SimdBool bias, size_t bits, size_t group);
+    const static SimdSynetInnerProduct16bInitWqPtr simdSynetInnerProduct16bInitWq = SIMD_FUNC4(SynetInnerProduct16bInitWq, SIMD_AMXBF16_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdSynetInnerProduct16bInitWq(M, N, K, typeA, typeC, transB, bias, bits, group);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
 SIMD_API size_t SimdSynetInnerProduct16bInternalBufferSize(const void* context)
 {
     SIMD_EMPTY();
@@ -6665,6 +7017,36 @@ SIMD_API void SimdWarpAffineRun(const void* context, const uint8_t* src, uint8_t
     ((WarpAffine*)context)->Run(src, dst);
 }
 
+SIMD_API void* SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels, 
+    SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* mean, const float* std)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdWarpAffineBatchInitPtr) (size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels,
+        SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* mean, const float* std);
+    const static SimdWarpAffineBatchInitPtr simdWarpAffineBatchInit = SIMD_FUNC3(WarpAffineBatchInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    return simdWarpAffineBatchInit(srcW, srcH, srcS, dstW, dstH, channels, flags, border, type, mean, std);
+}
+
+SIMD_API void SimdWarpAffineBatchRun(const void* context, const uint8_t* src, const float* mats, size_t batch, uint8_t* dst)
+{
+    SIMD_EMPTY();
+    ((Base::WarpAffineBatch*)context)->Run(src, mats, batch, dst);
+}
+
+SIMD_API void* SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdWarpPerspectiveInitPtr) (size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    const static SimdWarpPerspectiveInitPtr simdWarpPerspectiveInit = SIMD_FUNC2(WarpPerspectiveInit, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    return simdWarpPerspectiveInit(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border);
+}
+
+SIMD_API void SimdWarpPerspectiveRun(const void* context, const uint8_t* src, uint8_t* dst)
+{
+    SIMD_EMPTY();
+    ((Base::Remap*)context)->Run(src, dst);
+}
+
 typedef void(*SimdWinogradSetFilterPtr) (const float * src, size_t size, float * dst, SimdBool trans);
 typedef void(*SimdWinogradSetInputPtr) (const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth, size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
 typedef void(*SimdWinogradSetOutputPtr) (const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
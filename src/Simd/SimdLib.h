@@ -155,6 +155,42 @@ typedef enum
     SimdCompareLesserOrEqual,
 } SimdCompareType;
 
+/*! @ingroup segmentation
+    Describes format of input mask and connectivity of pixels. It is used in function ::SimdConnectedComponents.
+*/
+typedef enum
+{
+    /*! Input is 8-bit gray image. Foreground pixels are pixels which are greater or equal to threshold. */
+    SimdConnectedComponentsGray8 = 0,
+    /*! Input is 1-bit packed binary mask. Pixel (x, y) is bit (x % 8) of byte (x / 8) of row y. */
+    SimdConnectedComponentsBits = 1,
+    /*! Bit mask of input format flags. */
+    SimdConnectedComponentsFormatMask = 1,
+    /*! Pixels are connected by their sides (4-connectivity). */
+    SimdConnectedComponents4 = 0,
+    /*! Pixels are connected by their sides and corners (8-connectivity). */
+    SimdConnectedComponents8 = 2,
+    /*! Bit mask of connectivity flags. */
+    SimdConnectedComponentsConnectivityMask = 2,
+} SimdConnectedComponentsFlags;
+
+/*! @ingroup segmentation
+    Describes statistics of connected component. It is used in function ::SimdConnectedComponents.
+*/
+typedef struct SimdConnectedComponentStat
+{
+    uint32_t area; /*!< A number of pixels in the component. */
+    uint32_t left; /*!< A left bound of component (inclusive). */
+    uint32_t top; /*!< A top bound of component (inclusive). */
+    uint32_t right; /*!< A right bound of component (exclusive). */
+    uint32_t bottom; /*!< A bottom bound of component (exclusive). */
+    uint64_t sumX; /*!< A sum of X coordinates of component pixels. */
+    uint64_t sumY; /*!< A sum of Y coordinates of component pixels. */
+    uint64_t sumValue; /*!< A sum of values of component pixels (for binary mask it is equal to area). */
+    float centroidX; /*!< A X coordinate of component centroid. */
+    float centroidY; /*!< A Y coordinate of component centroid. */
+} SimdConnectedComponentStat;
+
 /*! @ingroup synet_types
     Describes type of activation function. 
     It is used in ::SimdSynetConvolution32fInit, ::SimdSynetConvolution8iInit, ::SimdSynetDeconvolution32fInit, 
@@ -342,6 +378,34 @@ typedef enum
     SimdImageFileBmp,
 } SimdImageFileType;
 
+/*! @ingroup morphology_filter
+    Describes type of morphological operation. It is used in functions ::SimdMorphology and ::SimdMorphologyBits.
+*/
+typedef enum
+{
+    /*! Erosion (minimum over structuring element). */
+    SimdMorphologyErode = 0,
+    /*! Dilation (maximum over structuring element). */
+    SimdMorphologyDilate,
+    /*! Opening (erosion followed by dilation). */
+    SimdMorphologyOpen,
+    /*! Closing (dilation followed by erosion). */
+    SimdMorphologyClose,
+} SimdMorphologyType;
+
+/*! @ingroup morphology_filter
+    Describes shape of structuring element. It is used in functions ::SimdMorphology and ::SimdMorphologyBits.
+*/
+typedef enum
+{
+    /*! A rectangular structuring element. */
+    SimdMorphologyRect = 0,
+    /*! A cross-shaped structuring element (central row and central column of the rectangle). */
+    SimdMorphologyCross,
+    /*! An elliptic structuring element inscribed into the rectangle. */
+    SimdMorphologyEllipse,
+} SimdMorphologyShape;
+
 /*! @ingroup c_types
     Describes types of binary operation between two images performed by function ::SimdOperationBinary8u.
     Images must have the same format (unsigned 8-bit integer for every channel).
@@ -427,6 +491,29 @@ typedef enum
     SimdPixelFormatLab24,
 } SimdPixelFormatType;
 
+/*! @ingroup gaussian_filter
+    Describes Gaussian blur flags. This type used in function ::SimdGaussianBlurInitV2.
+*/
+typedef enum
+{
+    /*! 8-bit unsigned integer channel type.  */
+    SimdGaussianBlurChannelByte = 0,
+    /*! 16-bit unsigned integer channel type.  */
+    SimdGaussianBlurChannelShort = 1,
+    /*! 32-bit float channel type.  */
+    SimdGaussianBlurChannelFloat = 2,
+    /*! Bit mask of channel type. */
+    SimdGaussianBlurChannelMask = 3,
+    /*! Automatic choice of blur engine: separable convolution for small sigma and recursive filter for large sigma. */
+    SimdGaussianBlurEngineAuto = 0,
+    /*! Separable convolution with truncated Gaussian kernel. Its cost is proportional to sigma. */
+    SimdGaussianBlurEngineDirect = 4,
+    /*! Recursive (Young - van Vliet) approximation of Gaussian filter. Its cost does not depend on sigma. */
+    SimdGaussianBlurEngineRecursive = 8,
+    /*! Bit mask of blur engine. */
+    SimdGaussianBlurEngineMask = 12,
+} SimdGaussianBlurFlags;
+
 /*! @ingroup recursive_bilateral_filter
     Describes Recursive Bilateral Filter flags. This type used in function ::SimdRecursiveBilateralFilterInit.
 */
@@ -493,6 +580,17 @@ typedef enum
     SimdResizeMethodAreaFast,
 } SimdResizeMethodType;
 
+/*! @ingroup synet_types
+    Describes method of selection of quantization parameters. It is used in function ::SimdSynetCalibrationGetParams.
+*/
+typedef enum
+{
+    SimdSynetCalibrationMinMax, /*!< Uses observed minimum and maximum. */
+    SimdSynetCalibrationPercentile, /*!< Clips given percentile of observed distribution. */
+    SimdSynetCalibrationKl, /*!< Minimizes Kullback-Leibler divergence between original and quantized distributions (entropy calibration). */
+    SimdSynetCalibrationMse, /*!< Minimizes mean squared error of quantization. */
+} SimdSynetCalibrationMethodType;
+
 /*! @ingroup synet_types
     Describes Synet calculation compatibility flags. This type used in functions ::SimdSynetAdd8i, ::SimdSynetScaleLayerForward, 
     ::SimdSynetConvert32fTo8u, ::SimdSynetConvert8uTo32f, ::SimdSynetInnerProduct8i, ::SimdSynetScale8iInit,
@@ -517,6 +615,7 @@ typedef enum
     SimdSynetCompatibility16fpHard = 64, /*!< Use 16-bit floating point (Half Precision) format only if hardware support exists. */
     SimdSynetCompatibility16fpSoft = 128, /*!< Use 16-bit floating point (Half Precision) format always (in mode of software emulation if hardware support does not exist). */
     SimdSynetCompatibility16fpMask = 192, /*!< Bit mask of options of 16-bit floating point (Half Precision) format. */
+    SimdSynetCompatibility16bfWinograd = 256, /*!< Allow using of Winograd convolution algorithm with BFloat16 (Brain Floating Point) matrix multiplication (it is faster but less precise). */
 } SimdSynetCompatibilityType;
 
 /*! @ingroup synet_types
@@ -616,7 +715,9 @@ typedef enum
 {
     SimdWarpAffineDefault = 0, /*!< Default Warp Affine flags. */
     SimdWarpAffineChannelByte = 0, /*!<  8-bit integer channel type. */
-    SimdWarpAffineChannelMask = 1, /*!< Bit mask of channel type. */
+    SimdWarpAffineChannelFloat = 1, /*!< 32-bit float channel type. */
+    SimdWarpAffineChannelShort = 8, /*!< 16-bit unsigned integer channel type. It is supported only by ::SimdWarpAffineInit. */
+    SimdWarpAffineChannelMask = 9, /*!< Bit mask of channel type. */
     SimdWarpAffineInterpNearest = 0, /*!< Nearest pixel interpolation method. */
     SimdWarpAffineInterpBilinear = 2, /*!< Bilinear pixel interpolation method. */
     SimdWarpAffineInterpMask = 2, /*!< Bit mask of pixel interpolation options. */
@@ -2232,7 +2333,7 @@ extern "C"
         \param [in] value - a second value for compare operation.
         \param [in] neighborhood - an averaging neighborhood.
         \param [in] threshold - a threshold value for binarization. It can range from 0 to 255.
-        \param [in] positive - a destination value if for neighborhood of this point number of positive comparison is greater then threshold.
+        \param [in] positive - a destination value if for neighborhood of this point number of positive comparison is greater than threshold.
         \param [in] negative - a destination value if for neighborhood of this point number of positive comparison is lesser or equal then threshold.
         \param [out] dst - a pointer to pixels data of output 8-bit gray binarized image.
         \param [in] dstStride - a row size of the dst image.
@@ -2969,6 +3070,105 @@ extern "C"
     SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
         ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup object_detection
+
+        \fn void SimdDetectionDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t size, SimdBool clip, float* dst);
+
+        \short Decodes SSD-style bounding boxes from location offsets and prior boxes.
+
+        For every box:
+        \verbatim
+        pw = prior[2] - prior[0], ph = prior[3] - prior[1];
+        cx = (prior[0] + prior[2])/2 + loc[0]*variance[0]*pw;
+        cy = (prior[1] + prior[3])/2 + loc[1]*variance[1]*ph;
+        w = Exp(loc[2]*variance[2])*pw;
+        h = Exp(loc[3]*variance[3])*ph;
+        dst = {cx - w/2, cy - h/2, cx + w/2, cy + h/2};
+        \endverbatim
+
+        \param [in] loc - a pointer to 32-bit float array with location offsets {dx, dy, dw, dh}. Its size is 4*size.
+        \param [in] prior - a pointer to 32-bit float array with prior boxes {xmin, ymin, xmax, ymax}. Its size is 4*size.
+        \param [in] variance - a pointer to 32-bit float array with variances of prior boxes. Its size is 4*size.
+        \param [in] size - a number of boxes.
+        \param [in] clip - a flag to clip output coordinates to range [0, 1].
+        \param [out] dst - a pointer to output 32-bit float array with boxes {xmin, ymin, xmax, ymax}. Its size is 4*size.
+    */
+    SIMD_API void SimdDetectionDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t size, SimdBool clip, float* dst);
+
+    /*! @ingroup object_detection
+
+        \fn size_t SimdDetectionDecodeYolo32f(const float* src, size_t height, size_t width, size_t anchors, size_t classes, const float* anchorSizes, float threshold, float* boxes, float* scores, uint32_t* labels, size_t capacity);
+
+        \short Decodes YOLO-style detection output and compacts boxes which score exceeds given threshold.
+
+        Input tensor has NHWC format: for every cell (y, x) and anchor a there are (5 + classes) values {tx, ty, tw, th, to, tc[0], ...}.
+        For every such item:
+        \verbatim
+        c = ArgMax(tc);
+        score = Sigmoid(to)*Sigmoid(tc[c]);
+        cx = (x + Sigmoid(tx))/width;
+        cy = (y + Sigmoid(ty))/height;
+        w = anchorSizes[2*a + 0]*Exp(tw);
+        h = anchorSizes[2*a + 1]*Exp(th);
+        \endverbatim
+        Items with score <= threshold are skipped (objectness logit is checked first so most of cells are rejected without computing exponents).
+
+        \param [in] src - a pointer to 32-bit float input tensor. Its size is height*width*anchors*(5 + classes).
+        \param [in] height - a height of the input tensor.
+        \param [in] width - a width of the input tensor.
+        \param [in] anchors - a number of anchors in every cell.
+        \param [in] classes - a number of classes.
+        \param [in] anchorSizes - a pointer to anchor sizes {w, h} normalized to image size. Its size is 2*anchors.
+        \param [in] threshold - a score threshold.
+        \param [out] boxes - a pointer to output boxes {xmin, ymin, xmax, ymax} in normalized coordinates. Its size is 4*capacity.
+        \param [out] scores - a pointer to output scores. Its size is capacity.
+        \param [out] labels - a pointer to output class labels. Its size is capacity. Can be NULL.
+        \param [in] capacity - a maximal number of output boxes.
+        \return a number of output boxes.
+    */
+    SIMD_API size_t SimdDetectionDecodeYolo32f(const float* src, size_t height, size_t width, size_t anchors, size_t classes, const float* anchorSizes,
+        float threshold, float* boxes, float* scores, uint32_t* labels, size_t capacity);
+
+    /*! @ingroup object_detection
+
+        \fn size_t SimdDetectionFilterScores32f(const float* scores, size_t size, float threshold, uint32_t* indices);
+
+        \short Finds indices of scores which exceed given threshold (compaction).
+
+        \param [in] scores - a pointer to 32-bit float array with scores.
+        \param [in] size - a size of the array.
+        \param [in] threshold - a score threshold.
+        \param [out] indices - a pointer to output array with indices of scores which are greater than threshold (in ascending order). Its size must be at least size.
+        \return a number of found indices.
+    */
+    SIMD_API size_t SimdDetectionFilterScores32f(const float* scores, size_t size, float threshold, uint32_t* indices);
+
+    /*! @ingroup object_detection
+
+        \fn size_t SimdDetectionNms32f(const float* boxes, const float* scores, const uint32_t* labels, size_t size, float iouThreshold, float sigma, float scoreThreshold, uint32_t* indices, float* keepScores);
+
+        \short Performs non-maximum suppression of bounding boxes.
+
+        Boxes with score greater than scoreThreshold are processed in order of decreasing score.
+        If sigma is equal to 0 then greedy NMS is used: a box is removed if its IoU with one of already kept boxes exceeds iouThreshold.
+        Otherwise Gaussian soft-NMS is used: at every step the box with maximal score is kept and scores of remaining boxes
+        are multiplied by Exp(-IoU*IoU/sigma); boxes which scores fall to scoreThreshold or below are dropped (iouThreshold is ignored).
+        If labels are given then boxes suppress only boxes of the same class.
+
+        \param [in] boxes - a pointer to boxes {xmin, ymin, xmax, ymax}. Its size is 4*size.
+        \param [in] scores - a pointer to box scores. Its size is size.
+        \param [in] labels - a pointer to box class labels. Its size is size. Can be NULL (class-agnostic NMS).
+        \param [in] size - a number of boxes.
+        \param [in] iouThreshold - an IoU threshold of greedy NMS.
+        \param [in] sigma - a parameter of Gaussian soft-NMS. 0 means greedy NMS.
+        \param [in] scoreThreshold - a minimal score of kept boxes.
+        \param [out] indices - a pointer to indices of kept boxes (in order of selection). Its size must be at least size.
+        \param [out] keepScores - a pointer to (updated) scores of kept boxes. Its size must be at least size. Can be NULL.
+        \return a number of kept boxes.
+    */
+    SIMD_API size_t SimdDetectionNms32f(const float* boxes, const float* scores, const uint32_t* labels, size_t size, float iouThreshold, float sigma,
+        float scoreThreshold, uint32_t* indices, float* keepScores);
+
     /*! @ingroup filling
 
         \fn void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value);
@@ -3356,9 +3556,37 @@ extern "C"
         \return a pointer to filter context. On error it returns NULL.
                 This pointer is used in functions ::SimdGaussianBlurRun.
                 It must be released with using of function ::SimdRelease.
+
+        \note This function is equal to ::SimdGaussianBlurInitV2 with flags ::SimdGaussianBlurChannelByte | ::SimdGaussianBlurEngineAuto.
     */
     SIMD_API void* SimdGaussianBlurInit(size_t width, size_t height, size_t channels, const float * sigma, const float* epsilon);
 
+    /*! @ingroup gaussian_filter
+
+        \fn void * SimdGaussianBlurInitV2(size_t width, size_t height, size_t channels, const float * sigma, const float* epsilon, SimdGaussianBlurFlags flags);
+
+        \short Creates Gaussian blur filter context with given channel type and blur engine.
+
+        Separable convolution engine (::SimdGaussianBlurEngineDirect) uses the same coefficients as ::SimdGaussianBlurInit.
+        Recursive engine (::SimdGaussianBlurEngineRecursive) applies forward and backward 3-rd order IIR filters 
+        (Young - van Vliet) to rows and columns. Its cost does not depend on sigma, but it is only an approximation 
+        of Gaussian filter, parameter epsilon is ignored and it needs a temporary 32-bit float buffer of image size.
+        ::SimdGaussianBlurEngineAuto uses recursive engine for sigma greater or equal to 6.0.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] sigma - a pointer to sigma parameter (blur radius). Its value must be greater than 0.000001. 
+                            Recursive engine requires sigma to be greater or equal to 0.5.
+        \param [in] epsilon - a pointer to epsilon parameter (permissible relative error).
+                              Its value must be greater than 0.000001. Pointer can be NULL and by default value 0.001 is used.
+        \param [in] flags - a flags of channel type and blur engine (see ::SimdGaussianBlurFlags).
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdGaussianBlurRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdGaussianBlurInitV2(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
+
     /*! @ingroup gaussian_filter
 
         \fn void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
@@ -3380,7 +3608,9 @@ extern "C"
         dst[dx, dy] = sum;
         \endverbatim
 
-        \param [in] filter - a filter context. It must be created by function ::SimdGaussianBlurInit and released by function ::SimdRelease.
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] filter - a filter context. It must be created by function ::SimdGaussianBlurInit (::SimdGaussianBlurInitV2) and released by function ::SimdRelease.
         \param [in] src - a pointer to pixels data of the original input image.
         \param [in] srcStride - a row size (in bytes) of the input image.
         \param [out] dst - a pointer to pixels data of the filtered output image.
@@ -3657,6 +3887,32 @@ extern "C"
     */
     SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup histogram
+
+        \fn void SimdNormalizeHistogramAdaptive(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit, uint8_t * dst, size_t dstStride);
+
+        \short Performs contrast limited adaptive histogram equalization (CLAHE) of 8-bit gray image.
+
+        The image is divided into tilesX x tilesY tiles. Histogram of every tile is clipped (the excess is uniformly redistributed between all bins)
+        and converted to equalization LUT. Output pixels are obtained by bilinear interpolation of LUTs of four nearest tiles.
+        The algorithm is compatible with cv::CLAHE (up to rounding). The function uses multithreading (over tile rows and over image rows).
+
+        \note This function has C++ wrappers: Simd::NormalizeHistogramAdaptive(const View<A> & src, size_t tilesX, size_t tilesY, float clipLimit, View<A> & dst)
+            and Simd::NormalizeHistogramAdaptive(Frame<A> & frame, size_t tilesX, size_t tilesY, float clipLimit).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] tilesX - a number of tiles in horizontal direction. It must be in range [1, width].
+        \param [in] tilesY - a number of tiles in vertical direction. It must be in range [1, height].
+        \param [in] clipLimit - a clip limit of tile histogram (relative to mean height of histogram bin). Zero or negative value disables clipping.
+        \param [out] dst - a pointer to pixels data of output 8-bit gray image. It can be the same as src.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdNormalizeHistogramAdaptive(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t tilesX, size_t tilesY, float clipLimit, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup hog
 
         \fn void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height, size_t cellX, size_t cellY, size_t quantization, float * histograms);
@@ -4210,6 +4466,88 @@ extern "C"
     SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         size_t channelCount, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup median_filter
+
+        \fn void SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
+        \short Performs median filtration of input image (filter window is a square (2*radius + 1)x(2*radius + 1)).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        Image borders are processed by replication of edge pixels (as in ::SimdMedianFilterSquare3x3 and ::SimdMedianFilterSquare5x5).
+
+        The function uses the histogram of columns algorithm (Perreault, Hebert) so its cost per pixel does not depend on the radius.
+        It is a faster alternative of ::SimdMedianFilterSquare5x5 for windows 7x7 and larger.
+        The function uses multithreading (the image is divided into vertical stripes).
+
+        \note This function has a C++ wrappers: Simd::MedianFilterSquare(const View<A>& src, size_t radius, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [in] radius - a radius of filter window. It must be in range [1, 127].
+        \param [out] dst - a pointer to pixels data of filtered output image. It must not be the same as src.
+        \param [in] dstStride - a row size of dst image.
+    */
+    SIMD_API void SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup morphology_filter
+
+        \fn void SimdMorphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t * dst, size_t dstStride);
+
+        \short Performs morphological operation (erosion, dilation, opening or closing) of 8-bit gray image.
+
+        Erosion finds a minimum and dilation finds a maximum of pixels covered by structuring element (its anchor is at point (kernelX/2, kernelY/2)).
+        Pixels outside of the image are ignored. The structuring element shapes are the same as in OpenCV (cv::getStructuringElement).
+        Rectangular element is processed by van Herk/Gil-Werman algorithm, so its cost per pixel does not depend on kernel size.
+        The function uses multithreading.
+
+        \note This function has a C++ wrapper: Simd::Morphology(const View<A>& src, SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] type - a type of morphological operation (see ::SimdMorphologyType).
+        \param [in] shape - a shape of structuring element (see ::SimdMorphologyShape).
+        \param [in] kernelX - a width of structuring element. It must be greater than 0.
+        \param [in] kernelY - a height of structuring element. It must be greater than 0.
+        \param [out] dst - a pointer to pixels data of output 8-bit gray image. It can be the same as src.
+        \param [in] dstStride - a row size of output image.
+    */
+    SIMD_API void SimdMorphology(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup morphology_filter
+
+        \fn void SimdMorphologyBits(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t * dst, size_t dstStride);
+
+        \short Performs morphological operation (erosion, dilation, opening or closing) of 1-bit packed binary mask.
+
+        Pixel (x, y) of the mask is bit (x % 8) of byte (x / 8) of row y. A row size of the mask is at least (width + 7) / 8 bytes.
+        Unused bits in the last byte of output rows are set to zero.
+        Pixels outside of the image are ignored (as in ::SimdMorphology).
+        Rows are processed with 64-bit words, so one operation handles 64 pixels.
+        The function uses multithreading.
+
+        \note This function has a C++ wrapper: Simd::MorphologyBits(const View<A>& src, size_t width, SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, View<A>& dst).
+
+        \param [in] src - a pointer to input packed binary mask.
+        \param [in] srcStride - a row size of input mask (in bytes).
+        \param [in] width - a mask width (in pixels).
+        \param [in] height - a mask height.
+        \param [in] type - a type of morphological operation (see ::SimdMorphologyType).
+        \param [in] shape - a shape of structuring element (see ::SimdMorphologyShape).
+        \param [in] kernelX - a width of structuring element. It must be greater than 0.
+        \param [in] kernelY - a height of structuring element. It must be greater than 0.
+        \param [out] dst - a pointer to output packed binary mask. It can be the same as src.
+        \param [in] dstStride - a row size of output mask (in bytes).
+    */
+    SIMD_API void SimdMorphologyBits(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup neural
 
         \fn void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
@@ -5032,6 +5370,62 @@ extern "C"
     SIMD_API void SimdReduceGray5x5(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
         uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
 
+    /*! @ingroup warp_affine
+
+        \fn void * SimdRemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const void* map, SimdTensorDataType mapType, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        \short Creates remap context.
+
+        Remap performs next transformation for every pixel:
+        \verbatim
+        dst[x, y] = src[map[y, x, 0], map[y, x, 1]];
+        \endverbatim
+        The map is converted once (in this function) to compact tables of source offsets and interpolation weights,
+        so ::SimdRemapRun only gathers and interpolates pixels. The output image is processed in parallel by row bands.
+
+        An using example (for 32-bit float image with 1 channel):
+        \verbatim
+        SimdWarpAffineFlags flags = SimdWarpAffineChannelFloat | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant;
+        void* context = SimdRemapInit(srcW, srcH, srcS, dstW, dstH, dstS, 1, map, SimdTensorData32f, flags, NULL);
+        if (context)
+        {
+             SimdRemapRun(context, src, dst);
+             SimdRelease(context);
+        }
+        \endverbatim
+
+        \param [in] srcW - a width of input image.
+        \param [in] srcH - a height of input image.
+        \param [in] srcS - a row size (in bytes) of the input image.
+        \param [in] dstW - a width of output image.
+        \param [in] dstH - a height of output image.
+        \param [in] dstS - a row size (in bytes) of the output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] map - a pointer to the map (dstH x dstW x 2) with source coordinates (x, y) for every output pixel.
+        \param [in] mapType - a type of map values. It can be ::SimdTensorData32f (float coordinates) or
+                               ::SimdTensorData32i (fixed point coordinates in 16.16 format).
+        \param [in] flags - a flags of algorithm parameters. Supported channel types are ::SimdWarpAffineChannelByte and ::SimdWarpAffineChannelFloat.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels (of given channel type).
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. It can be NULL.
+        \return a pointer to remap context. On error it returns NULL.
+                This pointer is used in functions ::SimdRemapRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdRemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+        const void* map, SimdTensorDataType mapType, SimdWarpAffineFlags flags, const uint8_t * border);
+
+    /*! @ingroup warp_affine
+
+        \fn void SimdRemapRun(const void* context, const uint8_t* src, uint8_t* dst);
+
+        \short Performs remap for current image.
+
+        \param [in] context - a remap context. It must be created by function ::SimdRemapInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [out] dst - a pointer to pixels data of the output image.
+    */
+    SIMD_API void SimdRemapRun(const void* context, const uint8_t* src, uint8_t* dst);
+
     /*! @ingroup reordering
 
         \fn void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst);
@@ -5202,6 +5596,34 @@ extern "C"
     */
     SIMD_API void SimdRgbaToGray(const uint8_t* rgba, size_t width, size_t height, size_t rgbaStride, uint8_t* gray, size_t grayStride);
 
+    /*! @ingroup segmentation
+
+        \fn size_t SimdConnectedComponents(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, SimdConnectedComponentsFlags flags, uint32_t * labels, size_t labelsStride, SimdConnectedComponentStat * stats, size_t capacity);
+
+        \short Finds connected components of foreground pixels and gathers their statistics.
+
+        Foreground pixels of 8-bit gray image are pixels which are greater or equal to threshold, for 1-bit packed binary mask they are set bits.
+        The function extracts horizontal runs of foreground pixels from bit masks (64 pixels per step), joins runs of adjacent rows with union-find
+        and labels components in order of their first pixel (raster order) beginning from 1. Label 0 corresponds to background.
+        The image is processed in horizontal stripes by several threads, the stripes are merged at the end.
+
+        \note This function has a C++ wrapper: Simd::ConnectedComponents(const View<A>& src, uint8_t threshold, SimdConnectedComponentsFlags flags, View<A>& labels, std::vector<SimdConnectedComponentStat>& stats).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image or packed binary mask.
+        \param [in] srcStride - a row size of input image (in bytes).
+        \param [in] width - an image width (in pixels).
+        \param [in] height - an image height.
+        \param [in] threshold - a threshold of foreground pixels. It is ignored for binary mask.
+        \param [in] flags - a format of input and connectivity (see ::SimdConnectedComponentsFlags).
+        \param [out] labels - a pointer to output 32-bit label image. It can be NULL.
+        \param [in] labelsStride - a row size of label image (in bytes).
+        \param [out] stats - a pointer to array of component statistics (statistics of component with label i is stored in stats[i - 1]). It can be NULL.
+        \param [in] capacity - a size of stats array. Statistics of components with labels greater than capacity are not stored.
+        \return a number of found components (it can be greater than capacity).
+    */
+    SIMD_API size_t SimdConnectedComponents(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold,
+        SimdConnectedComponentsFlags flags, uint32_t * labels, size_t labelsStride, SimdConnectedComponentStat * stats, size_t capacity);
+
     /*! @ingroup segmentation
 
         \fn void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex);
@@ -6080,6 +6502,84 @@ extern "C"
     SIMD_API void SimdSynetAdd8i(const uint8_t * aData, const float * aScale, const float* aShift, const uint8_t* bData, const float* bScale, const float* bShift,
         uint8_t* cData, const float* cScale, const float* cShift, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
 
+    /*! @ingroup synet_quantized_calibration
+
+        \fn void* SimdSynetCalibrationInit(size_t channels, SimdTensorFormatType format, size_t bins, SimdBool perChannel);
+
+        \short Initilizes calibration context which accumulates statistics of FP32 activations to get quantization parameters.
+
+        The context accumulates per-channel minimum and maximum and histograms (one per tensor or one per channel) of input values.
+        Range of histograms is symmetric ([-range, range]) and it is expanded by doubling (with merging of adjacent bins) when new data exceed it.
+
+        \param [in] channels - a number of channels of calibrated tensor.
+        \param [in] format - a format of calibrated tensor. It can be ::SimdTensorFormatNchw or ::SimdTensorFormatNhwc.
+        \param [in] bins - a number of histogram bins. It must be multiple of 4 and not less than 256. 2048 is a good choice.
+        \param [in] perChannel - a flag of per-channel statistics (histograms and output parameters).
+        \return a pointer to calibration context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdSynetCalibrationInit(size_t channels, SimdTensorFormatType format, size_t bins, SimdBool perChannel);
+
+    /*! @ingroup synet_quantized_calibration
+
+        \fn void SimdSynetCalibrationUpdate(void* context, const float* src, size_t batch, size_t spatial);
+
+        \short Accumulates statistics of given FP32 activations.
+
+        \param [in, out] context - a pointer to calibration context. It must be created by function ::SimdSynetCalibrationInit.
+        \param [in] src - a pointer to FP32 input tensor. Its size is batch*channels*spatial.
+        \param [in] batch - a batch size of input tensor.
+        \param [in] spatial - a spatial size (height*width) of input tensor.
+    */
+    SIMD_API void SimdSynetCalibrationUpdate(void* context, const float* src, size_t batch, size_t spatial);
+
+    /*! @ingroup synet_quantized_calibration
+
+        \fn void SimdSynetCalibrationGetMinMax(const void* context, float* min, float* max);
+
+        \short Gets accumulated per-channel minimum and maximum.
+
+        \param [in] context - a pointer to calibration context. It must be created by function ::SimdSynetCalibrationInit.
+        \param [out] min - a pointer to per-channel minimums. Its size is channels. Can be NULL.
+        \param [out] max - a pointer to per-channel maximums. Its size is channels. Can be NULL.
+    */
+    SIMD_API void SimdSynetCalibrationGetMinMax(const void* context, float* min, float* max);
+
+    /*! @ingroup synet_quantized_calibration
+
+        \fn SimdBool SimdSynetCalibrationGetHistogram(const void* context, size_t index, float* range, uint32_t* hist);
+
+        \short Gets accumulated histogram.
+
+        \param [in] context - a pointer to calibration context. It must be created by function ::SimdSynetCalibrationInit.
+        \param [in] index - an index of histogram (channel index for per-channel context, 0 otherwise).
+        \param [out] range - a pointer to range of histogram: it covers interval [-range, range]. Can be NULL.
+        \param [out] hist - a pointer to histogram. Its size is bins. Can be NULL.
+        \return a result of the operation.
+    */
+    SIMD_API SimdBool SimdSynetCalibrationGetHistogram(const void* context, size_t index, float* range, uint32_t* hist);
+
+    /*! @ingroup synet_quantized_calibration
+
+        \fn SimdBool SimdSynetCalibrationGetParams(const void* context, SimdSynetCalibrationMethodType method, float percentile, SimdBool symmetric, float* scale, int32_t* zero);
+
+        \short Gets UINT8 quantization parameters (see ::SimdSynetQuantizeLinear) from accumulated statistics.
+
+        Selected range [lo, hi] is always extended to include 0. Then:
+        \verbatim
+        scale = (hi - lo) / 255;
+        zero = Min(Max(Round(-lo / scale), 0), 255);
+        \endverbatim
+
+        \param [in] context - a pointer to calibration context. It must be created by function ::SimdSynetCalibrationInit.
+        \param [in] method - a method of range selection.
+        \param [in] percentile - a fraction of values (in range (0, 1], for example 0.9999) which are kept unclipped. It is used only for ::SimdSynetCalibrationPercentile.
+        \param [in] symmetric - a flag of symmetric range (lo = -hi).
+        \param [out] scale - a pointer to output quantization scales. Its size is channels for per-channel context and 1 otherwise.
+        \param [out] zero - a pointer to output quantization zeros. Its size is channels for per-channel context and 1 otherwise.
+        \return a result of the operation.
+    */
+    SIMD_API SimdBool SimdSynetCalibrationGetParams(const void* context, SimdSynetCalibrationMethodType method, float percentile, SimdBool symmetric, float* scale, int32_t* zero);
+
     /*! @ingroup synet_other
 
         \fn void SimdSynetChannelSum16b(const uint16_t* src, size_t channels, size_t spatial, SimdTensorFormatType format, float* sum);
@@ -6146,6 +6646,74 @@ extern "C"
     */
     SIMD_API void SimdSynetConvert8uTo32f(const uint8_t* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, float* dst, SimdSynetCompatibilityType compatibility);
 
+    /*! @ingroup synet_workspace
+
+        \fn size_t SimdSynetWorkspaceSize(const void * const * contexts, size_t count);
+
+        \short Gets size (in bytes) of shared workspace which is enough for all given Synet contexts.
+
+        \param [in] contexts - a pointer to array with Synet contexts (FP32, BF16, INT8 and quantized convolution, deconvolution, merged convolution and inner product contexts).
+            They must be released by function ::SimdRelease.
+        \param [in] count - a number of contexts in the array.
+        \return maximal size (in bytes) of external temporary buffer required for given contexts.
+    */
+    SIMD_API size_t SimdSynetWorkspaceSize(const void * const * contexts, size_t count);
+
+    /*! @ingroup synet_workspace
+
+        \fn SimdBool SimdSynetSetWorkspace(size_t size, SimdBool hugePages);
+
+        \short Attaches aligned workspace (a shared temporary buffer) to current thread.
+
+        All Synet contexts which are called in current thread with NULL external buffer borrow the workspace instead of their own internal buffer 
+        (if workspace size is enough). Previously attached workspace of current thread is released. The workspace is released automatically at thread exit.
+
+        \param [in] size - a size (in bytes) of the workspace. It is usually obtained by function ::SimdSynetWorkspaceSize. Zero size releases the workspace.
+        \param [in] hugePages - a flag to use huge pages (if they are supported by operating system).
+        \return a result of the operation.
+    */
+    SIMD_API SimdBool SimdSynetSetWorkspace(size_t size, SimdBool hugePages);
+
+    /*! @ingroup synet_workspace
+
+        \fn size_t SimdSynetGetWorkspace();
+
+        \short Gets size (in bytes) of the workspace attached to current thread.
+
+        \return a size of the workspace. It is equal to 0 if the workspace is not attached.
+    */
+    SIMD_API size_t SimdSynetGetWorkspace();
+
+    /*! @ingroup synet_weight_cache
+
+        \fn void SimdSynetSetWeightCache(SimdBool enable);
+
+        \short Enables or disables process-wide cache of packed (reordered) weights of Synet contexts.
+
+        If the cache is enabled then contexts which have equal engine (algorithm and instruction set), equal parameters and equal weights
+        share one read-only copy of packed weights instead of their own internal copies. Shared weights are released together with the last context 
+        which uses them. The cache is disabled by default. It affects only contexts whose weights are set after the function call.
+
+        \note The cache is supported by FP32 NHWC direct convolution and BF16 NHWC GEMM convolution.
+
+        \param [in] enable - a flag to enable the cache.
+    */
+    SIMD_API void SimdSynetSetWeightCache(SimdBool enable);
+
+    /*! @ingroup synet_weight_cache
+
+        \fn void SimdSynetWeightCacheStatistics(size_t * entries, size_t * bytes, size_t * hits, size_t * misses, size_t * saved);
+
+        \short Gets statistics of cache of packed weights of Synet contexts.
+
+        \param [out] entries - a pointer to number of alive shared weights. Can be NULL.
+        \param [out] bytes - a pointer to total size (in bytes) of alive shared weights. Can be NULL.
+        \param [out] hits - a pointer to number of requests which have found weights in the cache. Can be NULL.
+        \param [out] misses - a pointer to number of requests which have packed new weights. Can be NULL.
+        \param [out] saved - a pointer to total size (in bytes) of memory saved by the cache hits. Can be NULL.
+    */
+    SIMD_API void SimdSynetWeightCacheStatistics(size_t * entries, size_t * bytes, size_t * hits, size_t * misses, size_t * saved);
+
     /*! @ingroup synet_convolution_fp32
 
         \fn void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv);
@@ -6220,6 +6788,42 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void * SimdSynetConvolution32fInitReshapable(size_t batch, const SimdConvolutionParameters * conv, size_t plans);
+
+        \short Initilizes FP32 convolution algorithm which can change shape of input tensor.
+
+        It works like ::SimdSynetConvolution32fInit but the context can be re-targeted to other batch size and spatial size of input tensor 
+        with using of function ::SimdSynetConvolution32fReshape. Plans (internal contexts) for recently used shapes are kept in the context.
+        Packed weights are shared between plans if the algorithm supports it (see ::SimdSynetSetWeightCache), so new shapes don't repack weights.
+
+        \param [in] batch - an initial batch size.
+        \param [in] conv - a pointer to convolution parameters (including initial size of input and output tensors).
+        \param [in] plans - a maximal number of plans kept in the context. It must be greater than 0.
+        \return a pointer to FP32 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in the same functions as context created by function ::SimdSynetConvolution32fInit and in function ::SimdSynetConvolution32fReshape.
+    */
+    SIMD_API void * SimdSynetConvolution32fInitReshapable(size_t batch, const SimdConvolutionParameters * conv, size_t plans);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn SimdBool SimdSynetConvolution32fReshape(void * context, size_t batch, size_t srcH, size_t srcW);
+
+        \short Re-targets FP32 convolution context to new batch size and spatial size of input tensor.
+
+        Output size is recalculated with using of convolution parameters. Previously set weights are reused: 
+        a plan for a new shape is created with packed weights from the cache. Pointers to weight, bias and parameters passed to ::SimdSynetConvolution32fSetParams must be valid during lifetime of the context.
+        External buffer size (::SimdSynetConvolution32fExternalBufferSize) can be changed after this call.
+
+        \param [in, out] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInitReshapable and released by function ::SimdRelease.
+        \param [in] batch - a new batch size.
+        \param [in] srcH - a new height of input tensor.
+        \param [in] srcW - a new width of input tensor.
+        \return a result of operation. It returns ::SimdFalse if context can't be re-targeted (in this case the context is unchanged).
+    */
+    SIMD_API SimdBool SimdSynetConvolution32fReshape(void * context, size_t batch, size_t srcH, size_t srcW);
+
     /*! @ingroup synet_convolution_bf16
 
         \fn void * SimdSynetConvolution16bInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
@@ -6294,6 +6898,63 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution16bForward(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst);
 
+    /*! @ingroup synet_convolution_bf16
+
+        \fn SimdBool SimdSynetConvolution16bForwardAdd(void * context, const uint8_t * src, const uint8_t * add, SimdTensorDataType addType, uint8_t * buf, uint8_t * dst);
+
+        \short Performs forward propagation of BF16 convolution algorithm fused with residual addition.
+
+        It calculates dst = activation(convolution(src) + add), where activation is set in convolution parameters.
+        Residual tensor is added to output of convolution before activation, when output block is still in cache.
+        It is equivalent to sequence of convolution with identity activation, ::SimdSynetAdd16bForward and activation function.
+
+        \param [in] context - a pointer to BF16 convolution context. It must be created by function ::SimdSynetConvolution16bInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor.
+        \param [in] add - a pointer to residual tensor. It has the same shape and format as output tensor.
+        \param [in] addType - a type of residual tensor. It can be ::SimdTensorData32f or ::SimdTensorData16b.
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetConvolution16bExternalBufferSize. Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to output tensor.
+        \return ::SimdTrue if fused operation is supported by convolution algorithm. Otherwise output tensor is not changed and ::SimdFalse is returned.
+    */
+    SIMD_API SimdBool SimdSynetConvolution16bForwardAdd(void* context, const uint8_t* src, const uint8_t* add, SimdTensorDataType addType, uint8_t* buf, uint8_t* dst);
+
+    /*! @ingroup synet_convolution_bf16
+
+        \fn void * SimdSynetConvolution16bInitReshapable(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility, size_t plans);
+
+        \short Initilizes BF16 convolution algorithm which can change shape of input tensor.
+
+        It works like ::SimdSynetConvolution16bInit but the context can be re-targeted to other batch size and spatial size of input tensor 
+        with using of function ::SimdSynetConvolution16bReshape. Plans (internal contexts) for recently used shapes are kept in the context.
+        Packed weights are shared between plans if the algorithm supports it (see ::SimdSynetSetWeightCache), so new shapes don't repack weights.
+
+        \param [in] batch - an initial batch size.
+        \param [in] conv - a pointer to convolution parameters (including initial size of input and output tensors).
+        \param [in] compatibility - a flags of bitwise compatibility.
+        \param [in] plans - a maximal number of plans kept in the context. It must be greater than 0.
+        \return a pointer to BF16 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in the same functions as context created by function ::SimdSynetConvolution16bInit and in function ::SimdSynetConvolution16bReshape.
+    */
+    SIMD_API void * SimdSynetConvolution16bInitReshapable(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility, size_t plans);
+
+    /*! @ingroup synet_convolution_bf16
+
+        \fn SimdBool SimdSynetConvolution16bReshape(void * context, size_t batch, size_t srcH, size_t srcW);
+
+        \short Re-targets BF16 convolution context to new batch size and spatial size of input tensor.
+
+        Output size is recalculated with using of convolution parameters. Previously set weights are reused: 
+        a plan for a new shape is created with packed weights from the cache. Pointers to weight, bias and parameters passed to ::SimdSynetConvolution16bSetParams must be valid during lifetime of the context.
+        External buffer size (::SimdSynetConvolution16bExternalBufferSize) can be changed after this call.
+
+        \param [in, out] context - a pointer to BF16 convolution context. It must be created by function ::SimdSynetConvolution16bInitReshapable and released by function ::SimdRelease.
+        \param [in] batch - a new batch size.
+        \param [in] srcH - a new height of input tensor.
+        \param [in] srcW - a new width of input tensor.
+        \return a result of operation. It returns ::SimdFalse if context can't be re-targeted (in this case the context is unchanged).
+    */
+    SIMD_API SimdBool SimdSynetConvolution16bReshape(void * context, size_t batch, size_t srcH, size_t srcW);
+
     /*! @ingroup synet_convolution_int8
 
         \fn void * SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
@@ -6840,6 +7501,36 @@ extern "C"
     */
     SIMD_API void* SimdSynetInnerProduct16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB, SimdBool bias);
 
+    /*! @ingroup synet_inner_product_bf16
+
+        \fn void* SimdSynetInnerProduct16bInitWq(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeC, SimdBool transB, SimdBool bias, size_t bits, size_t group);
+
+        \short Initilizes BF16 inner product algorithm with weight-only quantization.
+
+        Constant matrix B (weights) is quantized in function ::SimdSynetInnerProduct16bSetParams to signed 4-bit or 8-bit integers
+        with symmetric FP32 scale for every group of K rows in every column:
+        \verbatim
+        scale[g,j] = max(abs(B[k,j]), g*group <= k < (g + 1)*group) / (2^(bits - 1) - 1);
+        Q[k,j] = round(B[k,j] / scale[k/group, j]);
+        \endverbatim
+        Weights are dequantized to BF16 on the fly in cache-sized blocks during forward propagation, so memory bandwidth used for weights 
+        is reduced in 4 (8 bits) or 8 (4 bits) times in comparison with FP32 weights. It is useful for memory-bound fully-connected layers.
+
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a width of B and width of C matrices.
+        \param [in] K - a width of A and height of B matrices.
+        \param [in] typeA - a type of A matrix. It can be FP32 or BF16.
+        \param [in] typeC - a type of C matrix. It can be FP32 or BF16.
+        \param [in] transB - a transpose matrix B (in function ::SimdSynetInnerProduct16bSetParams) before multiplication.
+        \param [in] bias - a flag to add bias to output matrix C.
+        \param [in] bits - a bit depth of quantized weights. It can be 4 or 8.
+        \param [in] group - a size of quantization group along K. It must be even.
+        \return a pointer to BF16 inner product context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetInnerProduct16bInternalBufferSize, ::SimdSynetInnerProduct16bExternalBufferSize,
+            ::SimdSynetInnerProduct16bInfo, ::SimdSynetInnerProduct16bSetParams and ::SimdSynetInnerProduct16bForward (parameter B must be NULL).
+    */
+    SIMD_API void* SimdSynetInnerProduct16bInitWq(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeC, SimdBool transB, SimdBool bias, size_t bits, size_t group);
+
     /*! @ingroup synet_inner_product_bf16
 
         \fn size_t SimdSynetInnerProduct16bInternalBufferSize(const void * context);
@@ -8524,7 +9215,8 @@ extern "C"
         \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
         \param [in] mat - a pointer to 2x3 matrix with coefficients of affine warp.
         \param [in] flags - a flags of algorithm parameters.
-        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels multiplied by channel size
+                             (1 byte for SimdWarpAffineChannelByte, 2 bytes for SimdWarpAffineChannelShort and 4 bytes for SimdWarpAffineChannelFloat).
                              It parameter is actual for SimdWarpAffineBorderConstant flag. It can be NULL.
         \return a pointer to warp affine context. On error it returns NULL.
                 This pointer is used in functions ::SimdWarpAffineRun.
@@ -8547,6 +9239,111 @@ extern "C"
     */
     SIMD_API void SimdWarpAffineRun(const void* context, const uint8_t* src, uint8_t* dst);
 
+    /*! @ingroup warp_affine
+
+        \fn void * SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, const uint8_t * border, SimdTensorDataType type, const float * mean, const float * std);
+
+        \short Creates batched wrap affine context.
+
+        The context warps one input image with several affine matrices (for example, to align faces or other ROIs) 
+        and stores results as contiguous output tensor in NHWC format (batch x dstH x dstW x channels).
+        Optionally the output can be converted to 32-bit float or BFloat16 with per channel normalization:
+        \verbatim
+        dst[b, y, x, c] = (warp[b, y, x, c] - mean[c]) / std[c];
+        \endverbatim
+
+        An using example (for BGR image and 112x112 face crops):
+        \verbatim
+        SimdWarpAffineFlags flags = SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant;
+        float mean[3] = { 127.5f, 127.5f, 127.5f }, std[3] = { 128.0f, 128.0f, 128.0f };
+        void* context = SimdWarpAffineBatchInit(srcW, srcH, srcS, 112, 112, 3, flags, NULL, SimdTensorData32f, mean, std);
+        if (context)
+        {
+             SimdWarpAffineBatchRun(context, src, mats, faces, (uint8_t*)dst);
+             SimdRelease(context);
+        }
+        \endverbatim
+
+        \param [in] srcW - a width of input image.
+        \param [in] srcH - a height of input image.
+        \param [in] srcS - a row size (in bytes) of the input image.
+        \param [in] dstW - a width of output image.
+        \param [in] dstH - a height of output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] flags - a flags of algorithm parameters. Only ::SimdWarpAffineChannelByte channel type is supported. Flag ::SimdWarpAffineBorderTransparent is supported only for ::SimdTensorData8u output.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. It can be NULL.
+        \param [in] type - a type of output tensor. It can be ::SimdTensorData8u, ::SimdTensorData32f or ::SimdTensorData16b.
+        \param [in] mean - a pointer to the array with per channel mean values (size is equal to channels). 
+                           It is used only for ::SimdTensorData32f and ::SimdTensorData16b output. It can be NULL (zero mean).
+        \param [in] std - a pointer to the array with per channel standard deviation values (size is equal to channels). 
+                           It is used only for ::SimdTensorData32f and ::SimdTensorData16b output. It can be NULL (unit deviation).
+        \return a pointer to batched warp affine context. On error it returns NULL.
+                This pointer is used in functions ::SimdWarpAffineBatchRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels,
+        SimdWarpAffineFlags flags, const uint8_t * border, SimdTensorDataType type, const float * mean, const float * std);
+
+    /*! @ingroup warp_affine
+
+        \fn void SimdWarpAffineBatchRun(const void* context, const uint8_t* src, const float* mats, size_t batch, uint8_t* dst);
+
+        \short Performs batched warp affine for current image. 
+        
+        Crops are processed in parallel (one crop per thread).
+
+        \param [in] context - a batched warp affine context. It must be created by function ::SimdWarpAffineBatchInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] mats - a pointer to array of batch 2x3 matrices with coefficients of affine warp (see ::SimdWarpAffineInit).
+        \param [in] batch - a number of matrices (output crops).
+        \param [out] dst - a pointer to output tensor (batch x dstH x dstW x channels) of type given in ::SimdWarpAffineBatchInit.
+    */
+    SIMD_API void SimdWarpAffineBatchRun(const void* context, const uint8_t* src, const float* mats, size_t batch, uint8_t* dst);
+
+    /*! @ingroup warp_affine
+
+        \fn void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        \short Creates warp perspective context.
+
+        Warp perspective maps every output pixel to input image with using of inverse of given 3x3 homography matrix (from input to output):
+        \verbatim
+        w = x * inv[2][0] + y * inv[2][1] + inv[2][2];
+        dst[x, y] = src[(x * inv[0][0] + y * inv[0][1] + inv[0][2]) / w, (x * inv[1][0] + y * inv[1][1] + inv[1][2]) / w];
+        \endverbatim
+        Source coordinates are computed once (in this function) and stored in the same compact tables as used by ::SimdRemapInit.
+
+        \param [in] srcW - a width of input image.
+        \param [in] srcH - a height of input image.
+        \param [in] srcS - a row size (in bytes) of the input image.
+        \param [in] dstW - a width of output image.
+        \param [in] dstH - a height of output image.
+        \param [in] dstS - a row size (in bytes) of the output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] mat - a pointer to 3x3 matrix with coefficients of perspective warp. It must be non singular.
+        \param [in] flags - a flags of algorithm parameters. Supported channel types are ::SimdWarpAffineChannelByte and ::SimdWarpAffineChannelFloat.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels (of given channel type).
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. It can be NULL.
+        \return a pointer to warp perspective context. On error it returns NULL.
+                This pointer is used in functions ::SimdWarpPerspectiveRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+        size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+    /*! @ingroup warp_affine
+
+        \fn void SimdWarpPerspectiveRun(const void* context, const uint8_t* src, uint8_t* dst);
+
+        \short Performs warp perspective for current image.
+
+        \param [in] context - a warp perspective context. It must be created by function ::SimdWarpPerspectiveInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [out] dst - a pointer to pixels data of the output image.
+    */
+    SIMD_API void SimdWarpPerspectiveRun(const void* context, const uint8_t* src, uint8_t* dst);
+
     /*! @ingroup synet_winograd
 
         \fn void SimdWinogradKernel1x3Block1x4SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
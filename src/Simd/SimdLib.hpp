@@ -2150,6 +2150,29 @@ namespace Simd
         SimdNormalizeHistogram(src.data, src.stride, src.width, src.height, dst.data, dst.stride);
     }
 
+    /*! @ingroup histogram
+
+        \fn void NormalizeHistogramAdaptive(const View<A> & src, size_t tilesX, size_t tilesY, float clipLimit, View<A> & dst)
+
+        \short Performs contrast limited adaptive histogram equalization (CLAHE) of 8-bit gray image.
+
+        The input and output 8-bit gray images must have the same size.
+
+        \note This function is a C++ wrapper for function ::SimdNormalizeHistogramAdaptive.
+
+        \param [in] src - an input 8-bit gray image.
+        \param [in] tilesX - a number of tiles in horizontal direction.
+        \param [in] tilesY - a number of tiles in vertical direction.
+        \param [in] clipLimit - a clip limit of tile histogram (relative to mean height of histogram bin).
+        \param [out] dst - an output 8-bit gray image. It can be the same as src.
+    */
+    template<template<class> class A> SIMD_INLINE void NormalizeHistogramAdaptive(const View<A> & src, size_t tilesX, size_t tilesY, float clipLimit, View<A> & dst)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Gray8 && tilesX >= 1 && tilesX <= src.width && tilesY >= 1 && tilesY <= src.height);
+
+        SimdNormalizeHistogramAdaptive(src.data, src.stride, src.width, src.height, tilesX, tilesY, clipLimit, dst.data, dst.stride);
+    }
+
     /*! @ingroup histogram
 
         \fn void uint8_t Mean(const uint32_t* histogram)
@@ -2649,6 +2672,76 @@ namespace Simd
         SimdMedianFilterSquare5x5(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
     }
 
+    /*! @ingroup median_filter
+
+        \fn void MedianFilterSquare(const View<A>& src, size_t radius, View<A>& dst)
+
+        \short Performs median filtration of input image (filter window is a square (2*radius + 1)x(2*radius + 1)).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdMedianFilterSquare.
+
+        \param [in] src - an original input image.
+        \param [in] radius - a radius of filter window. It must be in range [1, 127].
+        \param [out] dst - a filtered output image.
+    */
+    template<template<class> class A> SIMD_INLINE void MedianFilterSquare(const View<A>& src, size_t radius, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1 && radius >= 1 && radius <= 127);
+
+        SimdMedianFilterSquare(src.data, src.stride, src.width, src.height, src.ChannelCount(), radius, dst.data, dst.stride);
+    }
+
+    /*! @ingroup morphology_filter
+
+        \fn void Morphology(const View<A>& src, SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, View<A>& dst)
+
+        \short Performs morphological operation (erosion, dilation, opening or closing) of 8-bit gray image.
+
+        All images must have the same width, height and 8-bit gray format.
+
+        \note This function is a C++ wrapper for function ::SimdMorphology.
+
+        \param [in] src - an input 8-bit gray image.
+        \param [in] type - a type of morphological operation (see ::SimdMorphologyType).
+        \param [in] shape - a shape of structuring element (see ::SimdMorphologyShape).
+        \param [in] kernelX - a width of structuring element.
+        \param [in] kernelY - a height of structuring element.
+        \param [out] dst - an output 8-bit gray image. It can be the same as src.
+    */
+    template<template<class> class A> SIMD_INLINE void Morphology(const View<A>& src, SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Gray8 && kernelX > 0 && kernelY > 0);
+
+        SimdMorphology(src.data, src.stride, src.width, src.height, type, shape, kernelX, kernelY, dst.data, dst.stride);
+    }
+
+    /*! @ingroup morphology_filter
+
+        \fn void MorphologyBits(const View<A>& src, size_t width, SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, View<A>& dst)
+
+        \short Performs morphological operation (erosion, dilation, opening or closing) of 1-bit packed binary mask.
+
+        Masks are stored in 8-bit gray images with width (width + 7) / 8. Pixel (x, y) of the mask is bit (x % 8) of byte (x / 8) of row y.
+
+        \note This function is a C++ wrapper for function ::SimdMorphologyBits.
+
+        \param [in] src - an input packed binary mask.
+        \param [in] width - a mask width (in pixels).
+        \param [in] type - a type of morphological operation (see ::SimdMorphologyType).
+        \param [in] shape - a shape of structuring element (see ::SimdMorphologyShape).
+        \param [in] kernelX - a width of structuring element.
+        \param [in] kernelY - a height of structuring element.
+        \param [out] dst - an output packed binary mask. It can be the same as src.
+    */
+    template<template<class> class A> SIMD_INLINE void MorphologyBits(const View<A>& src, size_t width, SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Gray8 && src.width == (width + 7) / 8 && kernelX > 0 && kernelY > 0);
+
+        SimdMorphologyBits(src.data, src.stride, width, src.height, type, shape, kernelX, kernelY, dst.data, dst.stride);
+    }
+
     /*! @ingroup neural
 
         \fn void NeuralConvert(const View<A> & src, float * dst, size_t stride, bool inversion)
@@ -3168,6 +3261,40 @@ namespace Simd
         SimdBgraToBgr(rgba.data, rgba.width, rgba.height, rgba.stride, rgb.data, rgb.stride);
     }
 
+    /*! @ingroup segmentation
+
+        \fn size_t ConnectedComponents(const View<A>& src, uint8_t threshold, SimdConnectedComponentsFlags flags, View<A>& labels, std::vector<SimdConnectedComponentStat>& stats)
+
+        \short Finds connected components of foreground pixels and gathers their statistics.
+
+        Input image must have 8-bit gray format (for binary mask its width must be equal to (labels.width + 7) / 8).
+        Labels image must have 32-bit integer format and the same height as input image.
+
+        \note This function is a C++ wrapper for function ::SimdConnectedComponents.
+
+        \param [in] src - an input 8-bit gray image or packed binary mask.
+        \param [in] threshold - a threshold of foreground pixels. It is ignored for binary mask.
+        \param [in] flags - a format of input and connectivity (see ::SimdConnectedComponentsFlags).
+        \param [out] labels - an output 32-bit label image.
+        \param [out] stats - a vector with statistics of components (statistics of component with label i is stored in stats[i - 1]).
+        \return a number of found components.
+    */
+    template<template<class> class A> SIMD_INLINE size_t ConnectedComponents(const View<A>& src, uint8_t threshold, SimdConnectedComponentsFlags flags, View<A>& labels, std::vector<SimdConnectedComponentStat>& stats)
+    {
+        bool bits = (flags & SimdConnectedComponentsFormatMask) == SimdConnectedComponentsBits;
+        assert(src.format == View<A>::Gray8 && labels.format == View<A>::Int32 && src.height == labels.height);
+        assert(src.width == (bits ? (labels.width + 7) / 8 : labels.width));
+
+        size_t count = SimdConnectedComponents(src.data, src.stride, labels.width, labels.height, threshold, flags, (uint32_t*)labels.data, labels.stride, stats.data(), stats.size());
+        if (count > stats.size())
+        {
+            stats.resize(count);
+            count = SimdConnectedComponents(src.data, src.stride, labels.width, labels.height, threshold, flags, (uint32_t*)labels.data, labels.stride, stats.data(), stats.size());
+        }
+        stats.resize(count);
+        return count;
+    }
+
     /*! @ingroup segmentation
 
         \fn void SegmentationChangeIndex(View<A> & mask, uint8_t oldIndex, uint8_t newIndex)
@@ -4190,14 +4317,21 @@ namespace Simd
         \param [in] mat - a pointer to 2x3 matrix with coefficients of affine warp.
         \param [in, out] dst - an output image.
         \param [in] flags - a flags of algorithm parameters. By default is equal to ::SimdWarpAffineChannelByte | ::SimdWarpAffineInterpBilinear | ::SimdWarpAffineBorderConstant.
-        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                            For View::Int16 and View::Float images channel type is defined by image format.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to pixel size in bytes.
                              It parameter is actual for SimdWarpAffineBorderConstant flag. By default is equal to NULL.
     */
     template<template<class> class A> SIMD_INLINE void WarpAffine(const View<A>& src, const float * mat, View<A>& dst, 
         SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
     {
-        assert(src.format == dst.format && src.ChannelSize() == 1);
-        assert((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte);
+        assert(src.format == dst.format && (src.ChannelSize() == 1 || src.format == View<A>::Int16 || src.format == View<A>::Float));
+
+        if (src.format == View<A>::Int16)
+            flags = (SimdWarpAffineFlags)((flags & ~SimdWarpAffineChannelMask) | SimdWarpAffineChannelShort);
+        else if (src.format == View<A>::Float)
+            flags = (SimdWarpAffineFlags)((flags & ~SimdWarpAffineChannelMask) | SimdWarpAffineChannelFloat);
+        else
+            assert((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte);
 
         void* context = SimdWarpAffineInit(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, src.ChannelCount(), mat, flags, border);
         if (context)
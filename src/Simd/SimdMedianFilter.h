@@ -0,0 +1,167 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMedianFilter_h__
+#define __SimdMedianFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t MEDIAN_RADIUS_MAX = 127;
+        const size_t MEDIAN_COARSE = 16, MEDIAN_FINE = 256;
+
+        struct MedianHist
+        {
+            static SIMD_INLINE void Add(uint16_t* dst, const uint16_t* src)
+            {
+                for (size_t i = 0; i < 16; ++i)
+                    dst[i] += src[i];
+            }
+
+            static SIMD_INLINE void Update(uint16_t* dst, const uint16_t* add, const uint16_t* sub)
+            {
+                for (size_t i = 0; i < 16; ++i)
+                    dst[i] += add[i] - sub[i];
+            }
+
+            static SIMD_INLINE size_t Find(const uint16_t* hist, size_t & sum, size_t half)
+            {
+                for (size_t i = 0; i < 15; ++i)
+                {
+                    if (sum + hist[i] > half)
+                        return i;
+                    sum += hist[i];
+                }
+                return 15;
+            }
+        };
+
+        SIMD_INLINE void MedianUpdateColumns(const uint8_t* sub, const uint8_t* add, const size_t* offs, size_t size, uint16_t* coarse, uint16_t* fine)
+        {
+            for (size_t i = 0; i < size; ++i, coarse += MEDIAN_COARSE, fine += MEDIAN_FINE)
+            {
+                size_t s = sub[offs[i]], a = add[offs[i]];
+                if (s == a)
+                    continue;
+                coarse[s >> 4]--;
+                fine[s]--;
+                coarse[a >> 4]++;
+                fine[a]++;
+            }
+        }
+
+        template<class Hist> void MedianFilterSquareStripe(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radius, size_t xBeg, size_t xEnd, uint16_t * buf, size_t * offs, uint8_t* dst, size_t dstStride)
+        {
+            const size_t kernel = 2 * radius + 1, half = kernel * kernel / 2;
+            const size_t cols = xEnd - xBeg + 2 * radius, size = cols * channels;
+            uint16_t* colCoarse = buf, * colFine = colCoarse + size * MEDIAN_COARSE;
+            uint16_t* kerCoarse = colFine + size * MEDIAN_FINE, * kerFine = kerCoarse + MEDIAN_COARSE;
+            ptrdiff_t luc[MEDIAN_COARSE];
+
+            for (size_t j = 0; j < cols; ++j)
+                for (size_t c = 0; c < channels; ++c)
+                    offs[j * channels + c] = Simd::RestrictRange<ptrdiff_t>(xBeg + j - radius, 0, width - 1) * channels + c;
+            memset(buf, 0, size * (MEDIAN_COARSE + MEDIAN_FINE) * 2);
+            for (ptrdiff_t dy = -(ptrdiff_t)radius; dy <= (ptrdiff_t)radius; ++dy)
+            {
+                const uint8_t* row = src + Simd::RestrictRange<ptrdiff_t>(dy, 0, height - 1) * srcStride;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    size_t v = row[offs[i]];
+                    colCoarse[i * MEDIAN_COARSE + (v >> 4)]++;
+                    colFine[i * MEDIAN_FINE + v]++;
+                }
+            }
+            for (size_t y = 0; y < height; ++y)
+            {
+                if (y)
+                {
+                    const uint8_t* sub = src + Simd::RestrictRange<ptrdiff_t>(y - radius - 1, 0, height - 1) * srcStride;
+                    const uint8_t* add = src + Simd::Min(y + radius, height - 1) * srcStride;
+                    if (sub != add)
+                        MedianUpdateColumns(sub, add, offs, size, colCoarse, colFine);
+                }
+                uint8_t* pd = dst + y * dstStride + xBeg * channels;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    const uint16_t* cc = colCoarse + c * MEDIAN_COARSE, * cf = colFine + c * MEDIAN_FINE;
+                    const size_t cs = channels * MEDIAN_COARSE, fs = channels * MEDIAN_FINE;
+                    memset(kerCoarse, 0, MEDIAN_COARSE * 2);
+                    for (size_t j = 0; j < kernel; ++j)
+                        Hist::Add(kerCoarse, cc + j * cs);
+                    for (size_t k = 0; k < MEDIAN_COARSE; ++k)
+                        luc[k] = -(ptrdiff_t)kernel;
+                    for (size_t x = 0, n = xEnd - xBeg; x < n; ++x)
+                    {
+                        if (x)
+                            Hist::Update(kerCoarse, cc + (x + kernel - 1) * cs, cc + (x - 1) * cs);
+                        size_t sum = 0;
+                        size_t k = Hist::Find(kerCoarse, sum, half);
+                        uint16_t* fine = kerFine + k * MEDIAN_COARSE;
+                        const uint16_t* col = cf + k * MEDIAN_COARSE;
+                        if ((ptrdiff_t)x - luc[k] >= (ptrdiff_t)kernel)
+                        {
+                            memset(fine, 0, MEDIAN_COARSE * 2);
+                            for (size_t j = x, end = x + kernel; j < end; ++j)
+                                Hist::Add(fine, col + j * fs);
+                        }
+                        else
+                        {
+                            for (size_t j = luc[k]; j < x; ++j)
+                                Hist::Update(fine, col + (j + kernel) * fs, col + j * fs);
+                        }
+                        luc[k] = x;
+                        pd[x * channels + c] = uint8_t(k * MEDIAN_COARSE + Hist::Find(fine, sum, half));
+                    }
+                }
+            }
+        }
+
+        template<class Hist> void MedianFilterSquare(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+            size_t radius, uint8_t* dst, size_t dstStride)
+        {
+            assert(radius >= 1 && radius <= MEDIAN_RADIUS_MAX && src != dst);
+            const size_t histSize = (MEDIAN_COARSE + MEDIAN_FINE) * 2;
+            const size_t minStripe = 4 * (2 * radius + 1);
+            const size_t stripe = Simd::Max<size_t>(AlgCacheL2() / (2 * histSize * channels), minStripe);
+            Simd::Parallel(0, width, [&](size_t thread, size_t begin, size_t end)
+            {
+                size_t cols = Simd::Min(stripe, end - begin) + 2 * radius;
+                Array16u buf(cols * channels * (MEDIAN_COARSE + MEDIAN_FINE) + MEDIAN_COARSE + MEDIAN_FINE);
+                Array<size_t> offs(cols * channels);
+                for (size_t x = begin; x < end; x += stripe)
+                    MedianFilterSquareStripe<Hist>(src, srcStride, width, height, channels, radius, x, Simd::Min(x + stripe, end), buf.data, offs.data, dst, dstStride);
+            }, GetThreadNumber(), minStripe);
+        }
+    }
+}
+
+#endif
@@ -188,6 +188,11 @@ namespace Simd
     struct Deletable
     {
         virtual ~Deletable() {}
+
+        virtual size_t WorkspaceSize() const
+        {
+            return 0;
+        }
     };
 
     //-------------------------------------------------------------------------------------------------
@@ -33,6 +33,8 @@
 #include <vector>
 #include <stack>
 #include <sstream>
+#include <limits>
+#include <climits>
 
 #ifndef SIMD_CHECK_PERFORMANCE
 #define SIMD_CHECK_PERFORMANCE()
@@ -522,6 +524,12 @@ namespace Simd
             double BackgroundUpdateTime; /*!< \brief Background update speed (in seconds) in normal mode. By default it is equal to 1 second. */
             int BackgroundSabotageCountMax; /*!< \brief Maximal count of frame with sabotage without scene reinitialization. By default it is equal to 3. */
 
+            bool ActivityGatingEnable; /*!< \brief A flag to skip texture, difference and background updates in static tiles of the scene. By default it is false. */
+            int ActivityTileSize; /*!< \brief A size of activity tile (in pixels of the most detailed level of internal pyramid). By default it is equal to 16. */
+            double ActivityThreshold; /*!< \brief Minimal mean absolute difference (per pixel) between tile and its last processed state to mark the tile as active. By default it is equal to 2. */
+            double ActivityCatchUpTime; /*!< \brief Maximal time (in seconds) of skipping updates of static tile. By default it is equal to 1 second. */
+            int ActivityCatchUpMax; /*!< \brief Maximal number of skipped background range adjustments which are replayed at catch-up of static tile. By default it is equal to 4. */
+
             double SegmentationCreateThreshold; /*!< \brief Threshold of segmentation to create motion region. It is restricted by range [0, 1]. By default it is equal to 0.5. */
             double SegmentationExpandCoefficient; /*!< \brief Segmentation coefficient of area expansion of motion region. It is restricted by range [0, 1]. By default it is equal to 0.75. */
 
@@ -559,6 +567,12 @@ namespace Simd
                 BackgroundUpdateTime = 1.0;
                 BackgroundSabotageCountMax = 3;
 
+                ActivityGatingEnable = false;
+                ActivityTileSize = 16;
+                ActivityThreshold = 2.0;
+                ActivityCatchUpTime = 1.0;
+                ActivityCatchUpMax = 4;
+
                 SegmentationCreateThreshold = 0.5;
                 SegmentationExpandCoefficient = 0.75;
 
@@ -651,6 +665,8 @@ namespace Simd
 
                 SetFrame(input, output);
 
+                EstimateActivity();
+
                 EstimateTextures();
 
                 EstimateDifference();
@@ -851,6 +867,65 @@ namespace Simd
                 }
             };
 
+            struct Activity
+            {
+                enum State
+                {
+                    Static,
+                    Active,
+                    CatchUp
+                };
+
+                size_t tile, levels;
+                Size size, frameSize;
+                bool all, reset;
+                View previous, dx, dy;
+                Pyramid difference;
+                std::vector<uint8_t> states, changes;
+                std::vector<Time> updateTimes;
+                std::vector<int> missed;
+                std::vector<Rects> rects;
+
+                Activity()
+                    : all(true)
+                    , reset(true)
+                {
+                }
+
+                void Create(const Size & frameSize_, size_t levelCount, const Options & options)
+                {
+                    frameSize = frameSize_;
+                    tile = std::max(options.ActivityTileSize, 4);
+                    levels = 0;
+                    while (levels < levelCount && (tile >> levels) >= 4)
+                        levels++;
+                    size = Size((frameSize.x + tile - 1) / tile, (frameSize.y + tile - 1) / tile);
+                    previous.Recreate(frameSize, View::Gray8);
+                    dx.Recreate(frameSize, View::Gray8);
+                    dy.Recreate(frameSize, View::Gray8);
+                    difference.Recreate(frameSize, levelCount);
+                    states.assign(size.x * size.y, Active);
+                    changes.assign(size.x * size.y, 0);
+                    updateTimes.assign(size.x * size.y, 0);
+                    missed.assign(size.x * size.y, 0);
+                    rects.resize(levels);
+                    all = true;
+                    reset = true;
+                }
+
+                Rect Tile(ptrdiff_t x, ptrdiff_t y) const
+                {
+                    return Rect(x * tile, y * tile, std::min<ptrdiff_t>((x + 1) * tile, frameSize.x), std::min<ptrdiff_t>((y + 1) * tile, frameSize.y));
+                }
+
+                Rect Level(const Rect & rect, size_t level, const Size & levelSize) const
+                {
+                    return Rect(rect.left >> level, rect.top >> level,
+                        rect.right < frameSize.x ? rect.right >> level : levelSize.x,
+                        rect.bottom < frameSize.y ? rect.bottom >> level : levelSize.y);
+                }
+            };
+
             struct Stability
             {
                 enum State
@@ -951,6 +1026,8 @@ namespace Simd
 
                 Background background;
 
+                Activity activity;
+
                 Stability stability;
 
                 Pyramid difference;
@@ -969,6 +1046,7 @@ namespace Simd
 
                     texture.Create(model.frameSize, model.levelCount, options);
                     difference.Recreate(model.frameSize, model.levelCount);
+                    activity.Create(model.frameSize, model.levelCount, options);
 
                     segmentation.mask.Recreate(model.frameSize, model.levelCount);
                     segmentation.differenceCreationMin = int(255 * options.SegmentationCreateThreshold);
@@ -1103,21 +1181,169 @@ namespace Simd
                 }
             }
 
+            void EstimateActivity()
+            {
+                if (!_options.ActivityGatingEnable)
+                    return;
+
+                SIMD_CHECK_PERFORMANCE();
+
+                Activity & activity = _scene.activity;
+                const View & current = _scene.scaled.Top();
+                const Time & time = _scene.input.timestamp;
+                bool all = activity.reset || _scene.background.state == Background::Init;
+                std::vector<uint8_t> & changes = activity.changes;
+                for (ptrdiff_t y = 0, i = 0; y < activity.size.y && !all; ++y)
+                {
+                    for (ptrdiff_t x = 0; x < activity.size.x; ++x, ++i)
+                    {
+                        Rect rect = activity.Tile(x, y);
+                        uint64_t sum = 0;
+                        Simd::AbsDifferenceSum(current.Region(rect), activity.previous.Region(rect), sum);
+                        changes[i] = double(sum) > _options.ActivityThreshold * rect.Area() ? 1 : 0;
+                    }
+                }
+                for (ptrdiff_t y = 0, i = 0; y < activity.size.y; ++y)
+                {
+                    for (ptrdiff_t x = 0; x < activity.size.x; ++x, ++i)
+                    {
+                        if (all)
+                        {
+                            activity.states[i] = Activity::Active;
+                            activity.updateTimes[i] = time - _options.ActivityCatchUpTime * (i % 4) / 4;
+                        }
+                        else
+                        {
+                            bool changed = false;
+                            for (ptrdiff_t ny = std::max<ptrdiff_t>(y - 1, 0); ny <= std::min(y + 1, activity.size.y - 1); ++ny)
+                                for (ptrdiff_t nx = std::max<ptrdiff_t>(x - 1, 0); nx <= std::min(x + 1, activity.size.x - 1); ++nx)
+                                    changed = changed || changes[ny * activity.size.x + nx];
+                            if (changed)
+                                activity.states[i] = Activity::Active;
+                            else if (time - activity.updateTimes[i] >= _options.ActivityCatchUpTime)
+                                activity.states[i] = Activity::CatchUp;
+                            else
+                                activity.states[i] = Activity::Static;
+                            if (activity.states[i] != Activity::Static)
+                                activity.updateTimes[i] = time;
+                        }
+                        if (activity.states[i] != Activity::Static)
+                        {
+                            Rect rect = activity.Tile(x, y);
+                            Simd::Copy(current.Region(rect), activity.previous.Region(rect).Ref());
+                        }
+                    }
+                }
+                activity.all = all;
+                activity.reset = false;
+
+                for (size_t level = 0; level < activity.levels; ++level)
+                    activity.rects[level].clear();
+                for (ptrdiff_t y = 0; y < activity.size.y; ++y)
+                {
+                    const uint8_t * states = activity.states.data() + y * activity.size.x;
+                    for (ptrdiff_t x = 0; x < activity.size.x;)
+                    {
+                        if (states[x] == Activity::Static)
+                        {
+                            ++x;
+                            continue;
+                        }
+                        Rect rect = activity.Tile(x, y);
+                        while (++x < activity.size.x && states[x] != Activity::Static)
+                            rect.right = activity.Tile(x, y).right;
+                        for (size_t level = 0; level < activity.levels; ++level)
+                        {
+                            Rect region = activity.Level(rect, level, _scene.texture.gray.value[level].Size());
+                            if (region.Area())
+                                activity.rects[level].push_back(region);
+                        }
+                    }
+                }
+            }
+
+            bool Gated(size_t level) const
+            {
+                const Activity & activity = _scene.activity;
+                return _options.ActivityGatingEnable && !activity.all && level < activity.levels;
+            }
+
             void EstimateTextures()
             {
                 SIMD_CHECK_PERFORMANCE();
 
                 Texture & texture = _scene.texture;
-                Simd::Copy(_scene.scaled.Top(), texture.gray.value[0]);
-                Simd::Build(texture.gray.value, SimdReduce4x4);
-                if (_options.DifferenceDxFeatureWeight || _options.DifferenceDyFeatureWeight)
+                bool gradient = _options.DifferenceDxFeatureWeight || _options.DifferenceDyFeatureWeight;
+                if (!Gated(0))
                 {
-                    for (size_t i = 0; i < texture.gray.value.Size(); ++i)
+                    Simd::Copy(_scene.scaled.Top(), texture.gray.value[0]);
+                    Simd::Build(texture.gray.value, SimdReduce4x4);
+                    if (gradient)
                     {
-                        Simd::TextureBoostedSaturatedGradient(texture.gray.value[i],
-                            _options.TextureGradientSaturation, _options.TextureGradientBoost,
-                            texture.dx.value[i], texture.dy.value[i]);
+                        for (size_t i = 0; i < texture.gray.value.Size(); ++i)
+                        {
+                            Simd::TextureBoostedSaturatedGradient(texture.gray.value[i],
+                                _options.TextureGradientSaturation, _options.TextureGradientBoost,
+                                texture.dx.value[i], texture.dy.value[i]);
+                        }
                     }
+                    return;
+                }
+
+                const Activity & activity = _scene.activity;
+                Pyramid & buffer = _scene.buffer;
+                for (size_t i = 0; i < texture.gray.value.Size(); ++i)
+                {
+                    View & gray = texture.gray.value[i];
+                    if (!Gated(i))
+                    {
+                        Simd::ReduceGray4x4(texture.gray.value[i - 1], gray);
+                        if (gradient)
+                            Simd::TextureBoostedSaturatedGradient(gray, _options.TextureGradientSaturation, 
+                                _options.TextureGradientBoost, texture.dx.value[i], texture.dy.value[i]);
+                        continue;
+                    }
+                    const Rects & rects = activity.rects[i];
+                    const Rect frame(gray.Size());
+                    for (size_t j = 0; j < rects.size(); ++j)
+                    {
+                        const Rect & rect = rects[j];
+                        if (i == 0)
+                            Simd::Copy(_scene.scaled.Top().Region(rect), gray.Region(rect).Ref());
+                        else
+                        {
+                            const View & prev = texture.gray.value[i - 1];
+                            Rect dst = Rect(rect).AddBorder(1).Intersection(frame);
+                            Rect src(dst.left * 2, dst.top * 2, std::min(dst.right * 2, prev.Size().x), std::min(dst.bottom * 2, prev.Size().y));
+                            Simd::ReduceGray4x4(prev.Region(src), buffer[i].Region(dst).Ref());
+                            Simd::Copy(buffer[i].Region(rect), gray.Region(rect).Ref());
+                        }
+                    }
+                    if (gradient)
+                    {
+                        for (size_t j = 0; j < rects.size(); ++j)
+                        {
+                            const Rect & rect = rects[j];
+                            Rect ext = Rect(rect).AddBorder(2).Intersection(frame);
+                            Simd::TextureBoostedSaturatedGradient(gray.Region(ext), _options.TextureGradientSaturation, 
+                                _options.TextureGradientBoost, activity.dx.Region(ext).Ref(), activity.dy.Region(ext).Ref());
+                            Simd::Copy(activity.dx.Region(rect), texture.dx.value[i].Region(rect).Ref());
+                            Simd::Copy(activity.dy.Region(rect), texture.dy.value[i].Region(rect).Ref());
+                        }
+                    }
+                }
+            }
+
+            void AddDifference(size_t level, const Rect & rect, View & difference)
+            {
+                const Texture & texture = _scene.texture;
+                View dst = difference.Region(rect);
+                Simd::Fill(dst, 0);
+                for (size_t j = 0; j < texture.features.size(); ++j)
+                {
+                    const Texture::Feature & feature = *texture.features[j];
+                    Simd::AddFeatureDifference(feature.value[level].Region(rect), feature.lo.value[level].Region(rect), 
+                        feature.hi.value[level].Region(rect), feature.weight, dst);
                 }
             }
 
@@ -1125,17 +1351,21 @@ namespace Simd
             {
                 SIMD_CHECK_PERFORMANCE();
 
-                const Texture & texture = _scene.texture;
                 Pyramid & difference = _scene.difference;
                 Pyramid & buffer = _scene.buffer;
+                Pyramid & raw = _options.ActivityGatingEnable ? _scene.activity.difference : difference;
                 for (size_t i = 0; i < difference.Size(); ++i)
                 {
-                    Simd::Fill(difference[i], 0);
-                    for (size_t j = 0; j < texture.features.size(); ++j)
+                    if (Gated(i))
                     {
-                        const Texture::Feature & feature = *texture.features[j];
-                        Simd::AddFeatureDifference(feature.value[i], feature.lo.value[i], feature.hi.value[i], feature.weight, difference[i]);
+                        const Rects & rects = _scene.activity.rects[i];
+                        for (size_t j = 0; j < rects.size(); ++j)
+                            AddDifference(i, rects[j], raw[i]);
                     }
+                    else
+                        AddDifference(i, Rect(raw[i].Size()), raw[i]);
+                    if (_options.ActivityGatingEnable)
+                        Simd::Copy(raw[i], difference[i]);
                 }
                 if (_options.DifferencePropagateForward)
                 {
@@ -1549,11 +1779,67 @@ namespace Simd
                     Texture::Feature & feature = *features[i];
                     for (size_t j = 0; j < feature.value.Size(); ++j)
                     {
-                        updater(feature.value[j], feature.lo.value[j], feature.lo.count[j], feature.hi.value[j], feature.hi.count[j]);
+                        if (Gated(j))
+                        {
+                            const Rects & rects = _scene.activity.rects[j];
+                            for (size_t k = 0; k < rects.size(); ++k)
+                                Apply(feature, j, rects[k], updater);
+                        }
+                        else
+                            updater(feature.value[j], feature.lo.value[j], feature.lo.count[j], feature.hi.value[j], feature.hi.count[j]);
                     }
                 }
             }
 
+            template <typename Updater> void Apply(Texture::Feature & feature, size_t level, const Rect & rect, const Updater & updater)
+            {
+                View value = feature.value[level].Region(rect);
+                View loValue = feature.lo.value[level].Region(rect);
+                View loCount = feature.lo.count[level].Region(rect);
+                View hiValue = feature.hi.value[level].Region(rect);
+                View hiCount = feature.hi.count[level].Region(rect);
+                updater(value, loValue, loCount, hiValue, hiCount);
+            }
+
+            void CatchUpBackground()
+            {
+                Activity & activity = _scene.activity;
+                Texture::Features & features = _scene.texture.features;
+                for (ptrdiff_t y = 0, i = 0; y < activity.size.y; ++y)
+                {
+                    for (ptrdiff_t x = 0; x < activity.size.x; ++x, ++i)
+                    {
+                        if (activity.states[i] != Activity::CatchUp || activity.missed[i] == 0)
+                            continue;
+                        int count = std::min(activity.missed[i], _options.ActivityCatchUpMax);
+                        for (size_t level = 0; level < activity.levels; ++level)
+                        {
+                            Rect rect = activity.Level(activity.Tile(x, y), level, _scene.texture.gray.value[level].Size());
+                            if (rect.Area() == 0)
+                                continue;
+                            for (size_t f = 0; f < features.size(); ++f)
+                            {
+                                for (int c = 0; c < count; ++c)
+                                {
+                                    Apply(*features[f], level, rect, IncrementCountUpdater());
+                                    Apply(*features[f], level, rect, IncrementCountUpdater());
+                                    Apply(*features[f], level, rect, AdjustRangeUpdater());
+                                }
+                            }
+                        }
+                        activity.missed[i] = 0;
+                    }
+                }
+            }
+
+            void SkipBackgroundAdjustment()
+            {
+                Activity & activity = _scene.activity;
+                for (size_t i = 0; i < activity.states.size(); ++i)
+                    if (activity.states[i] == Activity::Static && activity.missed[i] < CHAR_MAX)
+                        activity.missed[i]++;
+            }
+
             void UpdateBackground()
             {
                 SIMD_CHECK_PERFORMANCE();
@@ -1567,6 +1853,8 @@ namespace Simd
                     switch (stability)
                     {
                     case Stability::Stable:
+                        if (Gated(0))
+                            CatchUpBackground();
                         background.statUpdateTime += time - background.lastFrameTime;
                         background.updateTime += time - background.lastFrameTime;
                         if (background.statUpdateTime > _options.BackgroundStatUpdateTime)
@@ -1577,6 +1865,8 @@ namespace Simd
                             if (background.updateCounter >= CHAR_MAX || (background.updateTime > _options.BackgroundUpdateTime && background.updateCounter >= 8))
                             {
                                 Apply(_scene.texture.features, AdjustRangeUpdater());
+                                if (Gated(0))
+                                    SkipBackgroundAdjustment();
                                 background.updateTime = 0;
                                 background.updateCounter = 0;
                             }
@@ -1620,6 +1910,8 @@ namespace Simd
             void InitBackground()
             {
                 Background & background = _scene.background;
+                _scene.activity.all = true;
+                _scene.activity.reset = true;
                 Apply(_scene.texture.features, InitUpdater());
                 background.growEndTime = _scene.input.timestamp + _options.BackgroundGrowTime;
                 background.state = Background::Grow;
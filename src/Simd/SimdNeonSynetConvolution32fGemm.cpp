@@ -616,7 +616,7 @@ namespace Simd
             }
             else if (p.IsKernel(2))
             {
-                if (!(p.IsPad(0) || (p.padY + p.padH == 1 && p.padX + p.padW == 1)))
+                if (!(p.IsPad(0) || (p.padY + p.padH == 1 && p.padY == p.padX && p.padH == p.padW)))
                     return false;
                 return p.trans && p.srcH >= 4 && p.srcW >= 4 && p.srcH * p.srcW * p.batch >= 36;
             }
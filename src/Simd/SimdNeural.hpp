@@ -500,12 +500,25 @@ namespace Simd
 
             virtual void Backward(const Vector & src, size_t thread) = 0;
 
+            virtual void ForwardBatch(const Vector * const * src, size_t first, size_t count, Method method)
+            {
+                for (size_t i = 0; i < count; ++i)
+                    Forward(*src[i], first + i, method);
+            }
+
+            virtual void BackwardBatch(const Vector * const * delta, size_t first, size_t count)
+            {
+                for (size_t i = 0; i < count; ++i)
+                    Backward(*delta[i], first + i);
+            }
+
             virtual size_t FanSrc() const = 0;
 
             virtual size_t FanDst() const = 0;
 
-            virtual void SetThreadNumber(size_t number, bool train)
+            virtual void SetThreadNumber(size_t number, bool train, size_t batch = 1)
             {
+                _batch = batch;
                 _common.resize(number);
                 for (size_t i = 0; i < _common.size(); ++i)
                 {
@@ -513,8 +526,8 @@ namespace Simd
                     _common[i].dst.resize(_dst.Volume());
                     if (train)
                     {
-                        _common[i].dWeight.resize(_weight.size());
-                        _common[i].dBias.resize(_bias.size());
+                        _common[i].dWeight.resize(i % _batch ? 0 : _weight.size());
+                        _common[i].dBias.resize(i % _batch ? 0 : _bias.size());
                         _common[i].prevDelta.resize(_src.Volume());
                     }
                 }
@@ -531,6 +544,7 @@ namespace Simd
                 , _function(f)
                 , _prev(0)
                 , _next(0)
+                , _batch(1)
             {
             }
 
@@ -556,10 +570,18 @@ namespace Simd
                 return _common[thread].prevDelta;
             }
 
+            struct Common;
+
+            SIMD_INLINE Common & Gradient(size_t thread)
+            {
+                return _common[thread - thread % _batch];
+            }
+
             const Type _type;
             const Function _function;
 
             Layer * _prev, *_next;
+            size_t _batch;
 
             Index _src, _dst;
             Vector _weight, _bias, _gWeight, _gBias;
@@ -760,8 +782,8 @@ namespace Simd
             {
                 const Vector & prevDst = _valid ? _prev->Dst(thread) : _specific[thread].paddedSrc;
                 Vector & prevDelta = _valid ? _common[thread].prevDelta : _specific[thread].paddedDelta;
-                Vector & dWeight = _common[thread].dWeight;
-                Vector & dBias = _common[thread].dBias;
+                Vector & dWeight = Gradient(thread).dWeight;
+                Vector & dBias = Gradient(thread).dBias;
 
                 Detail::SetZero(prevDelta);
 
@@ -849,6 +871,108 @@ namespace Simd
                 UnpadDelta(prevDelta, thread);
             }
 
+            void ForwardBatch(const Vector * const * src, size_t first, size_t count, Method method) override
+            {
+                if (_partial || count < 2)
+                {
+                    Layer::ForwardBatch(src, first, count, method);
+                    return;
+                }
+                Batch & batch = _batches[first / _batch];
+                size_t area = _dst.Area(), size = area * count, kernel = FanSrc();
+                batch.cols.resize(kernel * size);
+                batch.sum.resize(_dst.depth * size);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const Vector & padded = PaddedSrc(*src[i], first + i);
+                    float * cols = batch.cols.data() + i * area;
+                    for (ptrdiff_t sc = 0; sc < _src.depth; ++sc)
+                    {
+                        for (ptrdiff_t ky = 0; ky < _core.height; ++ky)
+                        {
+                            for (ptrdiff_t kx = 0; kx < _core.width; ++kx, cols += size)
+                            {
+                                for (ptrdiff_t y = 0; y < _dst.height; ++y)
+                                    memcpy(cols + y * _dst.width, _padded.Get(padded, kx, ky + y, sc), _dst.width * sizeof(float));
+                            }
+                        }
+                    }
+                }
+                const float alpha = 1.0f, beta = 0.0f;
+                ::SimdGemm32fNN(_dst.depth, size, kernel, &alpha, _weight.data(), kernel, batch.cols.data(), size, &beta, batch.sum.data(), size);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    Vector & sum = _common[first + i].sum;
+                    Vector & dst = _common[first + i].dst;
+                    for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
+                    {
+                        float * psum = _dst.Get(sum, 0, 0, dc);
+                        memcpy(psum, batch.sum.data() + dc * size + i * area, area * sizeof(float));
+                        if (_bias.size())
+                            ::SimdNeuralAddValue(_bias.data() + dc, psum, area);
+                    }
+                    _function.function(sum.data(), sum.size(), dst.data());
+                }
+            }
+
+            void BackwardBatch(const Vector * const * delta, size_t first, size_t count) override
+            {
+                if (_partial || count < 2)
+                {
+                    Layer::BackwardBatch(delta, first, count);
+                    return;
+                }
+                Batch & batch = _batches[first / _batch];
+                size_t area = _dst.Area(), size = area * count, kernel = FanSrc();
+                batch.delta.resize(_dst.depth * size);
+                batch.dCols.resize(kernel * size);
+                batch.weight.resize(_weight.size());
+                for (size_t i = 0; i < count; ++i)
+                {
+                    for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
+                        memcpy(batch.delta.data() + dc * size + i * area, _dst.Get(*delta[i], 0, 0, dc), area * sizeof(float));
+                }
+
+                const float alpha = 1.0f, zero = 0.0f, one = 1.0f;
+                Common & gradient = Gradient(first);
+                ::SimdGemm32fNT(_dst.depth, kernel, size, &alpha, batch.delta.data(), size, batch.cols.data(), size, &one, gradient.dWeight.data(), kernel);
+                if (gradient.dBias.size())
+                {
+                    for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
+                    {
+                        const float * pdelta = batch.delta.data() + dc * size;
+                        gradient.dBias[dc] += std::accumulate(pdelta, pdelta + size, float(0));
+                    }
+                }
+
+                for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
+                    for (size_t k = 0; k < kernel; ++k)
+                        batch.weight[k * _dst.depth + dc] = _weight[dc * kernel + k];
+                ::SimdGemm32fNN(kernel, size, _dst.depth, &alpha, batch.weight.data(), _dst.depth, batch.delta.data(), size, &zero, batch.dCols.data(), size);
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    size_t thread = first + i;
+                    const Vector & prevDst = _valid ? _prev->Dst(thread) : _specific[thread].paddedSrc;
+                    Vector & prevDelta = _valid ? _common[thread].prevDelta : _specific[thread].paddedDelta;
+                    Detail::SetZero(prevDelta);
+                    const float * dCols = batch.dCols.data() + i * area;
+                    for (ptrdiff_t sc = 0; sc < _src.depth; ++sc)
+                    {
+                        for (ptrdiff_t ky = 0; ky < _core.height; ++ky)
+                        {
+                            for (ptrdiff_t kx = 0; kx < _core.width; ++kx, dCols += size)
+                            {
+                                for (ptrdiff_t y = 0; y < _dst.height; ++y)
+                                    ::SimdNeuralAddVector(dCols + y * _dst.width, _dst.width, _padded.Get(prevDelta, kx, ky + y, sc));
+                            }
+                        }
+                    }
+                    _prev->_function.derivative(prevDst.data(), prevDst.size(), prevDelta.data());
+                    UnpadDelta(prevDelta, thread);
+                }
+            }
+
             size_t FanSrc() const override
             {
                 return _core.width*_core.height*_src.depth;
@@ -859,9 +983,10 @@ namespace Simd
                 return _core.width*_core.height*_dst.depth;
             }
 
-            virtual void SetThreadNumber(size_t number, bool train) override
+            virtual void SetThreadNumber(size_t number, bool train, size_t batch = 1) override
             {
-                Layer::SetThreadNumber(number, train);
+                Layer::SetThreadNumber(number, train, batch);
+                _batches.resize(train ? number / batch : 0);
                 _specific.resize(number);
                 for (size_t i = 0; i < _specific.size(); ++i)
                 {
@@ -914,6 +1039,12 @@ namespace Simd
             };
             std::vector<Specific> _specific;
 
+            struct Batch
+            {
+                Vector cols, sum, delta, dCols, weight;
+            };
+            std::vector<Batch> _batches;
+
             Index _core;
             Index _padded;
             Size _indent;
@@ -1063,9 +1194,9 @@ namespace Simd
                 _prev->_function.derivative(&prevDst[0], prevDst.size(), &prevDelta[0]);
             }
 
-            virtual void SetThreadNumber(size_t number, bool train) override
+            virtual void SetThreadNumber(size_t number, bool train, size_t batch = 1) override
             {
-                Layer::SetThreadNumber(number, train);
+                Layer::SetThreadNumber(number, train, batch);
                 if (train || _functionForward == 0)
                 {
                     _specific.resize(number);
@@ -1247,8 +1378,8 @@ namespace Simd
             {
                 const Vector & prevDst = _prev->Dst(thread);
                 Vector & prevDelta = _common[thread].prevDelta;
-                Vector & dWeight = _common[thread].dWeight;
-                Vector & dBias = _common[thread].dBias;
+                Vector & dWeight = Gradient(thread).dWeight;
+                Vector & dBias = Gradient(thread).dBias;
 
                 for (ptrdiff_t i = 0; i < _src.width; i++)
                     ::SimdNeuralProductSum(&currDelta[0], &_weight[i*_dst.width], _dst.width, &prevDelta[i]);
@@ -1262,6 +1393,69 @@ namespace Simd
                     ::SimdNeuralAddVector(currDelta.data(), _dst.width, dBias.data());
             }
 
+            void ForwardBatch(const Vector * const * src, size_t first, size_t count, Method method) override
+            {
+                if (method == Layer::Fast || count < 2)
+                {
+                    Layer::ForwardBatch(src, first, count, method);
+                    return;
+                }
+                assert(!_reordered);
+                Batch & batch = _batches[first / _batch];
+                batch.src.resize(count * _src.width);
+                batch.sum.resize(count * _dst.width);
+                for (size_t i = 0; i < count; ++i)
+                    memcpy(batch.src.data() + i * _src.width, src[i]->data(), _src.width * sizeof(float));
+
+                const float alpha = 1.0f, beta = 0.0f;
+                ::SimdGemm32fNN(count, _dst.width, _src.width, &alpha, batch.src.data(), _src.width, _weight.data(), _dst.width, &beta, batch.sum.data(), _dst.width);
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    Vector & sum = _common[first + i].sum;
+                    Vector & dst = _common[first + i].dst;
+                    memcpy(sum.data(), batch.sum.data() + i * _dst.width, _dst.width * sizeof(float));
+                    if (_bias.size())
+                        ::SimdNeuralAddVector(_bias.data(), sum.size(), sum.data());
+                    _function.function(sum.data(), sum.size(), dst.data());
+                }
+            }
+
+            void BackwardBatch(const Vector * const * delta, size_t first, size_t count) override
+            {
+                if (count < 2)
+                {
+                    Layer::BackwardBatch(delta, first, count);
+                    return;
+                }
+                Batch & batch = _batches[first / _batch];
+                batch.src.resize(_src.width * count);
+                batch.delta.resize(count * _dst.width);
+                batch.prevDelta.resize(count * _src.width);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const Vector & prevDst = _prev->Dst(first + i);
+                    for (ptrdiff_t j = 0; j < _src.width; ++j)
+                        batch.src[j * count + i] = prevDst[j];
+                    memcpy(batch.delta.data() + i * _dst.width, delta[i]->data(), _dst.width * sizeof(float));
+                }
+
+                const float alpha = 1.0f, zero = 0.0f, one = 1.0f;
+                Common & gradient = Gradient(first);
+                ::SimdGemm32fNT(count, _src.width, _dst.width, &alpha, batch.delta.data(), _dst.width, _weight.data(), _dst.width, &zero, batch.prevDelta.data(), _src.width);
+                ::SimdGemm32fNN(_src.width, _dst.width, count, &alpha, batch.src.data(), count, batch.delta.data(), _dst.width, &one, gradient.dWeight.data(), _dst.width);
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const Vector & prevDst = _prev->Dst(first + i);
+                    Vector & prevDelta = _common[first + i].prevDelta;
+                    memcpy(prevDelta.data(), batch.prevDelta.data() + i * _src.width, _src.width * sizeof(float));
+                    _prev->_function.derivative(prevDst.data(), prevDst.size(), prevDelta.data());
+                    if (_bias.size())
+                        ::SimdNeuralAddVector(batch.delta.data() + i * _dst.width, _dst.width, gradient.dBias.data());
+                }
+            }
+
             size_t FanSrc() const override
             {
                 return _src.width;
@@ -1272,9 +1466,21 @@ namespace Simd
                 return _dst.width;
             }
 
+            virtual void SetThreadNumber(size_t number, bool train, size_t batch = 1) override
+            {
+                Layer::SetThreadNumber(number, train, batch);
+                _batches.resize(train ? number / batch : 0);
+            }
+
         protected:
             bool _reordered;
             std::mutex _mutex;
+
+            struct Batch
+            {
+                Vector src, sum, delta, prevDelta;
+            };
+            std::vector<Batch> _batches;
         };
 
         /*! @ingroup cpp_neural
@@ -1341,9 +1547,9 @@ namespace Simd
                 return 1;
             }
 
-            virtual void SetThreadNumber(size_t number, bool train) override
+            virtual void SetThreadNumber(size_t number, bool train, size_t batch = 1) override
             {
-                Layer::SetThreadNumber(number, train);
+                Layer::SetThreadNumber(number, train, batch);
                 _specific.resize(number);
                 if (train)
                 {
@@ -1491,11 +1697,11 @@ namespace Simd
                     delta[i] = -control[i] / current[i];
             }
 
-            template<TrainOptions::UpdateType type> void UpdateWeight(const TrainOptions & o, const Vector & d, Vector & g, Vector & v);
+            template<TrainOptions::UpdateType type> void UpdateWeight(const TrainOptions & o, const float * d, size_t size, float * g, float * v);
 
-            template<> SIMD_INLINE void UpdateWeight<TrainOptions::AdaptiveGradient>(const TrainOptions & o, const Vector & d, Vector & g, Vector & v)
+            template<> SIMD_INLINE void UpdateWeight<TrainOptions::AdaptiveGradient>(const TrainOptions & o, const float * d, size_t size, float * g, float * v)
             {
-                ::SimdNeuralAdaptiveGradientUpdate(d.data(), d.size(), o.batchSize, &o.alpha, &o.epsilon, g.data(), v.data());
+                ::SimdNeuralAdaptiveGradientUpdate(d, size, o.batchSize, &o.alpha, &o.epsilon, g, v);
             }
         }
 
@@ -1609,9 +1815,13 @@ namespace Simd
                     return false;
 
                 options.threadNumber = std::max<size_t>(1, std::min<size_t>(options.threadNumber, std::thread::hardware_concurrency()));
+                size_t batch = (std::max<size_t>(1, options.batchSize) + options.threadNumber - 1) / options.threadNumber;
 
                 for (size_t i = 0; i < _layers.size(); ++i)
-                    _layers[i]->SetThreadNumber(options.threadNumber, true);
+                    _layers[i]->SetThreadNumber(options.threadNumber * batch, true, batch);
+                _delta.resize(options.threadNumber * batch);
+
+                ThreadPool pool(options.threadNumber);
 
                 if (options.epochStart == 0)
                     InitWeight(options);
@@ -1634,8 +1844,8 @@ namespace Simd
                 {
                     for (size_t i = 0; i < src.size(); i += options.batchSize)
                     {
-                        Propagate(src, dst, index, i, std::min(i + options.batchSize, src.size()), options);
-                        UpdateWeight(options);
+                        Propagate(src, dst, index, i, std::min(i + options.batchSize, src.size()), options, pool);
+                        UpdateWeight(options, pool);
                     }
                     logger();
                 }
@@ -1890,6 +2100,7 @@ namespace Simd
 
         private:
             LayerPtrs _layers;
+            Vectors _delta;
 
             size_t Requred(bool train) const
             {
@@ -1935,11 +2146,9 @@ namespace Simd
                 return false;
             }
 
-            void Backward(const Vector & current, const Vector & control, size_t thread, const TrainOptions & options)
+            void Delta(const Vector & current, const Vector & control, const TrainOptions & options, Vector & delta)
             {
-                SIMD_CHECK_PERFORMANCE();
-
-                Vector delta(current.size());
+                delta.resize(current.size());
                 if (Cannonical(options))
                 {
                     for (size_t i = 0; i < current.size(); ++i)
@@ -1967,24 +2176,36 @@ namespace Simd
                         _layers.back()->_function.derivative(current.data(), current.size(), delta.data());
                     }
                 }
-
-                _layers.back()->Backward(delta, thread);
-                for (ptrdiff_t i = _layers.size() - 2; i >= 0; --i)
-                    _layers[i]->Backward(_layers[i + 1]->Delta(thread), thread);
             }
 
-            void Propagate(const Vectors & src, const Vectors & dst, const Labels & index, size_t start, size_t finish, const TrainOptions & options)
+            void Propagate(const Vectors & src, const Vectors & dst, const Labels & index, size_t start, size_t finish, const TrainOptions & options, ThreadPool & pool)
             {
                 SIMD_CHECK_PERFORMANCE();
 
-                Parallel(start, finish, [&](size_t thread, size_t begin, size_t end)
+                pool.Run(start, finish, [&](size_t thread, size_t begin, size_t end)
                 {
-                    for (size_t i = begin; i < end; ++i)
+                    size_t first = thread * _layers.front()->_batch, count = end - begin;
+                    std::vector<const Vector*> batch(count);
+                    for (size_t i = 0; i < count; ++i)
+                        batch[i] = &src[index[begin + i]];
+                    for (size_t l = 0; l < _layers.size(); ++l)
+                    {
+                        _layers[l]->ForwardBatch(batch.data(), first, count, Layer::Train);
+                        for (size_t i = 0; i < count; ++i)
+                            batch[i] = &_layers[l]->Dst(first + i);
+                    }
+                    for (size_t i = 0; i < count; ++i)
                     {
-                        Vector current = Forward(src[index[i]], thread, Layer::Train);
-                        Backward(current, dst[index[i]], thread, options);
+                        Delta(*batch[i], dst[index[begin + i]], options, _delta[first + i]);
+                        batch[i] = &_delta[first + i];
                     }
-                }, options.threadNumber);
+                    for (ptrdiff_t l = _layers.size() - 1; l >= 0; --l)
+                    {
+                        _layers[l]->BackwardBatch(batch.data(), first, count);
+                        for (size_t i = 0; i < count; ++i)
+                            batch[i] = &_layers[l]->Delta(first + i);
+                    }
+                });
             }
 
             template<TrainOptions::InitType type> void InitWeight()
@@ -2017,33 +2238,42 @@ namespace Simd
                 }
             }
 
-            template<TrainOptions::UpdateType type> void UpdateWeight(const TrainOptions & options)
+            template<TrainOptions::UpdateType type> void UpdateWeight(const TrainOptions & options, Layer & layer, Vector Layer::Common::* delta, Vector & gradient, Vector & value, ThreadPool & pool)
             {
-                for (size_t l = 0; l < _layers.size(); ++l)
+                if (value.empty())
+                    return;
+                pool.Run(0, value.size(), [&](size_t thread, size_t begin, size_t end)
                 {
-                    Layer & layer = *_layers[l];
-                    for (size_t t = 1; t < layer._common.size(); ++t)
-                    {
-                        ::SimdNeuralAddVector(layer._common[t].dWeight.data(), layer._common[t].dWeight.size(), layer._common[0].dWeight.data());
-                        ::SimdNeuralAddVector(layer._common[t].dBias.data(), layer._common[t].dBias.size(), layer._common[0].dBias.data());
-                    }
-                    Detail::UpdateWeight<type>(options, layer._common[0].dWeight, layer._gWeight, layer._weight);
-                    Detail::UpdateWeight<type>(options, layer._common[0].dBias, layer._gBias, layer._bias);
-                    for (size_t t = 0; t < layer._common.size(); ++t)
+                    size_t size = end - begin;
+                    float * sum = (layer._common[0].*delta).data() + begin;
+                    for (size_t t = layer._batch; t < layer._common.size(); t += layer._batch)
                     {
-                        Detail::SetZero(layer._common[t].dWeight);
-                        Detail::SetZero(layer._common[t].dBias);
+                        float * part = (layer._common[t].*delta).data() + begin;
+                        ::SimdNeuralAddVector(part, size, sum);
+                        memset(part, 0, size * sizeof(float));
                     }
+                    Detail::UpdateWeight<type>(options, sum, size, gradient.data() + begin, value.data() + begin);
+                    memset(sum, 0, size * sizeof(float));
+                }, 64);
+            }
+
+            template<TrainOptions::UpdateType type> void UpdateWeight(const TrainOptions & options, ThreadPool & pool)
+            {
+                for (size_t l = 0; l < _layers.size(); ++l)
+                {
+                    Layer & layer = *_layers[l];
+                    UpdateWeight<type>(options, layer, &Layer::Common::dWeight, layer._gWeight, layer._weight, pool);
+                    UpdateWeight<type>(options, layer, &Layer::Common::dBias, layer._gBias, layer._bias, pool);
                 }
             }
 
-            void UpdateWeight(const TrainOptions & options)
+            void UpdateWeight(const TrainOptions & options, ThreadPool & pool)
             {
                 SIMD_CHECK_PERFORMANCE();
 
                 switch (options.updateType)
                 {
-                case TrainOptions::AdaptiveGradient: UpdateWeight<TrainOptions::AdaptiveGradient>(options); break;
+                case TrainOptions::AdaptiveGradient: UpdateWeight<TrainOptions::AdaptiveGradient>(options, pool); break;
                 }
             }
         };
@@ -0,0 +1,485 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdOverlay_hpp__
+#define __SimdOverlay_hpp__
+
+#include "Simd/SimdFont.hpp"
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
+#include <string>
+#include <algorithm>
+
+namespace Simd
+{
+    /*! @ingroup cpp_drawing
+
+        \short The Overlay class provides batched drawing of annotations (boxes, lines, labels and masks).
+
+        Drawing primitives are accumulated in the list and then rendered by one call of Overlay::Render.
+        The canvas is split into horizontal bands which are processed in parallel. For every band the primitives are rasterized
+        into a band-sized overlay image (color and alpha) and then the touched parts of the band are blended with the canvas
+        by one call of ::SimdAlphaBlending.
+
+        \note Canvas pixel size must be equal to size of color of every primitive (1, 2, 3 or 4 bytes).
+
+        Using example:
+        \code
+        #include "Simd/SimdOverlay.hpp"
+
+        int main()
+        {
+            typedef Simd::Pixel::Bgr24 Color;
+            typedef Simd::Overlay::View View;
+
+            View image;
+            image.Load("image.ppm");
+
+            Simd::Font font(16);
+            Simd::Overlay overlay;
+            for (int i = 0; i < 100; ++i)
+            {
+                Simd::Rectangle<ptrdiff_t> box(i * 10, i * 5, i * 10 + 50, i * 5 + 80);
+                overlay.DrawRectangle(box, Color(0, 255, 0), 2);
+                overlay.DrawText(font, "person", box.TopLeft() - Simd::Point<ptrdiff_t>(0, font.Height()), Color(0, 0, 255));
+            }
+            overlay.Render(image);
+
+            image.Save("annotated.ppm");
+
+            return 0;
+        }
+        \endcode
+    */
+    class Overlay
+    {
+    public:
+        typedef std::string String; /*!< String type definition. */
+        typedef Simd::Point<ptrdiff_t> Point; /*!< Point type definition. */
+        typedef Simd::Rectangle<ptrdiff_t> Rect; /*!< Rectangle type definition. */
+        typedef Simd::View<Simd::Allocator> View; /*!< Image type definition. */
+
+        /*!
+            Creates a new empty Overlay class.
+
+            \param [in] bandHeight - a height of horizontal band which is processed by one thread. By default it is equal to 64.
+            \param [in] threadNumber - a maximal number of threads used for rendering. By default it is equal to ::SimdGetThreadNumber.
+        */
+        Overlay(size_t bandHeight = 64, size_t threadNumber = 0)
+            : _bandHeight(std::max<size_t>(bandHeight, 1))
+            , _threadNumber(threadNumber ? threadNumber : ::SimdGetThreadNumber())
+        {
+        }
+
+        /*!
+            Removes all accumulated primitives.
+        */
+        void Clear()
+        {
+            _items.clear();
+        }
+
+        /*!
+            Checks the list of accumulated primitives.
+
+            \return true if there are no primitives to render.
+        */
+        bool Empty() const
+        {
+            return _items.empty();
+        }
+
+        /*!
+            Adds a line to the overlay.
+
+            \param [in] p1 - the first point of the line.
+            \param [in] p2 - the second point of the line.
+            \param [in] color - a color of the line.
+            \param [in] width - a width of the line. By default it is equal to 1.
+            \param [in] alpha - an opacity of the line. By default it is equal to 255.
+        */
+        template <class Color> void DrawLine(const Point & p1, const Point & p2, const Color & color, size_t width = 1, uint8_t alpha = 255)
+        {
+            if (width == 0 || alpha == 0)
+                return;
+            Item & item = Add(color, alpha);
+            Rasterize(p1.x, p1.y, p2.x, p2.y, (ptrdiff_t)width, item);
+        }
+
+        /*!
+            Adds a rectangle frame to the overlay.
+
+            \param [in] rect - a rectangle.
+            \param [in] color - a color of the rectangle frame.
+            \param [in] width - a width of the rectangle frame. By default it is equal to 1.
+            \param [in] alpha - an opacity of the rectangle frame. By default it is equal to 255.
+        */
+        template <class Color> void DrawRectangle(const Rect & rect, const Color & color, size_t width = 1, uint8_t alpha = 255)
+        {
+            if (width == 0 || alpha == 0)
+                return;
+            ptrdiff_t w = (ptrdiff_t)width, h = w / 2;
+            ptrdiff_t l = rect.left - h, t = rect.top - h, r = rect.right - h + w, b = rect.bottom - h + w;
+            if (r - l <= 2 * w || b - t <= 2 * w)
+            {
+                DrawFilledRectangle(Rect(l, t, r, b), color, alpha);
+                return;
+            }
+            DrawFilledRectangle(Rect(l, t, r, t + w), color, alpha);
+            DrawFilledRectangle(Rect(l, t + w, l + w, b - w), color, alpha);
+            DrawFilledRectangle(Rect(r - w, t + w, r, b - w), color, alpha);
+            DrawFilledRectangle(Rect(l, b - w, r, b), color, alpha);
+        }
+
+        /*!
+            Adds a filled rectangle to the overlay.
+
+            \param [in] rect - a rectangle to fill.
+            \param [in] color - a color of the filled rectangle.
+            \param [in] alpha - an opacity of the filled rectangle. By default it is equal to 255.
+        */
+        template <class Color> void DrawFilledRectangle(const Rect & rect, const Color & color, uint8_t alpha = 255)
+        {
+            if (rect.Empty() || alpha == 0)
+                return;
+            Item & item = Add(color, alpha);
+            item.rect = rect;
+        }
+
+        /*!
+            Adds a mask (for example a segmentation mask of the object) to the overlay.
+
+            \note The mask is not copied. It has to be valid until call of Overlay::Render.
+
+            \param [in] mask - an 8-bit gray mask (coverage) of the object.
+            \param [in] position - a position of top-left corner of the mask at the canvas.
+            \param [in] color - a color of the mask.
+            \param [in] alpha - an opacity of the mask. By default it is equal to 255.
+        */
+        template <class Color> void DrawMask(const View & mask, const Point & position, const Color & color, uint8_t alpha = 255)
+        {
+            assert(mask.format == View::Gray8);
+            if (mask.Area() == 0 || alpha == 0)
+                return;
+            Item & item = Add(color, alpha);
+            item.rect = Rect(position, position + mask.Size());
+            item.mask = mask;
+        }
+
+        /*!
+            Adds a text to the overlay.
+
+            \param [in] font - a font used to draw text.
+            \param [in] text - a text to draw.
+            \param [in] position - a start position to draw text.
+            \param [in] color - a color of the text.
+            \param [in] alpha - an opacity of the text. By default it is equal to 255.
+        */
+        template <class Color> void DrawText(const Font & font, const String & text, const Point & position, const Color & color, uint8_t alpha = 255)
+        {
+            if (alpha == 0)
+                return;
+            View mask;
+            font.CreateMask(text, mask);
+            if (mask.Area() == 0)
+                return;
+            Item & item = Add(color, alpha);
+            item.rect = Rect(position, position + mask.Size());
+            item.mask.Swap(mask);
+        }
+
+        /*!
+            Adds a text with filled background (label) to the overlay.
+
+            \param [in] font - a font used to draw text.
+            \param [in] text - a text to draw.
+            \param [in] position - a start position to draw text.
+            \param [in] color - a color of the text.
+            \param [in] background - a color of the text background.
+            \param [in] alpha - an opacity of the background. By default it is equal to 255.
+        */
+        template <class Color> void DrawText(const Font & font, const String & text, const Point & position, const Color & color, const Color & background, uint8_t alpha = 255)
+        {
+            DrawFilledRectangle(Rect(position, position + font.Measure(text)), background, alpha);
+            DrawText(font, text, position, color);
+        }
+
+        /*!
+            Renders all accumulated primitives at the canvas. The list of primitives is not cleared.
+
+            \param [in, out] canvas - a canvas (image where we draw).
+
+            \return a result of the operation.
+        */
+        template<template<class> class A> bool Render(Simd::View<A> & canvas)
+        {
+            size_t pixelSize = canvas.PixelSize();
+            for (size_t i = 0; i < _items.size(); ++i)
+            {
+                if (_items[i].size != pixelSize)
+                    return false;
+            }
+            if (_items.empty() || canvas.Area() == 0)
+                return true;
+
+            size_t bandNumber = (canvas.height + _bandHeight - 1) / _bandHeight;
+            _bands.resize(bandNumber);
+            for (size_t b = 0; b < bandNumber; ++b)
+                _bands[b].clear();
+            Rect frame(canvas.Size());
+            for (size_t i = 0; i < _items.size(); ++i)
+            {
+                Rect rect = frame.Intersection(_items[i].rect);
+                if (rect.Empty())
+                    continue;
+                for (size_t b = rect.top / _bandHeight, e = (rect.bottom - 1) / _bandHeight; b <= e; ++b)
+                    _bands[b].push_back(i);
+            }
+
+            _buffers.resize(std::max<size_t>(_threadNumber, 1));
+            Simd::Parallel(0, bandNumber, [&](size_t thread, size_t begin, size_t end)
+            {
+                Buffer & buffer = _buffers[thread];
+                buffer.Init(canvas.width, _bandHeight, (View::Format)canvas.format);
+                for (size_t b = begin; b < end; ++b)
+                {
+                    ptrdiff_t top = b * _bandHeight, bottom = std::min(b * _bandHeight + _bandHeight, canvas.height);
+                    std::fill(buffer.tiles.begin(), buffer.tiles.end(), 0);
+                    RenderBand(_bands[b], top, bottom, buffer);
+                    BlendBand(buffer, bottom - top, canvas.data + top * canvas.stride, canvas.stride);
+                }
+            }, _threadNumber);
+
+            return true;
+        }
+
+    private:
+        struct Span
+        {
+            ptrdiff_t begin, end;
+        };
+        typedef std::vector<Span> Spans;
+
+        struct Item
+        {
+            Rect rect;
+            uint8_t color[4];
+            size_t size;
+            uint8_t alpha;
+            View mask;
+            Spans rows;
+        };
+        typedef std::vector<Item> Items;
+
+        static const ptrdiff_t TILE = 64;
+
+        struct Buffer
+        {
+            View color, alpha;
+            std::vector<uint8_t> tiles;
+
+            void Init(size_t width, size_t height, View::Format format)
+            {
+                if (color.width != width || color.height != height || color.format != format)
+                {
+                    color.Recreate(width, height, format);
+                    alpha.Recreate(width, height, View::Gray8);
+                }
+                tiles.assign((width + TILE - 1) / TILE, 0);
+            }
+        };
+        typedef std::vector<Buffer> Buffers;
+
+        size_t _bandHeight, _threadNumber;
+        Items _items;
+        std::vector<std::vector<size_t>> _bands;
+        Buffers _buffers;
+
+        template <class Color> Item & Add(const Color & color, uint8_t alpha)
+        {
+            assert(sizeof(Color) <= 4);
+            _items.push_back(Item());
+            Item & item = _items.back();
+            memcpy(item.color, &color, sizeof(Color));
+            item.size = sizeof(Color);
+            item.alpha = alpha;
+            return item;
+        }
+
+        static void Rasterize(ptrdiff_t x1, ptrdiff_t y1, ptrdiff_t x2, ptrdiff_t y2, ptrdiff_t width, Item & item)
+        {
+            const bool inverse = std::abs(y2 - y1) > std::abs(x2 - x1);
+            if (inverse)
+            {
+                std::swap(x1, y1);
+                std::swap(x2, y2);
+            }
+            if (x1 > x2)
+            {
+                std::swap(x1, x2);
+                std::swap(y1, y2);
+            }
+            ptrdiff_t top = std::min(y1, y2) - width / 2, bottom = std::max(y1, y2) - width / 2 + width;
+            if (inverse)
+            {
+                item.rect = Rect(top, x1, bottom, x2 + 1);
+                item.rows.resize(x2 - x1 + 1);
+            }
+            else
+            {
+                item.rect = Rect(x1, top, x2 + 1, bottom);
+                item.rows.resize(bottom - top);
+                for (size_t i = 0; i < item.rows.size(); ++i)
+                    item.rows[i].begin = x2 + 1, item.rows[i].end = x1;
+            }
+
+            const double dx = double(x2 - x1);
+            const double dy = (double)std::abs(y2 - y1);
+            double error = dx / 2.0f;
+            const ptrdiff_t ystep = (y1 < y2) ? 1 : -1;
+            ptrdiff_t y0 = y1 - width / 2;
+            for (ptrdiff_t x = x1; x <= x2; x++)
+            {
+                if (inverse)
+                {
+                    Span & span = item.rows[x - x1];
+                    span.begin = y0;
+                    span.end = y0 + width;
+                }
+                else
+                {
+                    for (ptrdiff_t y = y0, end = y0 + width; y < end; ++y)
+                    {
+                        Span & span = item.rows[y - top];
+                        span.begin = std::min(span.begin, x);
+                        span.end = std::max(span.end, x + 1);
+                    }
+                }
+                error -= dy;
+                if (error < 0)
+                {
+                    y0 += ystep;
+                    error += dx;
+                }
+            }
+        }
+
+        void RenderBand(const std::vector<size_t> & band, ptrdiff_t top, ptrdiff_t bottom, Buffer & buffer) const
+        {
+            Rect frame(0, top, buffer.color.width, bottom);
+            for (size_t i = 0; i < band.size(); ++i)
+            {
+                const Item & item = _items[band[i]];
+                Rect rect = frame.Intersection(item.rect);
+                if (item.rows.size())
+                {
+                    for (ptrdiff_t y = rect.top; y < rect.bottom; ++y)
+                    {
+                        const Span & span = item.rows[y - item.rect.top];
+                        ptrdiff_t begin = std::max<ptrdiff_t>(span.begin, rect.left), end = std::min<ptrdiff_t>(span.end, rect.right);
+                        if (begin < end)
+                            Paint(item, Rect(begin, y - top, end, y - top + 1), NULL, 0, buffer);
+                    }
+                }
+                else if (item.mask.data)
+                {
+                    const uint8_t * mask = item.mask.data + (rect.top - item.rect.top) * item.mask.stride + rect.left - item.rect.left;
+                    Paint(item, rect.Shifted(0, -top), mask, item.mask.stride, buffer);
+                }
+                else
+                    Paint(item, rect.Shifted(0, -top), NULL, 0, buffer);
+            }
+        }
+
+        static void Paint(const Item & item, const Rect & rect, const uint8_t * mask, size_t maskStride, Buffer & buffer)
+        {
+            for (ptrdiff_t t = rect.left / TILE, end = (rect.right - 1) / TILE; t <= end; ++t)
+            {
+                if (buffer.tiles[t] == 0)
+                {
+                    size_t left = t * TILE, width = std::min<size_t>(left + TILE, buffer.alpha.width) - left;
+                    ::SimdFill(buffer.alpha.data + left, buffer.alpha.stride, width, buffer.alpha.height, 1, 0);
+                    buffer.tiles[t] = 1;
+                }
+            }
+            size_t size = item.size;
+            uint8_t * color = buffer.color.data + rect.top * buffer.color.stride + rect.left * size;
+            uint8_t * alpha = buffer.alpha.data + rect.top * buffer.alpha.stride + rect.left;
+            if (mask == NULL && item.alpha == 255)
+            {
+                ::SimdFillPixel(color, buffer.color.stride, rect.Width(), rect.Height(), item.color, size);
+                ::SimdFill(alpha, buffer.alpha.stride, rect.Width(), rect.Height(), 1, 255);
+                return;
+            }
+            for (ptrdiff_t y = 0; y < rect.Height(); ++y)
+            {
+                for (ptrdiff_t x = 0, offset = 0; x < rect.Width(); ++x, offset += size)
+                {
+                    int a = mask ? (mask[x] * item.alpha + 127) / 255 : item.alpha;
+                    if (a == 0)
+                        continue;
+                    int b = alpha[x];
+                    if (a == 255 || b == 0)
+                    {
+                        for (size_t c = 0; c < size; ++c)
+                            color[offset + c] = item.color[c];
+                        alpha[x] = (uint8_t)a;
+                    }
+                    else
+                    {
+                        int rest = (b * (255 - a) + 127) / 255, sum = a + rest;
+                        for (size_t c = 0; c < size; ++c)
+                            color[offset + c] = (uint8_t)((item.color[c] * a + color[offset + c] * rest + sum / 2) / sum);
+                        alpha[x] = (uint8_t)sum;
+                    }
+                }
+                color += buffer.color.stride;
+                alpha += buffer.alpha.stride;
+                if (mask)
+                    mask += maskStride;
+            }
+        }
+
+        static void BlendBand(Buffer & buffer, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            size_t size = buffer.color.PixelSize(), tiles = buffer.tiles.size();
+            for (size_t t = 0; t < tiles;)
+            {
+                if (buffer.tiles[t] == 0)
+                {
+                    t++;
+                    continue;
+                }
+                size_t begin = t;
+                while (t < tiles && buffer.tiles[t])
+                    t++;
+                size_t left = begin * TILE, width = std::min<size_t>(t * TILE, buffer.color.width) - left;
+                ::SimdAlphaBlending(buffer.color.data + left * size, buffer.color.stride, width, height, size,
+                    buffer.alpha.data + left, buffer.alpha.stride, dst + left * size, dstStride);
+            }
+        }
+    };
+}
+
+#endif//__SimdOverlay_hpp__
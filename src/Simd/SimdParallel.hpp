@@ -28,6 +28,9 @@
 #include <thread>
 #ifndef SIMD_FUTURE_DISABLE
 #include <future>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
 #endif
 
 namespace Simd
@@ -62,6 +65,143 @@ namespace Simd
         }
 #endif
     }
+
+    /*! @ingroup cpp_parallel
+
+        \short ThreadPool class.
+
+        Keeps a set of persistent work threads to run many short parallel tasks without creation of new threads for every task.
+        The calling thread takes part in execution of every task as thread with number 0.
+    */
+    class ThreadPool
+    {
+    public:
+        /*!
+            \short Creates a new thread pool.
+
+            \param [in] threadNumber - a total number of threads (including calling thread).
+        */
+        ThreadPool(size_t threadNumber)
+            : _task(NULL)
+            , _pending(0)
+            , _generation(0)
+            , _stop(false)
+        {
+#ifndef SIMD_FUTURE_DISABLE
+            threadNumber = std::max<size_t>(1, std::min<size_t>(threadNumber, std::thread::hardware_concurrency()));
+            for (size_t thread = 1; thread < threadNumber; ++thread)
+                _threads.push_back(std::thread(&ThreadPool::Work, this, thread));
+#endif
+        }
+
+        /*!
+            \short Stops and joins all work threads.
+        */
+        ~ThreadPool()
+        {
+#ifndef SIMD_FUTURE_DISABLE
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _start.notify_all();
+            for (size_t i = 0; i < _threads.size(); ++i)
+                _threads[i].join();
+#endif
+        }
+
+        /*!
+            \short Gets total number of threads in the pool (including calling thread).
+
+            \return a number of threads.
+        */
+        size_t Size() const
+        {
+            return _threads.size() + 1;
+        }
+
+        /*!
+            \short Performs parallel execution of given function over range [begin, end).
+
+            It splits range in the same way as function Simd::Parallel.
+
+            \param [in] begin - a begin of the range.
+            \param [in] end - an end of the range.
+            \param [in] function - a function with signature void(size_t thread, size_t begin, size_t end).
+            \param [in] blockAlign - an alignment of range blocks. By default it is equal to 1.
+        */
+        template<class Function> void Run(size_t begin, size_t end, const Function & function, size_t blockAlign = 1)
+        {
+            size_t threadNumber = Size();
+            if (threadNumber <= 1 || size_t(blockAlign * 1.5) >= (end - begin))
+            {
+                function(0, begin, end);
+                return;
+            }
+#ifndef SIMD_FUTURE_DISABLE
+            size_t blockSize = (end - begin + threadNumber - 1) / threadNumber;
+            blockSize = (blockSize + blockAlign - 1) / blockAlign * blockAlign;
+            Task task = [begin, end, blockSize, &function](size_t thread)
+            {
+                size_t blockBegin = begin + thread * blockSize;
+                size_t blockEnd = std::min(blockBegin + blockSize, end);
+                if (blockBegin < blockEnd)
+                    function(thread, blockBegin, blockEnd);
+            };
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _task = &task;
+                _pending = _threads.size();
+                _generation++;
+            }
+            _start.notify_all();
+            task(0);
+            std::unique_lock<std::mutex> lock(_mutex);
+            _finish.wait(lock, [this] { return _pending == 0; });
+            _task = NULL;
+#endif
+        }
+
+    private:
+        typedef std::function<void(size_t)> Task;
+
+        ThreadPool(const ThreadPool &);
+        ThreadPool & operator = (const ThreadPool &);
+
+#ifndef SIMD_FUTURE_DISABLE
+        void Work(size_t thread)
+        {
+            size_t generation = 0;
+            for (;;)
+            {
+                const Task * task = NULL;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _start.wait(lock, [this, generation] { return _stop || _generation != generation; });
+                    if (_stop)
+                        return;
+                    generation = _generation;
+                    task = _task;
+                }
+                (*task)(thread);
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (--_pending == 0)
+                        _finish.notify_one();
+                }
+            }
+        }
+
+        std::vector<std::thread> _threads;
+        std::mutex _mutex;
+        std::condition_variable _start, _finish;
+#else
+        std::vector<int> _threads;
+#endif
+        const Task * _task;
+        size_t _pending, _generation;
+        bool _stop;
+    };
 }
 
-#endif//__SimdParallel_hpp__
+#endif//__SimdParallel_hpp__
\ No newline at end of file
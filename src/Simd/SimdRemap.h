@@ -0,0 +1,176 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdRemap_h__
+#define __SimdRemap_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct RemapParam
+    {
+        static const int BorderSizeMax = 4 * 4;
+
+        SimdWarpAffineFlags flags;
+        uint8_t border[BorderSizeMax];
+        size_t srcW, srcH, srcS, dstW, dstH, dstS, channels;
+
+        RemapParam(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        bool Valid() const
+        {
+            return channels >= 1 && channels <= 4 && srcW > 0 && srcH > 0 && dstW > 0 && dstH > 0 && srcH * srcS < 0x80000000 &&
+                ((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte || (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelFloat);
+        }
+
+        bool IsNearest() const
+        {
+            return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest;
+        }
+
+        bool IsFloat() const
+        {
+            return (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelFloat;
+        }
+
+        bool NeedFill() const
+        {
+            return (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant;
+        }
+
+        size_t ChannelSize() const
+        {
+            return IsFloat() ? 4 : 1;
+        }
+
+        size_t PixelSize() const
+        {
+            return ChannelSize() * channels;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    struct RemapEdge
+    {
+        int32_t x, ix, iy;
+    };
+
+    struct RemapTab
+    {
+        const uint32_t* offs;
+        const uint8_t* fx;
+        const uint16_t* fy;
+        const float* wx;
+        const float* wy;
+        const RemapEdge* edges;
+        const uint32_t* rows;
+        const int32_t* ib;
+        const int32_t* ie;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        class Remap : public Deletable
+        {
+        public:
+            typedef void(*RunPtr)(const RemapParam& p, const RemapTab& t, int yBeg, int yEnd, const uint8_t* src, uint8_t* dst, uint8_t* buf);
+
+            Remap(const RemapParam& param);
+
+            bool SetMap(const void* map, SimdTensorDataType type);
+            bool SetPerspective(const float* mat);
+
+            void Run(const uint8_t* src, uint8_t* dst);
+
+        protected:
+            void Reserve();
+            void SetRow(size_t y, const float* map);
+            void SetTab();
+
+            RemapParam _param;
+            size_t _threads, _size;
+            Array32u _offs, _rows;
+            Array32i _ib, _ie;
+            Array8u _fx, _buf;
+            Array16u _fy;
+            Array32f _wx, _wy;
+            std::vector<RemapEdge> _edges, _cand;
+            RemapTab _tab;
+            RunPtr _run;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const void* map, SimdTensorDataType mapType, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        class Remap : public Base::Remap
+        {
+        public:
+            Remap(const RemapParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const void* map, SimdTensorDataType mapType, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        class Remap : public Sse41::Remap
+        {
+        public:
+            Remap(const RemapParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const void* map, SimdTensorDataType mapType, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+#endif
+}
+#endif//__SimdRemap_h__
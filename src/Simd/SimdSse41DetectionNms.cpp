@@ -0,0 +1,148 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDetectionNms.h"
+#include "Simd/SimdConst.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE void DecodeSsd(const float* loc, const float* prior, const float* variance, bool clip, float* dst)
+        {
+            __m128 p = _mm_loadu_ps(prior);
+            __m128 d = _mm_mul_ps(_mm_loadu_ps(loc), _mm_loadu_ps(variance));
+            __m128 p0 = _mm_movelh_ps(p, p);
+            __m128 p1 = _mm_movehl_ps(p, p);
+            __m128 pwh = _mm_sub_ps(p1, p0);
+            __m128 c = _mm_add_ps(_mm_mul_ps(_mm_add_ps(p0, p1), _mm_set1_ps(0.5f)), _mm_mul_ps(_mm_movelh_ps(d, d), pwh));
+            __m128 s = _mm_mul_ps(_mm_mul_ps(Exponent(_mm_movehl_ps(d, d)), pwh), _mm_setr_ps(-0.5f, -0.5f, 0.5f, 0.5f));
+            __m128 r = _mm_add_ps(c, s);
+            if (clip)
+                r = _mm_min_ps(_mm_max_ps(r, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+            _mm_storeu_ps(dst, r);
+        }
+
+        void DetectionDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t size, SimdBool clip, float* dst)
+        {
+            for (size_t i = 0; i < size; ++i, loc += 4, prior += 4, variance += 4, dst += 4)
+                DecodeSsd(loc, prior, variance, clip == SimdTrue, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static size_t ArgMax(const float* src, size_t size)
+        {
+            if (size < F)
+                return Base::ArgMax(src, size);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m128 max = _mm_loadu_ps(src);
+            for (i = F; i < sizeF; i += F)
+                max = _mm_max_ps(max, _mm_loadu_ps(src + i));
+            if (sizeF < size)
+                max = _mm_max_ps(max, _mm_loadu_ps(src + size - F));
+            max = _mm_max_ps(max, _mm_shuffle_ps(max, max, 0x4E));
+            max = _mm_max_ps(max, _mm_shuffle_ps(max, max, 0xB1));
+            for (i = 0; i < sizeF; i += F)
+            {
+                int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(src + i), max));
+                if (mask)
+                {
+                    for (size_t j = 0; j < F; ++j)
+                        if (mask & (1 << j))
+                            return i + j;
+                }
+            }
+            return sizeF + Base::ArgMax(src + sizeF, size - sizeF);
+        }
+
+        size_t DetectionDecodeYolo32f(const float* src, size_t height, size_t width, size_t anchors, size_t classes, const float* anchorSizes,
+            float threshold, float* boxes, float* scores, uint32_t* labels, size_t capacity)
+        {
+            return Base::DetectionDecodeYolo32f(src, height, width, anchors, classes, anchorSizes, threshold, boxes, scores, labels, capacity, ArgMax);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t DetectionFilterScores32f(const float* scores, size_t size, float threshold, uint32_t* indices)
+        {
+            size_t sizeF = AlignLo(size, F), count = 0, i = 0;
+            __m128 _threshold = _mm_set1_ps(threshold);
+            for (; i < sizeF; i += F)
+            {
+                int mask = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(scores + i), _threshold));
+                for (size_t j = 0; mask; ++j, mask >>= 1)
+                    if (mask & 1)
+                        indices[count++] = uint32_t(i + j);
+            }
+            for (; i < size; ++i)
+                if (scores[i] > threshold)
+                    indices[count++] = uint32_t(i);
+            return count;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void DetectionSuppress(const Base::NmsBuffer& buf, size_t curr, size_t begin, size_t end, float iouThreshold, float sigma, bool labeled)
+        {
+            __m128 x0 = _mm_set1_ps(buf.x0[curr]), y0 = _mm_set1_ps(buf.y0[curr]);
+            __m128 x1 = _mm_set1_ps(buf.x1[curr]), y1 = _mm_set1_ps(buf.y1[curr]);
+            __m128 area = _mm_set1_ps(buf.area[curr]), label = _mm_set1_ps(buf.label[curr]);
+            __m128 _iouThreshold = _mm_set1_ps(iouThreshold), _sigma = _mm_set1_ps(sigma);
+            __m128 _0 = _mm_setzero_ps(), _1 = _mm_set1_ps(1.0f), _min = _mm_set1_ps(-FLT_MAX);
+            size_t j = begin, endF = begin + AlignLo(end - begin, F);
+            for (; j < endF; j += F)
+            {
+                __m128 w = _mm_max_ps(_mm_sub_ps(_mm_min_ps(x1, _mm_loadu_ps(buf.x1 + j)), _mm_max_ps(x0, _mm_loadu_ps(buf.x0 + j))), _0);
+                __m128 h = _mm_max_ps(_mm_sub_ps(_mm_min_ps(y1, _mm_loadu_ps(buf.y1 + j)), _mm_max_ps(y0, _mm_loadu_ps(buf.y0 + j))), _0);
+                __m128 inter = _mm_mul_ps(w, h);
+                __m128 uni = _mm_sub_ps(_mm_add_ps(area, _mm_loadu_ps(buf.area + j)), inter);
+                __m128 same = labeled ? _mm_cmpeq_ps(label, _mm_loadu_ps(buf.label + j)) : _mm_castsi128_ps(Sse41::K_INV_ZERO);
+                __m128 score = _mm_loadu_ps(buf.score + j);
+                if (sigma > 0.0f)
+                {
+                    __m128 iou = _mm_and_ps(_mm_div_ps(inter, uni), _mm_cmpgt_ps(uni, _0));
+                    __m128 decay = Exponent(_mm_sub_ps(_0, _mm_div_ps(_mm_mul_ps(iou, iou), _sigma)));
+                    score = _mm_mul_ps(score, _mm_blendv_ps(_1, decay, same));
+                }
+                else
+                {
+                    __m128 suppress = _mm_and_ps(_mm_cmpgt_ps(inter, _mm_mul_ps(_iouThreshold, uni)), same);
+                    score = _mm_blendv_ps(score, _min, suppress);
+                }
+                _mm_storeu_ps(buf.score + j, score);
+            }
+            Base::DetectionSuppress(buf, curr, j, end, iouThreshold, sigma, labeled);
+        }
+
+        size_t DetectionNms32f(const float* boxes, const float* scores, const uint32_t* labels, size_t size, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* keepScores)
+        {
+            return Base::DetectionNms32f(boxes, scores, labels, size, iouThreshold, sigma, scoreThreshold, indices, keepScores, DetectionFilterScores32f, DetectionSuppress);
+        }
+    }
+#endif
+}
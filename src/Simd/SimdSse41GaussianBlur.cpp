@@ -36,7 +36,17 @@ namespace Simd
             return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)src)));
         }
 
-        SIMD_INLINE void BlurColsAny(const uint8_t* src, size_t size, size_t channels, const float* weight, size_t kernel, float* dst)
+        SIMD_INLINE __m128 LoadAs32f(const uint16_t* src)
+        {
+            return _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i*)src)));
+        }
+
+        SIMD_INLINE __m128 LoadAs32f(const float* src)
+        {
+            return _mm_loadu_ps(src);
+        }
+
+        template<class T> SIMD_INLINE void BlurColsAny(const T* src, size_t size, size_t channels, const float* weight, size_t kernel, float* dst)
         {
             size_t sizeF = AlignLo(size, F);
             size_t i = 0;
@@ -56,13 +66,23 @@ namespace Simd
             }
         }
 
-        SIMD_INLINE void StoreAs8u(uint8_t* dst, const __m128 & f0)
+        SIMD_INLINE void StoreAs(uint8_t* dst, const __m128 & f0)
         {
             __m128i i0 = _mm_cvtps_epi32(f0);
             ((int32_t*)dst)[0] = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(i0, K_ZERO), K_ZERO));
         }
 
-        SIMD_INLINE void StoreAs8u(uint8_t* dst, const __m128& f0, const __m128& f1, const __m128& f2, const __m128& f3)
+        SIMD_INLINE void StoreAs(uint16_t* dst, const __m128& f0)
+        {
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi32(_mm_cvtps_epi32(f0), K_ZERO));
+        }
+
+        SIMD_INLINE void StoreAs(float* dst, const __m128& f0)
+        {
+            _mm_storeu_ps(dst, f0);
+        }
+
+        SIMD_INLINE void StoreAs(uint8_t* dst, const __m128& f0, const __m128& f1, const __m128& f2, const __m128& f3)
         {
             __m128i i0 = _mm_cvtps_epi32(f0);
             __m128i i1 = _mm_cvtps_epi32(f1);
@@ -71,7 +91,21 @@ namespace Simd
             _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packs_epi32(i0, i1), _mm_packs_epi32(i2, i3)));
         }
 
-        SIMD_INLINE void BlurRowsAny(const float* src, size_t size, size_t stride, const float* weight, size_t kernel, uint8_t* dst)
+        SIMD_INLINE void StoreAs(uint16_t* dst, const __m128& f0, const __m128& f1, const __m128& f2, const __m128& f3)
+        {
+            _mm_storeu_si128((__m128i*)dst + 0, _mm_packus_epi32(_mm_cvtps_epi32(f0), _mm_cvtps_epi32(f1)));
+            _mm_storeu_si128((__m128i*)dst + 1, _mm_packus_epi32(_mm_cvtps_epi32(f2), _mm_cvtps_epi32(f3)));
+        }
+
+        SIMD_INLINE void StoreAs(float* dst, const __m128& f0, const __m128& f1, const __m128& f2, const __m128& f3)
+        {
+            _mm_storeu_ps(dst + 0 * F, f0);
+            _mm_storeu_ps(dst + 1 * F, f1);
+            _mm_storeu_ps(dst + 2 * F, f2);
+            _mm_storeu_ps(dst + 3 * F, f3);
+        }
+
+        template<class T> SIMD_INLINE void BlurRowsAny(const float* src, size_t size, size_t stride, const float* weight, size_t kernel, T* dst)
         {
             size_t sizeA = AlignLo(size, A);
             size_t sizeF = AlignLo(size, F);
@@ -91,65 +125,40 @@ namespace Simd
                     sum2 = _mm_add_ps(_mm_mul_ps(w, _mm_loadu_ps(ps + 2 * F)), sum2);
                     sum3 = _mm_add_ps(_mm_mul_ps(w, _mm_loadu_ps(ps + 3 * F)), sum3);
                 }
-                StoreAs8u(dst + i, sum0, sum1, sum2, sum3);
+                StoreAs(dst + i, sum0, sum1, sum2, sum3);
             }
             for (; i < sizeF; i += F)
             {
                 __m128 sum = _mm_setzero_ps();
                 for (size_t k = 0; k < kernel; ++k)
                     sum = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(weight[k]), _mm_loadu_ps(src + i + k * stride)), sum);
-                StoreAs8u(dst + i, sum);
+                StoreAs(dst + i, sum);
             }
             for (; i < size; ++i)
             {
                 float sum = 0;
                 for (size_t k = 0; k < kernel; ++k)
                     sum += weight[k] * src[i + k * stride];
-                dst[i] = Round(sum);
+                dst[i] = Base::BlurCast<T>(sum);
             }
         }
 
-        template<int channels> void BlurImageAny(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<class T> struct BlurAny
         {
-            Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
+            static SIMD_INLINE void Cols(const Base::AlgDefault& a, const T* src, size_t channels, float* dst)
             {
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + (a.half + row) * a.stride);
+                BlurColsAny(src, a.size, channels, a.weight.data, a.kernel, dst);
             }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRowsAny(rows, a.size, a.stride, a.weight.data, a.kernel, dst), dst += dstStride;
 
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < a.body; ++row, ++b, --w)
+            static SIMD_INLINE void Rows(const Base::AlgDefault& a, const float* src, const float* weight, T* dst)
             {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + b * a.stride);
-                BlurRowsAny(rows, a.size, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
+                BlurRowsAny(src, a.size, a.stride, weight, a.kernel, dst);
             }
-
-            size_t last = (a.body + 2 * a.half - 1) % a.kernel;
-            for (size_t row = a.body, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < p.height; ++row, ++b, --w)
-            {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRowsAny(rows, a.size, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
-            }
-        }
+        };
 
         //---------------------------------------------------------------------
 
-        template<int kernel> SIMD_INLINE void BlurCols(const uint8_t* src, size_t size, size_t channels, const float* weight, float* dst)
+        template<int kernel, class T> SIMD_INLINE void BlurCols(const T* src, size_t size, size_t channels, const float* weight, float* dst)
         {
             __m128 w[kernel];
             for (size_t k = 0; k < kernel; ++k)
@@ -172,7 +181,7 @@ namespace Simd
             }
         }
 
-        template<> SIMD_INLINE void BlurCols<3>(const uint8_t* src, size_t size, size_t channels, const float* weight, float* dst)
+        template<> SIMD_INLINE void BlurCols<3, uint8_t>(const uint8_t* src, size_t size, size_t channels, const float* weight, float* dst)
         {
             __m128 w0 = _mm_set1_ps(weight[0]);
             __m128 w1 = _mm_set1_ps(weight[1]);
@@ -195,7 +204,7 @@ namespace Simd
             }
         }
 
-        template<> SIMD_INLINE void BlurCols<5>(const uint8_t* src, size_t size, size_t channels, const float* weight, float* dst)
+        template<> SIMD_INLINE void BlurCols<5, uint8_t>(const uint8_t* src, size_t size, size_t channels, const float* weight, float* dst)
         {
             __m128 w0 = _mm_set1_ps(weight[0]);
             __m128 w1 = _mm_set1_ps(weight[1]);
@@ -224,7 +233,7 @@ namespace Simd
             }
         }
 
-        template<int kernel> SIMD_INLINE void BlurRows(const float* src, size_t size, size_t stride, const float* weight, uint8_t* dst)
+        template<int kernel, class T> SIMD_INLINE void BlurRows(const float* src, size_t size, size_t stride, const float* weight, T* dst)
         {
             __m128 w[kernel];
             for (size_t k = 0; k < kernel; ++k)
@@ -246,73 +255,60 @@ namespace Simd
                     sum2 = _mm_add_ps(_mm_mul_ps(w[k], _mm_loadu_ps(ps + 2 * F)), sum2);
                     sum3 = _mm_add_ps(_mm_mul_ps(w[k], _mm_loadu_ps(ps + 3 * F)), sum3);
                 }
-                StoreAs8u(dst + i, sum0, sum1, sum2, sum3);
+                StoreAs(dst + i, sum0, sum1, sum2, sum3);
             }
             for (; i < sizeF; i += F)
             {
                 __m128 sum = _mm_setzero_ps();
                 for (size_t k = 0; k < kernel; ++k)
                     sum = _mm_add_ps(_mm_mul_ps(w[k], _mm_loadu_ps(src + i + k * stride)), sum);
-                StoreAs8u(dst + i, sum);
+                StoreAs(dst + i, sum);
             }
             for (; i < size; ++i)
             {
                 float sum = 0;
                 for (size_t k = 0; k < kernel; ++k)
                     sum += weight[k] * src[i + k * stride];
-                dst[i] = Round(sum);
+                dst[i] = Base::BlurCast<T>(sum);
             }
         }
 
-        template<int channels, int kernel> void BlurImage(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<class T, int kernel> struct BlurKernel
         {
-            Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
+            static SIMD_INLINE void Cols(const Base::AlgDefault& a, const T* src, size_t channels, float* dst)
             {
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + (a.half + row) * a.stride);
+                BlurCols<kernel>(src, a.size, channels, a.weight.data, dst);
             }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRows<kernel>(rows, a.size, a.stride, a.weight.data, dst), dst += dstStride;
 
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = kernel - row % kernel; row < a.body; ++row, ++b, --w)
+            static SIMD_INLINE void Rows(const Base::AlgDefault& a, const float* src, const float* weight, T* dst)
             {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + b * a.stride);
-                BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + w, dst), dst += dstStride;
+                BlurRows<kernel>(src, a.size, a.stride, weight, dst);
             }
+        };
 
-            size_t last = (a.body + 2 * a.half - 1) % kernel;
-            for (size_t row = a.body, b = row % kernel + 2 * a.half, w = kernel - row % kernel; row < p.height; ++row, ++b, --w)
+        //---------------------------------------------------------------------
+
+        template<class T, int channels> Base::BlurDefaultPtr GetBlurDefaultPtr(const BlurParam& p, const Base::AlgDefault& a)
+        {
+            switch (a.kernel)
             {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + w, dst), dst += dstStride;
+            case 3: return Base::BlurImage<T, channels, BlurKernel<T, 3>>;
+            case 5: return Base::BlurImage<T, channels, BlurKernel<T, 5>>;
+            case 7: return Base::BlurImage<T, channels, BlurKernel<T, 7>>;
+            case 9: return Base::BlurImage<T, channels, BlurKernel<T, 9>>;
+            default: return Base::BlurImage<T, channels, BlurAny<T>>;
             }
         }
 
-        //---------------------------------------------------------------------
-
-        template<int channels> Base::BlurDefaultPtr GetBlurDefaultPtr(const BlurParam& p, const Base::AlgDefault& a)
+        template<class T> Base::BlurDefaultPtr GetBlurDefaultPtr(const BlurParam& p, const Base::AlgDefault& a)
         {
-            switch (a.kernel)
+            switch (p.channels)
             {
-            case 3: return BlurImage<channels, 3>;
-            case 5: return BlurImage<channels, 5>;
-            case 7: return BlurImage<channels, 7>;
-            case 9: return BlurImage<channels, 9>;
-            default: return BlurImageAny<channels>;
+            case 1: return GetBlurDefaultPtr<T, 1>(p, a);
+            case 2: return GetBlurDefaultPtr<T, 2>(p, a);
+            case 3: return GetBlurDefaultPtr<T, 3>(p, a);
+            case 4: return GetBlurDefaultPtr<T, 4>(p, a);
+            default: return NULL;
             }
         }
 
@@ -323,23 +319,213 @@ namespace Simd
         {
             if (_param.width >= F)
             {
-                switch (_param.channels)
+                switch (_param.Channel())
                 {
-                case 1: _blur = GetBlurDefaultPtr<1>(_param, _alg); break;
-                case 2: _blur = GetBlurDefaultPtr<2>(_param, _alg); break;
-                case 3: _blur = GetBlurDefaultPtr<3>(_param, _alg); break;
-                case 4: _blur = GetBlurDefaultPtr<4>(_param, _alg); break;
+                case SimdGaussianBlurChannelByte: _blur = GetBlurDefaultPtr<uint8_t>(_param, _alg); break;
+                case SimdGaussianBlurChannelShort: _blur = GetBlurDefaultPtr<uint16_t>(_param, _alg); break;
+                case SimdGaussianBlurChannelFloat: _blur = GetBlurDefaultPtr<float>(_param, _alg); break;
+                default: break;
                 }
             }
         }
 
         //---------------------------------------------------------------------
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
+        SIMD_INLINE void Load4x4(float* const* rows, size_t offset, __m128* dst)
+        {
+            __m128 s0 = _mm_loadu_ps(rows[0] + offset);
+            __m128 s1 = _mm_loadu_ps(rows[1] + offset);
+            __m128 s2 = _mm_loadu_ps(rows[2] + offset);
+            __m128 s3 = _mm_loadu_ps(rows[3] + offset);
+            __m128 t0 = _mm_unpacklo_ps(s0, s2);
+            __m128 t1 = _mm_unpacklo_ps(s1, s3);
+            __m128 t2 = _mm_unpackhi_ps(s0, s2);
+            __m128 t3 = _mm_unpackhi_ps(s1, s3);
+            dst[0] = _mm_unpacklo_ps(t0, t1);
+            dst[1] = _mm_unpackhi_ps(t0, t1);
+            dst[2] = _mm_unpacklo_ps(t2, t3);
+            dst[3] = _mm_unpackhi_ps(t2, t3);
+        }
+
+        SIMD_INLINE void Store4x4(const __m128* src, size_t offset, float* const* rows)
+        {
+            __m128 t0 = _mm_unpacklo_ps(src[0], src[2]);
+            __m128 t1 = _mm_unpacklo_ps(src[1], src[3]);
+            __m128 t2 = _mm_unpackhi_ps(src[0], src[2]);
+            __m128 t3 = _mm_unpackhi_ps(src[1], src[3]);
+            _mm_storeu_ps(rows[0] + offset, _mm_unpacklo_ps(t0, t1));
+            _mm_storeu_ps(rows[1] + offset, _mm_unpackhi_ps(t0, t1));
+            _mm_storeu_ps(rows[2] + offset, _mm_unpacklo_ps(t2, t3));
+            _mm_storeu_ps(rows[3] + offset, _mm_unpackhi_ps(t2, t3));
+        }
+
+        SIMD_INLINE __m128 Gather4(float* const* rows, size_t offset)
+        {
+            return _mm_setr_ps(rows[0][offset], rows[1][offset], rows[2][offset], rows[3][offset]);
+        }
+
+        SIMD_INLINE void Scatter4(__m128 src, size_t offset, float* const* rows)
+        {
+            SIMD_ALIGNED(16) float buf[4];
+            _mm_store_ps(buf, src);
+            rows[0][offset] = buf[0];
+            rows[1][offset] = buf[1];
+            rows[2][offset] = buf[2];
+            rows[3][offset] = buf[3];
+        }
+
+        SIMD_INLINE __m128 Recursive(__m128 x, __m128& y1, __m128& y2, __m128& y3, const __m128* k)
+        {
+            __m128 y0 = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(k[0], x), _mm_mul_ps(k[1], y1)), _mm_mul_ps(k[2], y2)), _mm_mul_ps(k[3], y3));
+            y3 = y2, y2 = y1, y1 = y0;
+            return y0;
+        }
+
+        template<int channels> void RecursiveCols4(const Base::AlgRecursive& a, float* const* rows)
+        {
+            const size_t block = F * channels, sizeB = a.size / block * block;
+            __m128 k[4] = { _mm_set1_ps(a.b), _mm_set1_ps(a.a1), _mm_set1_ps(a.a2), _mm_set1_ps(a.a3) };
+            __m128 y1[channels], y2[channels], y3[channels], v[block];
+            for (size_t c = 0; c < channels; ++c)
+                y1[c] = Gather4(rows, c), y2[c] = y1[c], y3[c] = y1[c];
+            size_t i = 0;
+            for (; i < sizeB; i += block)
+            {
+                for (size_t j = 0; j < channels; ++j)
+                    Load4x4(rows, i + j * F, v + j * F);
+                for (size_t j = 0; j < block; ++j)
+                    v[j] = Recursive(v[j], y1[j % channels], y2[j % channels], y3[j % channels], k);
+                for (size_t j = 0; j < channels; ++j)
+                    Store4x4(v + j * F, i + j * F, rows);
+            }
+            for (; i < a.size; i += channels)
+                for (size_t c = 0; c < channels; ++c)
+                    Scatter4(Recursive(Gather4(rows, i + c), y1[c], y2[c], y3[c], k), i + c, rows);
+
+            for (size_t c = 0; c < channels; ++c)
+                y1[c] = Gather4(rows, a.size - channels + c), y2[c] = y1[c], y3[c] = y1[c];
+            for (i = a.size; i > sizeB; i -= channels)
+                for (size_t c = channels - 1; c < channels; --c)
+                    Scatter4(Recursive(Gather4(rows, i - channels + c), y1[c], y2[c], y3[c], k), i - channels + c, rows);
+            for (; i > 0; i -= block)
+            {
+                for (size_t j = 0; j < channels; ++j)
+                    Load4x4(rows, i - block + j * F, v + j * F);
+                for (size_t j = block - 1; j < block; --j)
+                    v[j] = Recursive(v[j], y1[j % channels], y2[j % channels], y3[j % channels], k);
+                for (size_t j = 0; j < channels; ++j)
+                    Store4x4(v + j * F, i - block + j * F, rows);
+            }
+        }
+
+        template<class T, int channels> void RecursiveCols(const BlurParam& p, const Base::AlgRecursive& a, size_t yBeg, size_t yEnd, const uint8_t* src, size_t srcStride, float* buf)
+        {
+            size_t sizeF = AlignLo(a.size, F), y = yBeg, yEnd4 = yBeg + AlignLo(yEnd - yBeg, 4);
+            float* rows[4];
+            for (; y < yEnd4; y += 4)
+            {
+                for (size_t r = 0; r < 4; ++r)
+                {
+                    const T* ps = (const T*)(src + (y + r) * srcStride);
+                    rows[r] = buf + (y + r) * a.stride;
+                    size_t i = 0;
+                    for (; i < sizeF; i += F)
+                        _mm_storeu_ps(rows[r] + i, LoadAs32f(ps + i));
+                    for (; i < a.size; ++i)
+                        rows[r][i] = float(ps[i]);
+                }
+                RecursiveCols4<channels>(a, rows);
+            }
+            if (y < yEnd)
+                Base::RecursiveCols<T, channels>(p, a, y, yEnd, src, srcStride, buf);
+        }
+
+        template<class T> Base::RecursiveColsPtr GetRecursiveColsPtr(const BlurParam& p)
+        {
+            switch (p.channels)
+            {
+            case 1: return RecursiveCols<T, 1>;
+            case 2: return RecursiveCols<T, 2>;
+            case 3: return RecursiveCols<T, 3>;
+            case 4: return RecursiveCols<T, 4>;
+            default: return NULL;
+            }
+        }
+
+        template<class T> void RecursiveRows(const BlurParam& p, const Base::AlgRecursive& a, size_t xBeg, size_t xEnd, float* buf, uint8_t* dst, size_t dstStride)
+        {
+            __m128 k0 = _mm_set1_ps(a.b), k1 = _mm_set1_ps(a.a1), k2 = _mm_set1_ps(a.a2), k3 = _mm_set1_ps(a.a3);
+            size_t xEndF = xBeg + AlignLo(xEnd - xBeg, F);
+            for (size_t y = 0; y < p.height; ++y)
+            {
+                const float* p1 = buf + (y > 0 ? y - 1 : 0) * a.stride;
+                const float* p2 = buf + (y > 1 ? y - 2 : 0) * a.stride;
+                const float* p3 = buf + (y > 2 ? y - 3 : 0) * a.stride;
+                float* pb = buf + y * a.stride;
+                size_t x = xBeg;
+                for (; x < xEndF; x += F)
+                {
+                    __m128 y0 = _mm_add_ps(_mm_mul_ps(k0, _mm_loadu_ps(pb + x)), _mm_mul_ps(k1, _mm_loadu_ps(p1 + x)));
+                    y0 = _mm_add_ps(_mm_add_ps(y0, _mm_mul_ps(k2, _mm_loadu_ps(p2 + x))), _mm_mul_ps(k3, _mm_loadu_ps(p3 + x)));
+                    _mm_storeu_ps(pb + x, y0);
+                }
+                for (; x < xEnd; ++x)
+                    pb[x] = a.b * pb[x] + a.a1 * p1[x] + a.a2 * p2[x] + a.a3 * p3[x];
+            }
+            for (ptrdiff_t y = p.height - 1, last = y; y >= 0; --y)
+            {
+                const float* n1 = buf + Simd::Min(y + 1, last) * a.stride;
+                const float* n2 = buf + Simd::Min(y + 2, last) * a.stride;
+                const float* n3 = buf + Simd::Min(y + 3, last) * a.stride;
+                float* pb = buf + y * a.stride;
+                T* pd = (T*)(dst + y * dstStride);
+                size_t x = xBeg;
+                for (; x < xEndF; x += F)
+                {
+                    __m128 y0 = _mm_add_ps(_mm_mul_ps(k0, _mm_loadu_ps(pb + x)), _mm_mul_ps(k1, _mm_loadu_ps(n1 + x)));
+                    y0 = _mm_add_ps(_mm_add_ps(y0, _mm_mul_ps(k2, _mm_loadu_ps(n2 + x))), _mm_mul_ps(k3, _mm_loadu_ps(n3 + x)));
+                    _mm_storeu_ps(pb + x, y0);
+                    StoreAs(pd + x, y0);
+                }
+                for (; x < xEnd; ++x)
+                {
+                    pb[x] = a.b * pb[x] + a.a1 * n1[x] + a.a2 * n2[x] + a.a3 * n3[x];
+                    pd[x] = Base::BlurCast<T>(pb[x]);
+                }
+            }
+        }
+
+        GaussianBlurRecursive::GaussianBlurRecursive(const BlurParam& param)
+            : Base::GaussianBlurRecursive(param)
+        {
+            switch (_param.Channel())
+            {
+            case SimdGaussianBlurChannelByte:
+                _blurCols = GetRecursiveColsPtr<uint8_t>(_param);
+                _blurRows = RecursiveRows<uint8_t>;
+                break;
+            case SimdGaussianBlurChannelShort:
+                _blurCols = GetRecursiveColsPtr<uint16_t>(_param);
+                _blurRows = RecursiveRows<uint16_t>;
+                break;
+            case SimdGaussianBlurChannelFloat:
+                _blurCols = GetRecursiveColsPtr<float>(_param);
+                _blurRows = RecursiveRows<float>;
+                break;
+            default:
+                break;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags)
         {
-            BlurParam param(width, height, channels, sigma, epsilon, A);
+            BlurParam param(width, height, channels, sigma, epsilon, flags, A);
             if (!param.Valid())
                 return NULL;
+            if (param.IsRecursive())
+                return new GaussianBlurRecursive(param);
             return new GaussianBlurDefault(param);
         }
     }
@@ -25,6 +25,10 @@
 #include "Simd/SimdStore.h"
 #include "Simd/SimdCompare.h"
 #include "Simd/SimdUnpack.h"
+#include "Simd/SimdHistogram.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -276,6 +280,75 @@ namespace Simd
                 assert(0);
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m128 AdaptiveHistogramGather(const float* lut, const int32_t* index, const uint8_t* src)
+        {
+            return _mm_setr_ps(lut[index[0] + src[0]], lut[index[1] + src[1]], lut[index[2] + src[2]], lut[index[3] + src[3]]);
+        }
+
+        SIMD_INLINE __m128 AdaptiveHistogramInterp(const float* lut, const int32_t* i0, const int32_t* i1, const uint8_t* src, __m128 wx)
+        {
+            __m128 v0 = AdaptiveHistogramGather(lut, i0, src);
+            __m128 v1 = AdaptiveHistogramGather(lut, i1, src);
+            return _mm_add_ps(v0, _mm_mul_ps(_mm_sub_ps(v1, v0), wx));
+        }
+
+        SIMD_INLINE __m128i AdaptiveHistogram4(const float* lut0, const float* lut1, const int32_t* i0, const int32_t* i1, const float* weight, const uint8_t* src, __m128 wy)
+        {
+            __m128 wx = _mm_loadu_ps(weight);
+            __m128 r0 = AdaptiveHistogramInterp(lut0, i0, i1, src, wx);
+            __m128 r1 = AdaptiveHistogramInterp(lut1, i0, i1, src, wx);
+            __m128 res = _mm_add_ps(r0, _mm_mul_ps(_mm_sub_ps(r1, r0), wy));
+            return _mm_cvttps_epi32(_mm_add_ps(res, _mm_set1_ps(0.5f)));
+        }
+
+        SIMD_INLINE void AdaptiveHistogram16(const float* lut0, const float* lut1, const int32_t* i0, const int32_t* i1, const float* weight, const uint8_t* src, __m128 wy, uint8_t* dst)
+        {
+            __m128i d0 = AdaptiveHistogram4(lut0, lut1, i0 + 0 * F, i1 + 0 * F, weight + 0 * F, src + 0 * F, wy);
+            __m128i d1 = AdaptiveHistogram4(lut0, lut1, i0 + 1 * F, i1 + 1 * F, weight + 1 * F, src + 1 * F, wy);
+            __m128i d2 = AdaptiveHistogram4(lut0, lut1, i0 + 2 * F, i1 + 2 * F, weight + 2 * F, src + 2 * F, wy);
+            __m128i d3 = AdaptiveHistogram4(lut0, lut1, i0 + 3 * F, i1 + 3 * F, weight + 3 * F, src + 3 * F, wy);
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packs_epi32(d0, d1), _mm_packs_epi32(d2, d3)));
+        }
+
+        void NormalizeHistogramAdaptive(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t tilesX, size_t tilesY, float clipLimit, uint8_t* dst, size_t dstStride)
+        {
+            assert(tilesX >= 1 && tilesY >= 1 && tilesX <= width && tilesY <= height);
+            if (width < A)
+            {
+                Base::NormalizeHistogramAdaptive(src, srcStride, width, height, tilesX, tilesY, clipLimit, dst, dstStride);
+                return;
+            }
+            Array32f luts(tilesX * tilesY * HISTOGRAM_SIZE), weights(width);
+            Array32i indices(2 * width);
+            Base::AdaptiveHistogramLuts(src, srcStride, width, height, tilesX, tilesY, clipLimit, luts.data);
+            Base::AdaptiveHistogramCols(width, tilesX, indices.data, indices.data + width, weights.data);
+            size_t widthA = AlignLo(width, A);
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                const int32_t* i0 = indices.data, * i1 = indices.data + width;
+                for (size_t y = begin; y < end; ++y)
+                {
+                    size_t offset0, offset1;
+                    float wy;
+                    Base::AdaptiveHistogramRow(y, height, tilesY, tilesX, offset0, offset1, wy);
+                    const float* lut0 = luts.data + offset0, * lut1 = luts.data + offset1;
+                    const uint8_t* ps = src + y * srcStride;
+                    uint8_t* pd = dst + y * dstStride;
+                    __m128 _wy = _mm_set1_ps(wy);
+                    uint8_t tail[A];
+                    if (widthA < width)
+                        memcpy(tail, ps + width - A, A);
+                    for (size_t x = 0; x < widthA; x += A)
+                        AdaptiveHistogram16(lut0, lut1, i0 + x, i1 + x, weights.data + x, ps + x, _wy, pd + x);
+                    if (widthA < width)
+                        AdaptiveHistogram16(lut0, lut1, i0 + width - A, i1 + width - A, weights.data + width - A, tail, _wy, pd + width - A);
+                }
+            }, Base::GetThreadNumber());
+        }
     }
 #endif
 }
@@ -25,6 +25,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdLoadBlock.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -654,6 +655,56 @@ namespace Simd
             else
                 MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        struct MedianHist
+        {
+            static SIMD_INLINE void Add(uint16_t* dst, const uint16_t* src)
+            {
+                _mm_storeu_si128((__m128i*)dst + 0, _mm_add_epi16(_mm_loadu_si128((__m128i*)dst + 0), _mm_loadu_si128((__m128i*)src + 0)));
+                _mm_storeu_si128((__m128i*)dst + 1, _mm_add_epi16(_mm_loadu_si128((__m128i*)dst + 1), _mm_loadu_si128((__m128i*)src + 1)));
+            }
+
+            static SIMD_INLINE void Update(uint16_t* dst, const uint16_t* add, const uint16_t* sub)
+            {
+                _mm_storeu_si128((__m128i*)dst + 0, _mm_sub_epi16(_mm_add_epi16(_mm_loadu_si128((__m128i*)dst + 0), 
+                    _mm_loadu_si128((__m128i*)add + 0)), _mm_loadu_si128((__m128i*)sub + 0)));
+                _mm_storeu_si128((__m128i*)dst + 1, _mm_sub_epi16(_mm_add_epi16(_mm_loadu_si128((__m128i*)dst + 1), 
+                    _mm_loadu_si128((__m128i*)add + 1)), _mm_loadu_si128((__m128i*)sub + 1)));
+            }
+
+            static SIMD_INLINE __m128i Prefix(__m128i value)
+            {
+                value = _mm_add_epi16(value, _mm_slli_si128(value, 2));
+                value = _mm_add_epi16(value, _mm_slli_si128(value, 4));
+                return _mm_add_epi16(value, _mm_slli_si128(value, 8));
+            }
+
+            static SIMD_INLINE size_t Find(const uint16_t* hist, size_t& sum, size_t half)
+            {
+                SIMD_ALIGNED(16) uint16_t prefix[16];
+                __m128i lo = Prefix(_mm_loadu_si128((__m128i*)hist + 0));
+                __m128i hi = Prefix(_mm_loadu_si128((__m128i*)hist + 1));
+                __m128i last = _mm_shufflehi_epi16(lo, 0xFF);
+                hi = _mm_add_epi16(hi, _mm_unpackhi_epi64(last, last));
+                _mm_store_si128((__m128i*)prefix + 0, lo);
+                _mm_store_si128((__m128i*)prefix + 1, hi);
+                __m128i threshold = _mm_set1_epi16(int16_t(half - sum + 1));
+                __m128i above = _mm_packs_epi16(_mm_cmpeq_epi16(_mm_max_epu16(lo, threshold), lo), _mm_cmpeq_epi16(_mm_max_epu16(hi, threshold), hi));
+                __m128i count = _mm_sad_epu8(_mm_sub_epi8(_mm_setzero_si128(), above), _mm_setzero_si128());
+                size_t index = Simd::Min<size_t>(16 - _mm_cvtsi128_si32(count) - _mm_extract_epi32(count, 2), 15);
+                if (index)
+                    sum += prefix[index - 1];
+                return index;
+            }
+        };
+
+        void MedianFilterSquare(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t* dst, size_t dstStride)
+        {
+            Base::MedianFilterSquare<MedianHist>(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+        }
     }
 #endif
 }
@@ -0,0 +1,87 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template<class Op> SIMD_INLINE void MorphRow(const uint8_t* a, const uint8_t* b, uint8_t* dst, size_t size)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            for (; i < sizeA; i += A)
+                _mm_storeu_si128((__m128i*)(dst + i), Op::Run(_mm_loadu_si128((__m128i*)(a + i)), _mm_loadu_si128((__m128i*)(b + i))));
+            for (; i < size; ++i)
+                dst[i] = Op::Run(a[i], b[i]);
+        }
+
+        struct MorphMin
+        {
+            static SIMD_INLINE __m128i Run(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+            static SIMD_INLINE uint8_t Run(uint8_t a, uint8_t b) { return Simd::Min(a, b); }
+        };
+
+        struct MorphMax
+        {
+            static SIMD_INLINE __m128i Run(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+            static SIMD_INLINE uint8_t Run(uint8_t a, uint8_t b) { return Simd::Max(a, b); }
+        };
+
+        struct MorphAnd
+        {
+            static SIMD_INLINE __m128i Run(__m128i a, __m128i b) { return _mm_and_si128(a, b); }
+            static SIMD_INLINE uint8_t Run(uint8_t a, uint8_t b) { return a & b; }
+        };
+
+        struct MorphOr
+        {
+            static SIMD_INLINE __m128i Run(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+            static SIMD_INLINE uint8_t Run(uint8_t a, uint8_t b) { return a | b; }
+        };
+
+        static void MorphTranspose(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride)
+        {
+            TransformImage(src, srcStride, width, height, 1, SimdTransformTransposeRotate0, dst, dstStride);
+        }
+
+        static const Base::MorphOps MORPH_OPS = { MorphRow<MorphMin>, MorphRow<MorphMax>, MorphRow<MorphAnd>, MorphRow<MorphOr>, MorphTranspose };
+
+        void Morphology(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t* dst, size_t dstStride)
+        {
+            Base::Morphology(MORPH_OPS, src, srcStride, width, height, type, shape, kernelX, kernelY, dst, dstStride);
+        }
+
+        void MorphologyBits(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t* dst, size_t dstStride)
+        {
+            Base::MorphologyBits(MORPH_OPS, src, srcStride, width, height, type, shape, kernelX, kernelY, dst, dstStride);
+        }
+    }
+#endif
+}
@@ -0,0 +1,150 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdRemap.h"
+#include "Simd/SimdWarpAffineCommon.h"
+#include "Simd/SimdCopy.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        template<int N> void ByteBilinearRun(const RemapParam& p, const RemapTab& t, int yBeg, int yEnd, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            constexpr int M = (N == 3 ? 4 : N);
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, n = A / M;
+            uint8_t* rb0 = buf, * rb1 = rb0 + width * M * 2, * eb = rb1 + width * M * 2;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                const uint8_t* fx = t.fx + 2 * y * width;
+                const uint16_t* fy = t.fy + 2 * y * width;
+                const RemapEdge* beg = t.edges + t.rows[y], * end = t.edges + t.rows[y + 1];
+                int ib = t.ib[y], ie = t.ie[y], x = ib;
+                int ieA = ib + (int)AlignLo(N == 3 ? Simd::Max(ie - ib - 3, 0) : ie - ib, n);
+                uint8_t* row = dst + y * p.dstS;
+                if (fill)
+                {
+                    Base::FillBorder<N>(row, ib, p.border);
+                    Base::FillBorder<N>(row + ie * N, width - ie, p.border);
+                }
+                else
+                    Base::RemapSaveEdge<N>(beg, end, row, eb);
+                Base::ByteBilinearGather<M>(src, src + s, (uint32_t*)t.offs + y * width + ib, ie - ib, rb0, rb1);
+                for (; x < ieA; x += n)
+                    ByteBilinearInterpMainN<N>(rb0 + (x - ib) * M * 2, rb1 + (x - ib) * M * 2, fx + 2 * x, fy + 2 * x, row + x * N);
+                for (; x < ie; ++x)
+                    Base::ByteBilinearInterpMain<N>(rb0 + (x - ib) * M * 2, rb1 + (x - ib) * M * 2, fx + 2 * x, fy + 2 * x, row + x * N);
+                Base::ByteBilinearRemapEdge<N>(p, beg, end, fx, fy, src, eb, row);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> void FloatBilinearRun(const RemapParam& p, const RemapTab& t, int yBeg, int yEnd, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                const float* wx = t.wx + y * width;
+                const float* wy = t.wy + y * width;
+                const RemapEdge* beg = t.edges + t.rows[y], * end = t.edges + t.rows[y + 1];
+                int ib = t.ib[y], ie = t.ie[y];
+                uint8_t* row = dst + y * p.dstS;
+                if (fill)
+                {
+                    Base::FillBorder<N * 4>(row, ib, p.border);
+                    Base::FillBorder<N * 4>(row + ie * N * 4, width - ie, p.border);
+                }
+                else
+                    Base::RemapSaveEdge<N * 4>(beg, end, row, buf);
+                FloatBilinearRow<N>(src, s, t.offs + y * width + ib, wx + ib, wy + ib, ie - ib, (float*)row + ib * N);
+                Base::FloatBilinearRemapEdge<N>(p, beg, end, wx, wy, src, buf, row);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        Remap::Remap(const RemapParam& param)
+            : Base::Remap(param)
+        {
+            if (_param.IsNearest())
+                return;
+            if (_param.IsFloat())
+            {
+                switch (_param.channels)
+                {
+                case 1: _run = FloatBilinearRun<1>; break;
+                case 2: _run = FloatBilinearRun<2>; break;
+                case 3: _run = FloatBilinearRun<3>; break;
+                case 4: _run = FloatBilinearRun<4>; break;
+                }
+            }
+            else
+            {
+                switch (_param.channels)
+                {
+                case 1: _run = ByteBilinearRun<1>; break;
+                case 2: _run = ByteBilinearRun<2>; break;
+                case 3: _run = ByteBilinearRun<3>; break;
+                case 4: _run = ByteBilinearRun<4>; break;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const void* map, SimdTensorDataType mapType, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border);
+            if (!param.Valid())
+                return NULL;
+            Remap* remap = new Remap(param);
+            if (!remap->SetMap(map, mapType))
+            {
+                delete remap;
+                return NULL;
+            }
+            return remap;
+        }
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border);
+            if (!param.Valid() || mat == NULL)
+                return NULL;
+            Remap* remap = new Remap(param);
+            if (!remap->SetPerspective(mat))
+            {
+                delete remap;
+                return NULL;
+            }
+            return remap;
+        }
+    }
+#endif
+}
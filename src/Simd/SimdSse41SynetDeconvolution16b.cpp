@@ -22,17 +22,33 @@
 * SOFTWARE.
 */
 #include "Simd/SimdSynetDeconvolution16b.h"
+#include "Simd/SimdSynetConvolution16b.h"
 
 namespace Simd
 {
 #if defined(SIMD_SSE41_ENABLE) && defined(SIMD_SYNET_ENABLE) 
     namespace Sse41
     {
+        SynetDeconvolution16bNhwcSubPixel::SynetDeconvolution16bNhwcSubPixel(const DeconvParam& p)
+            : Base::SynetDeconvolution16bNhwcSubPixel(p)
+        {
+            SetConvolutions(Sse41::SynetConvolution16bInit);
+        }
+
+        bool SynetDeconvolution16bNhwcSubPixel::Preferable(const DeconvParam& p)
+        {
+            return (p.kernelY > p.strideY || p.kernelX > p.strideX) && DeconvSubPixel::Valid(p);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         void* SynetDeconvolution16bInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
         {
             DeconvParam param(batch, conv, compatibility);
             if (!param.Valid(SimdTensorData32f, SimdTensorData16b))
                 return NULL;
+            if (SynetDeconvolution16bNhwcSubPixel::Preferable(param))
+                return new Sse41::SynetDeconvolution16bNhwcSubPixel(param);
             if (SynetDeconvolution16bNhwcGemm::Preferable(param))
                 return new Sse41::SynetDeconvolution16bNhwcGemm(param);
             return new Base::SynetDeconvolution16bGemm(param);
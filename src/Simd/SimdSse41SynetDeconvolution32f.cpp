@@ -285,11 +285,26 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        SynetDeconvolution32fNhwcSubPixel::SynetDeconvolution32fNhwcSubPixel(const DeconvParam & p)
+            : Base::SynetDeconvolution32fNhwcSubPixel(p)
+        {
+            SetConvolutions(Sse41::SynetConvolution32fInit);
+        }
+
+        bool SynetDeconvolution32fNhwcSubPixel::Preferable(const DeconvParam & p)
+        {
+            return (p.kernelY > p.strideY || p.kernelX > p.strideX) && DeconvSubPixel::Valid(p);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         void * SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility)
         {
             DeconvParam param(batch, conv, compatibility);
             if (!param.Valid(SimdTensorData32f))
                 return NULL;
+            if (SynetDeconvolution32fNhwcSubPixel::Preferable(param))
+                return new SynetDeconvolution32fNhwcSubPixel(param);
             if (SynetDeconvolution32fNhwcDirect2x2::Preferable(param))
                 return new SynetDeconvolution32fNhwcDirect2x2(param);
             else
@@ -0,0 +1,71 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetGridSample.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#if defined(SIMD_SSE41_ENABLE) && defined(SIMD_SYNET_ENABLE)    
+    namespace Sse41
+    {
+        template<int taps> void Gather32f(const float* src, const uint32_t* idx, const float* wgt, size_t stride, size_t size, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), d = 0;
+            for (; d < sizeF; d += F)
+            {
+                __m128 sum = _mm_setzero_ps();
+                for (int t = 0; t < taps; ++t)
+                {
+                    const uint32_t* i = idx + t * stride + d;
+                    __m128 val = _mm_setr_ps(src[i[0]], src[i[1]], src[i[2]], src[i[3]]);
+                    sum = _mm_add_ps(sum, _mm_mul_ps(val, _mm_loadu_ps(wgt + t * stride + d)));
+                }
+                _mm_storeu_ps(dst + d, sum);
+            }
+            for (; d < size; ++d)
+            {
+                float sum = 0.0f;
+                for (int t = 0; t < taps; ++t)
+                    sum += src[idx[t * stride + d]] * wgt[t * stride + d];
+                dst[d] = sum;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetGridSample2dGather::SynetGridSample2dGather(const GridSample2dParam& param)
+            : Base::SynetGridSample2dGather(param)
+        {
+            switch (_taps)
+            {
+            case 1: _gather = Gather32f<1>; break;
+            case 4: _gather = Gather32f<4>; break;
+            case 16: _gather = Gather32f<16>; break;
+            }
+            _bFloat16ToFloat32 = Sse41::BFloat16ToFloat32;
+            _float32ToBFloat16 = Sse41::Float32ToBFloat16;
+        }
+    }
+#endif
+}
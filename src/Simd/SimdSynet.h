@@ -116,6 +116,11 @@ namespace Simd
             return (compatibility & SimdSynetCompatibility16bfMask) == SimdSynetCompatibility16bfHard;
         }
 
+        SIMD_INLINE bool Bf16Winograd(SimdSynetCompatibilityType compatibility)
+        {
+            return (compatibility & SimdSynetCompatibility16bfWinograd) != 0;
+        }
+
         //---------------------------------------------------------------------
 
         SIMD_INLINE uint8_t SynetConvert32fTo8u(float value, float scale, float shift, int lower, int upper)
@@ -0,0 +1,143 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetCalibration_h__
+#define __SimdSynetCalibration_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    struct SynetCalibrationParam
+    {
+        size_t channels, bins;
+        SimdTensorFormatType format;
+        bool perChannel;
+
+        SynetCalibrationParam(size_t c, SimdTensorFormatType f, size_t b, SimdBool pc)
+            : channels(c)
+            , bins(b)
+            , format(f)
+            , perChannel(pc == SimdTrue)
+        {
+        }
+
+        bool Valid() const
+        {
+            return channels > 0 && bins >= 256 && bins % 4 == 0 &&
+                (format == SimdTensorFormatNchw || format == SimdTensorFormatNhwc);
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        class SynetCalibration : public Deletable
+        {
+        public:
+            SynetCalibration(const SynetCalibrationParam& p);
+
+            void Update(const float* src, size_t batch, size_t spatial);
+
+            void GetMinMax(float* min, float* max) const;
+
+            bool GetHistogram(size_t index, float* range, uint32_t* hist) const;
+
+            bool GetParams(SimdSynetCalibrationMethodType method, float percentile, SimdBool symmetric, float* scale, int32_t* zero) const;
+
+            typedef void(*MinMaxPtr)(const float* src, size_t channels, size_t spatial, SimdTensorFormatType format, float* min, float* max);
+            typedef void(*HistogramPtr)(const float* src, size_t size, float norm, float shift, size_t bins, uint32_t* hist);
+            typedef void(*HistogramNhwcPtr)(const float* src, size_t spatial, size_t channels, const float* norm, const float* shift, size_t bins, uint32_t* hist);
+
+        protected:
+            void Expand(size_t index, float absMax);
+            void GetRange(size_t index, SimdSynetCalibrationMethodType method, float percentile, bool symmetric, float& lo, float& hi) const;
+
+            SynetCalibrationParam _param;
+            size_t _count;
+            Array32f _min, _max, _bMin, _bMax, _range, _norm, _shift;
+            Array32u _hist;
+            MinMaxPtr _minMax;
+            HistogramPtr _histogram;
+            HistogramNhwcPtr _histogramNhwc;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SynetCalibrationMinMax(const float* src, size_t channels, size_t spatial, SimdTensorFormatType format, float* min, float* max);
+
+        void SynetCalibrationHistogram(const float* src, size_t size, float norm, float shift, size_t bins, uint32_t* hist);
+
+        void SynetCalibrationHistogramNhwc(const float* src, size_t spatial, size_t channels, const float* norm, const float* shift, size_t bins, uint32_t* hist);
+
+        void* SynetCalibrationInit(size_t channels, SimdTensorFormatType format, size_t bins, SimdBool perChannel);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class SynetCalibration : public Base::SynetCalibration
+        {
+        public:
+            SynetCalibration(const SynetCalibrationParam& p);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetCalibrationInit(size_t channels, SimdTensorFormatType format, size_t bins, SimdBool perChannel);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetCalibration : public Sse41::SynetCalibration
+        {
+        public:
+            SynetCalibration(const SynetCalibrationParam& p);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetCalibrationInit(size_t channels, SimdTensorFormatType format, size_t bins, SimdBool perChannel);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class SynetCalibration : public Avx2::SynetCalibration
+        {
+        public:
+            SynetCalibration(const SynetCalibrationParam& p);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetCalibrationInit(size_t channels, SimdTensorFormatType format, size_t bins, SimdBool perChannel);
+    }
+#endif
+}
+
+#endif
@@ -126,6 +126,19 @@ namespace Simd
                 (srcT == type0 || srcT == type1) && (dstT == type0 || dstT == type1);
         }
 
+        bool Reshape(size_t batch, size_t srcH, size_t srcW)
+        {
+            size_t kernelH = dilationY * (kernelY - 1) + 1, kernelW = dilationX * (kernelX - 1) + 1;
+            if (batch == 0 || srcH + padY + padH < kernelH || srcW + padX + padW < kernelW)
+                return false;
+            this->batch = batch;
+            this->srcH = srcH;
+            this->srcW = srcW;
+            this->dstH = (srcH + padY + padH - kernelH) / strideY + 1;
+            this->dstW = (srcW + padX + padW - kernelW) / strideX + 1;
+            return true;
+        }
+
         SIMD_INLINE bool IsKernel(size_t value) const
         {
             return kernelY == value && kernelX == value;
@@ -292,6 +305,81 @@ namespace Simd
 
     //-------------------------------------------------------------------------------------------------
 
+    struct DeconvSubPixel
+    {
+        SimdConvolutionParameters conv;
+        size_t phaseY, phaseX, firstY, firstX;
+
+        bool Init(const DeconvParam& p, size_t py, size_t px)
+        {
+            if (!p.trans || p.group != 1 || !p.IsDilation(1))
+                return false;
+            conv = p;
+            phaseY = py;
+            phaseX = px;
+            conv.strideY = 1;
+            conv.strideX = 1;
+            return
+                Init(p.srcH, p.dstH, p.kernelY, p.strideY, p.padY, py, firstY, conv.kernelY, conv.padY, conv.padH, conv.dstH) &&
+                Init(p.srcW, p.dstW, p.kernelX, p.strideX, p.padX, px, firstX, conv.kernelX, conv.padX, conv.padW, conv.dstW);
+        }
+
+        void SetWeight(const DeconvParam& p, const float* src, float* dst) const
+        {
+            for (size_t ky = 0; ky < conv.kernelY; ++ky)
+            {
+                size_t sy = firstY + (conv.kernelY - 1 - ky) * p.strideY;
+                for (size_t kx = 0; kx < conv.kernelX; ++kx)
+                {
+                    size_t sx = firstX + (conv.kernelX - 1 - kx) * p.strideX;
+                    for (size_t sc = 0; sc < p.srcC; ++sc, dst += p.dstC)
+                        memcpy(dst, src + ((sc * p.kernelY + sy) * p.kernelX + sx) * p.dstC, p.dstC * sizeof(float));
+                }
+            }
+        }
+
+        void SetDst(const DeconvParam& p, const uint8_t* src, size_t elem, uint8_t* dst) const
+        {
+            size_t size = p.dstC * elem, step = p.strideX * size;
+            for (size_t y = 0; y < conv.dstH; ++y)
+            {
+                uint8_t* pd = dst + ((y * p.strideY + phaseY) * p.dstW + phaseX) * size;
+                for (size_t x = 0; x < conv.dstW; ++x, src += size, pd += step)
+                    memcpy(pd, src, size);
+            }
+        }
+
+        static bool Valid(const DeconvParam& p)
+        {
+            DeconvSubPixel sp;
+            for (size_t py = 0; py < p.strideY; ++py)
+                for (size_t px = 0; px < p.strideX; ++px)
+                    if (!sp.Init(p, py, px))
+                        return false;
+            return true;
+        }
+
+    private:
+        static bool Init(size_t src, size_t dst, size_t kernel, size_t stride, size_t pad, size_t phase,
+            size_t& first, size_t& taps, size_t& padBeg, size_t& padEnd, size_t& size)
+        {
+            if (phase >= dst || kernel < stride)
+                return false;
+            first = (phase + pad) % stride;
+            taps = (kernel - first + stride - 1) / stride;
+            size = (dst - phase + stride - 1) / stride;
+            ptrdiff_t beg = ptrdiff_t(taps) - 1 - ptrdiff_t((phase + pad) / stride);
+            ptrdiff_t end = ptrdiff_t(size + taps) - 1 - ptrdiff_t(src) - beg;
+            if (beg < 0 || end < 0)
+                return false;
+            padBeg = beg;
+            padEnd = end;
+            return true;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
     struct MergConvParam
     {
         ConvParam conv[3];
@@ -25,9 +25,12 @@
 #define __SimdSynetConvolution16b_h__
 
 #include "Simd/SimdArray.h"
+#include "Simd/SimdSynetWorkspace.h"
+#include "Simd/SimdSynetWeightCache.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdSynetConvParam.h"
+#include "Simd/SimdSynetInnerProduct16b.h"
 #include "Simd/SimdGemm.h"
 
 namespace Simd
@@ -45,6 +48,11 @@ namespace Simd
         virtual String Ext() const = 0;
         virtual String Desc() const = 0;
 
+        virtual size_t WorkspaceSize() const
+        {
+            return ExternalBufferSize() * sizeof(uint8_t);
+        }
+
         virtual size_t ExternalBufferSize() const
         {
             return 1;
@@ -60,15 +68,19 @@ namespace Simd
 
         virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst) = 0;
 
+        virtual bool ForwardAdd(const uint8_t* src, const uint8_t* add, SimdTensorDataType addType, uint8_t* buf, uint8_t* dst)
+        {
+            return false;
+        }
+
+        virtual bool Reshape(size_t batch, size_t srcH, size_t srcW)
+        {
+            return false;
+        }
+
         uint8_t* Buffer(uint8_t* buffer)
         {
-            if (buffer)
-                return buffer;
-            else
-            {
-                _buffer.Resize(ExternalBufferSize());
-                return _buffer.data;
-            }
+            return SynetBuffer(buffer, ExternalBufferSize(), _buffer);
         }
 
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
@@ -132,6 +144,7 @@ namespace Simd
             virtual size_t ExternalBufferSize() const;
             virtual void SetParams(const float* weight, const float* bias, const float* params);
             virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
+            virtual bool ForwardAdd(const uint8_t* src, const uint8_t* add, SimdTensorDataType addType, uint8_t* buf, uint8_t* dst);
 
             static bool Preferable(const ConvParam& p);
 
@@ -149,14 +162,20 @@ namespace Simd
             typedef void(*ConvolutionPtr)(const uint16_t* src, const ConvParam& p, const AlgParam& a, size_t dstC, size_t dstH,
                 size_t srcC, int zero, const uint16_t* weight, const float* bias, const float* params, float* sum, uint8_t* dst);
 
+            typedef void(*AddActivatePtr)(const uint8_t* add, const ConvParam& p, size_t dstC, size_t dstH, const float* params, uint8_t* dst);
+
         protected:
             void SetAlgParam(size_t F, size_t microD, size_t microM, size_t microK, size_t L1, size_t L2, size_t L3);
             virtual void SetWeight(const float* weight);
-            void Forward(const uint8_t* src, uint16_t* buf, float* sum, uint8_t* dst);
+            void Forward(const uint8_t* src, const uint8_t* add, size_t addElem, uint8_t* buf, uint8_t* dst);
+            void Forward(const uint8_t* src, const uint8_t* add, size_t addElem, uint16_t* buf, float* sum, uint8_t* dst);
 
             AlgParam _alg;
             ConvertPtr _convert;
-            ConvolutionPtr _convolutions[2];
+            ConvolutionPtr _convolutions[2], _addConvolution;
+            AddActivatePtr _addActivate[2];
+            Base::SynetWeightPtr _sharedWeight;
+            const uint16_t* _packedWeight;
         };
 
         //-------------------------------------------------------------------------------------------------
@@ -268,6 +287,45 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class SynetConvolution16bNhwcWinograd : public SynetConvolution16b
+        {
+        public:
+            SynetConvolution16bNhwcWinograd(const ConvParam& p);
+            virtual ~SynetConvolution16bNhwcWinograd();
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const;
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float* weight, const float* bias, const float* params);
+            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
+
+            static bool Preferable(const ConvParam& p);
+
+            typedef void(*SetFilterPtr)(const float* src, size_t size, float* dst, SimdBool trans);
+            typedef void(*SetInputPtr)(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth, size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
+            typedef void(*SetOutputPtr)(const float* src, size_t srcStride, float* dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
+            typedef void(*BiasAndActivationPtr)(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, ::SimdBool trans, float* dst);
+            typedef void(*BFloat16ToFloat32Ptr)(const uint16_t* src, size_t size, float* dst);
+            typedef void(*Float32ToBFloat16Ptr)(const float* src, size_t size, uint16_t* dst);
+            typedef void*(*GemmInitPtr)(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB, SimdBool bias);
+
+        protected:
+            void SetBlock(size_t blockY, size_t blockX);
+            void SetGemm(GemmInitPtr init);
+            void Forward(const float* src, float* bufS, float* bufD, float* bufO, uint8_t* bufG, uint8_t* dst);
+
+            size_t _count, _blockY, _blockX, _tileH, _tileW, _tileHs, _merge, _split, _batch, _sizeS, _sizeD, _sizeO, _strideS, _strideD;
+            std::vector<SynetInnerProduct16b*> _gemms;
+            SetFilterPtr _setFilter;
+            SetInputPtr _setInput;
+            SetOutputPtr _setOutput;
+            BiasAndActivationPtr _biasAndActivation;
+            BFloat16ToFloat32Ptr _bFloat16ToFloat32;
+            Float32ToBFloat16Ptr _float32ToBFloat16;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         class SynetConvolution16bNchwGemm : public SynetConvolution16b
         {
         public:
@@ -306,6 +364,42 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class SynetConvolution16bReshapable : public SynetConvolution16b
+        {
+        public:
+            typedef void* (*InitPtr)(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+
+            SynetConvolution16bReshapable(const ConvParam& p, InitPtr init, size_t plans);
+            virtual ~SynetConvolution16bReshapable();
+            virtual String Ext() const { return Current()->Ext(); }
+            virtual String Desc() const { return Current()->Desc(); }
+            virtual size_t ExternalBufferSize() const { return Current()->ExternalBufferSize(); }
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float* weight, const float* bias, const float* params);
+            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
+            virtual bool ForwardAdd(const uint8_t* src, const uint8_t* add, SimdTensorDataType addType, uint8_t* buf, uint8_t* dst);
+            virtual bool Reshape(size_t batch, size_t srcH, size_t srcW);
+
+            bool Valid() const { return _plans.size() > 0; }
+
+        protected:
+            struct Plan
+            {
+                size_t batch, srcH, srcW;
+                SynetConvolution16b* conv;
+            };
+            typedef std::vector<Plan> Plans;
+
+            Plans _plans;
+            InitPtr _init;
+            size_t _capacity;
+            const float* _srcWeight, * _srcBias, * _srcParams;
+
+            SIMD_INLINE SynetConvolution16b* Current() const { return _plans[0].conv; }
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void* SynetConvolution16bInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
     }
 
@@ -344,6 +438,14 @@ namespace Simd
             virtual String Ext() const { return "Sse41"; }
         };
 
+        class SynetConvolution16bNhwcWinograd : public Base::SynetConvolution16bNhwcWinograd
+        {
+        public:
+            SynetConvolution16bNhwcWinograd(const ConvParam& p);
+
+            virtual String Ext() const { return "Sse41"; }
+        };
+
         class SynetConvolution16bNchwGemm : public Base::SynetConvolution16bNchwGemm
         {
         public:
@@ -393,6 +495,14 @@ namespace Simd
             virtual String Ext() const { return "Avx2"; }
         };
 
+        class SynetConvolution16bNhwcWinograd : public Sse41::SynetConvolution16bNhwcWinograd
+        {
+        public:
+            SynetConvolution16bNhwcWinograd(const ConvParam& p);
+
+            virtual String Ext() const { return "Avx2"; }
+        };
+
         class SynetConvolution16bNchwGemm : public Sse41::SynetConvolution16bNchwGemm
         {
         public:
@@ -442,6 +552,14 @@ namespace Simd
             virtual String Ext() const { return "Avx512bw"; }
         };
 
+        class SynetConvolution16bNhwcWinograd : public Avx2::SynetConvolution16bNhwcWinograd
+        {
+        public:
+            SynetConvolution16bNhwcWinograd(const ConvParam& p);
+
+            virtual String Ext() const { return "Avx512bw"; }
+        };
+
         class SynetConvolution16bNchwGemm : public Avx2::SynetConvolution16bNchwGemm
         {
         public:
@@ -483,6 +601,14 @@ namespace Simd
             virtual String Ext() const { return "AmxBf16"; }
         };
 
+        class SynetConvolution16bNhwcWinograd : public Avx512bw::SynetConvolution16bNhwcWinograd
+        {
+        public:
+            SynetConvolution16bNhwcWinograd(const ConvParam& p);
+
+            virtual String Ext() const { return "AmxBf16"; }
+        };
+
         class SynetConvolution16bNchwGemm : public Avx512bw::SynetConvolution16bNchwGemm
         {
         public:
@@ -66,6 +66,33 @@ namespace Simd
         {
             Term16b<term>::template Save<type>(ptr, val0, bias, params, offset + 0);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE float LoadValue(const float* src)
+        {
+            return src[0];
+        }
+
+        SIMD_INLINE float LoadValue(const uint16_t* src)
+        {
+            return BFloat16ToFloat32(src[0]);
+        }
+
+        SIMD_INLINE void SaveValue(float* dst, float value)
+        {
+            dst[0] = value;
+        }
+
+        SIMD_INLINE void SaveValue(uint16_t* dst, float value)
+        {
+            dst[0] = Float32ToBFloat16(value);
+        }
+
+        template<SimdConvolutionActivationType type, class A, class D> SIMD_INLINE void AddActivate16b(const A* add, const float* params, size_t offset, D* dst)
+        {
+            SaveValue(dst + offset, Activate<type>(LoadValue(dst + offset) + LoadValue(add + offset), params, offset));
+        }
     }
 
 #ifdef SIMD_SSE41_ENABLE
@@ -83,6 +110,23 @@ namespace Simd
             return  _mm_castsi128_ps(UnpackU16<0>(K_ZERO, _mm_loadl_epi64((__m128i*)src)));
         }
 
+        template <class T> SIMD_INLINE void SaveDst(T* dst, __m128 value);
+
+        template <> SIMD_INLINE void SaveDst<float>(float* dst, __m128 value)
+        {
+            _mm_storeu_ps(dst, value);
+        }
+
+        template <> SIMD_INLINE void SaveDst<uint16_t>(uint16_t* dst, __m128 value)
+        {
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi32(Float32ToBFloat16(value), K_ZERO));
+        }
+
+        template<SimdConvolutionActivationType type, class A, class D> SIMD_INLINE void AddActivate16b(const A* add, const float* params, size_t offset, D* dst)
+        {
+            SaveDst<D>(dst + offset, Activate<type>(_mm_add_ps(LoadSrc(dst + offset), LoadSrc(add + offset)), params, offset));
+        }
+
         //-------------------------------------------------------------------------------------------------
 
         template <Term16bType term> struct Term16b
@@ -391,6 +435,24 @@ namespace Simd
             return Avx2::BFloat16ToFloat32(_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)src)));
         }
 
+        template <class T> SIMD_INLINE void SaveDst(T* dst, __m256 value);
+
+        template <> SIMD_INLINE void SaveDst<float>(float* dst, __m256 value)
+        {
+            _mm256_storeu_ps(dst, value);
+        }
+
+        template <> SIMD_INLINE void SaveDst<uint16_t>(uint16_t* dst, __m256 value)
+        {
+            __m256i b16 = _mm256_permute4x64_epi64(_mm256_packus_epi32(Float32ToBFloat16(value), Avx2::K_ZERO), 0xD8);
+            _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(b16));
+        }
+
+        template<SimdConvolutionActivationType type, class A, class D> SIMD_INLINE void AddActivate16b(const A* add, const float* params, size_t offset, D* dst)
+        {
+            SaveDst<D>(dst + offset, Activate<type>(_mm256_add_ps(LoadSrc(dst + offset), LoadSrc(add + offset)), params, offset));
+        }
+
         //-------------------------------------------------------------------------------------------------
         
         template <Term16bType term> struct Term16b
@@ -709,6 +771,24 @@ namespace Simd
             return BFloat16ToFloat32(_mm256_maskz_loadu_epi16(tail, src));
         }
 
+        template <class T> SIMD_INLINE void SaveDst(T* dst, __m512 value, __mmask16 tail = __mmask16(-1));
+
+        template <> SIMD_INLINE void SaveDst<float>(float* dst, __m512 value, __mmask16 tail)
+        {
+            _mm512_mask_storeu_ps(dst, tail, value);
+        }
+
+        template <> SIMD_INLINE void SaveDst<uint16_t>(uint16_t* dst, __m512 value, __mmask16 tail)
+        {
+            _mm256_mask_storeu_epi16(dst, tail, _mm512_cvtepi32_epi16(Float32ToBFloat16(value)));
+        }
+
+        template<SimdConvolutionActivationType type, class A, class D> SIMD_INLINE void AddActivate16b(const A* add, const float* params, size_t offset, D* dst, __mmask16 tail = __mmask16(-1))
+        {
+            __m512 value = _mm512_add_ps(LoadSrc(dst + offset, tail), LoadSrc(add + offset, tail));
+            SaveDst<D>(dst + offset, Activate<type>(value, params, offset, tail), tail);
+        }
+
         //-------------------------------------------------------------------------------------------------
 
         template <Term16bType term> struct Term16b
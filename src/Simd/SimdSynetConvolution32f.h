@@ -25,6 +25,8 @@
 #define __SimdSynetConvolution32f_h__
 
 #include "Simd/SimdArray.h"
+#include "Simd/SimdSynetWorkspace.h"
+#include "Simd/SimdSynetWeightCache.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdGemm.h"
 #include "Simd/SimdSynetConvParam.h"
@@ -68,6 +70,11 @@ namespace Simd
         virtual String Ext() const = 0;
         virtual String Desc() const = 0;
 
+        virtual size_t WorkspaceSize() const
+        {
+            return ExternalBufferSize() * sizeof(float);
+        }
+
         virtual size_t ExternalBufferSize() const
         {
             return 1;
@@ -89,15 +96,14 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        virtual bool Reshape(size_t batch, size_t srcH, size_t srcW)
+        {
+            return false;
+        }
+
         float * Buffer(float * buffer)
         {
-            if (buffer)
-                return buffer;
-            else
-            {
-                _buffer.Resize(ExternalBufferSize());
-                return _buffer.data;
-            }
+            return SynetBuffer(buffer, ExternalBufferSize(), _buffer);
         }
 
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
@@ -329,6 +335,7 @@ namespace Simd
         protected:
             size_t _sizeS, _sizeD;
             Array32f _rWeight, _rBias, _rParams;
+            Base::SynetWeightPtr _sharedWeight;
 
             static void Forward(const float* src, const ConvParam& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst);
 
@@ -387,6 +394,40 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class SynetConvolution32fReshapable : public SynetConvolution32f
+        {
+        public:
+            typedef void* (*InitPtr)(size_t batch, const SimdConvolutionParameters* conv);
+
+            SynetConvolution32fReshapable(const ConvParam& p, InitPtr init, size_t plans);
+            virtual ~SynetConvolution32fReshapable();
+            virtual String Ext() const { return Current()->Ext(); }
+            virtual String Desc() const { return Current()->Desc(); }
+            virtual size_t ExternalBufferSize() const { return Current()->ExternalBufferSize(); }
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params);
+            virtual void Forward(const float* src, float* buf, float* dst);
+            virtual bool Reshape(size_t batch, size_t srcH, size_t srcW);
+
+            bool Valid() const { return _plans.size() > 0; }
+
+        protected:
+            struct Plan
+            {
+                size_t batch, srcH, srcW;
+                SynetConvolution32f* conv;
+            };
+            typedef std::vector<Plan> Plans;
+
+            Plans _plans;
+            InitPtr _init;
+            size_t _capacity;
+
+            SIMD_INLINE SynetConvolution32f* Current() const { return _plans[0].conv; }
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv);
     }
 
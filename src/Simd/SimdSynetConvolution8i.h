@@ -26,6 +26,7 @@
 
 #include "Simd/SimdSynetConvParam.h"
 #include "Simd/SimdArray.h"
+#include "Simd/SimdSynetWorkspace.h"
 #include "Simd/SimdPerformance.h"
 
 #ifdef _N
@@ -64,6 +65,11 @@ namespace Simd
         virtual String Ext() const = 0;
         virtual String Desc() const = 0;
 
+        virtual size_t WorkspaceSize() const
+        {
+            return ExternalBufferSize() * sizeof(uint8_t);
+        }
+
         virtual size_t ExternalBufferSize() const;
         virtual size_t InternalBufferSize() const;
 
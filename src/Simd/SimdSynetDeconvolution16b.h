@@ -25,6 +25,7 @@
 #define __SimdSynetDeconvolution16b_h__
 
 #include "Simd/SimdArray.h"
+#include "Simd/SimdSynetWorkspace.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdGemm.h"
@@ -32,6 +33,8 @@
 
 namespace Simd
 {
+    class SynetConvolution16b;
+
     class SynetDeconvolution16b : public Deletable
     {
     public:
@@ -45,6 +48,11 @@ namespace Simd
         virtual String Ext() const = 0;
         virtual String Desc() const = 0;
 
+        virtual size_t WorkspaceSize() const
+        {
+            return ExternalBufferSize() * sizeof(uint8_t);
+        }
+
         virtual size_t ExternalBufferSize() const
         {
             return 1;
@@ -62,13 +70,7 @@ namespace Simd
 
         uint8_t* Buffer(uint8_t* buffer)
         {
-            if (buffer)
-                return buffer;
-            else
-            {
-                _buffer.Resize(ExternalBufferSize());
-                return _buffer.data;
-            }
+            return SynetBuffer(buffer, ExternalBufferSize(), _buffer);
         }
 
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
@@ -159,6 +161,30 @@ namespace Simd
             BiasActPtr _biasAct;
         };
 
+        class SynetDeconvolution16bNhwcSubPixel : public SynetDeconvolution16b
+        {
+        public:
+            SynetDeconvolution16bNhwcSubPixel(const DeconvParam& p);
+            virtual ~SynetDeconvolution16bNhwcSubPixel();
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const;
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float* weight, const float* bias, const float* params);
+            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
+
+            static bool Preferable(const DeconvParam& p);
+
+            typedef void* (*ConvolutionInitPtr)(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+
+        protected:
+            void SetConvolutions(ConvolutionInitPtr init);
+
+            std::vector<DeconvSubPixel> _phases;
+            std::vector<SynetConvolution16b*> _convs;
+            size_t _sizeB;
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         void * SynetDeconvolution16bInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
@@ -176,6 +202,15 @@ namespace Simd
             static bool Preferable(const DeconvParam& p);
         };
 
+        class SynetDeconvolution16bNhwcSubPixel : public Base::SynetDeconvolution16bNhwcSubPixel
+        {
+        public:
+            SynetDeconvolution16bNhwcSubPixel(const DeconvParam& p);
+            virtual String Ext() const { return "Sse41"; }
+
+            static bool Preferable(const DeconvParam& p);
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         void* SynetDeconvolution16bInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
@@ -192,6 +227,13 @@ namespace Simd
             virtual String Ext() const { return "Avx2"; }
         };
 
+        class SynetDeconvolution16bNhwcSubPixel : public Sse41::SynetDeconvolution16bNhwcSubPixel
+        {
+        public:
+            SynetDeconvolution16bNhwcSubPixel(const DeconvParam& p);
+            virtual String Ext() const { return "Avx2"; }
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         void* SynetDeconvolution16bInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
@@ -208,6 +250,13 @@ namespace Simd
             virtual String Ext() const { return "Avx512bw"; }
         };
 
+        class SynetDeconvolution16bNhwcSubPixel : public Avx2::SynetDeconvolution16bNhwcSubPixel
+        {
+        public:
+            SynetDeconvolution16bNhwcSubPixel(const DeconvParam& p);
+            virtual String Ext() const { return "Avx512bw"; }
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         void* SynetDeconvolution16bInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
@@ -224,6 +273,13 @@ namespace Simd
             virtual String Ext() const { return "AmxBf16"; }
         };
 
+        class SynetDeconvolution16bNhwcSubPixel : public Avx512bw::SynetDeconvolution16bNhwcSubPixel
+        {
+        public:
+            SynetDeconvolution16bNhwcSubPixel(const DeconvParam& p);
+            virtual String Ext() const { return "AmxBf16"; }
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         void* SynetDeconvolution16bInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
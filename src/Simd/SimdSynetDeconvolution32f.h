@@ -25,6 +25,7 @@
 #define __SimdSynetDeconvolution32f_h__
 
 #include "Simd/SimdArray.h"
+#include "Simd/SimdSynetWorkspace.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdGemm.h"
@@ -36,6 +37,8 @@
 
 namespace Simd
 {
+    class SynetConvolution32f;
+
     class SynetDeconvolution32f : public Deletable
     {
     public:
@@ -60,6 +63,11 @@ namespace Simd
         virtual String Ext() const = 0;
         virtual String Desc() const = 0;
 
+        virtual size_t WorkspaceSize() const
+        {
+            return ExternalBufferSize() * sizeof(float);
+        }
+
         virtual size_t ExternalBufferSize() const
         {
             return 1;
@@ -83,13 +91,7 @@ namespace Simd
 
         float * Buffer(float * buffer)
         {
-            if (buffer)
-                return buffer;
-            else
-            {
-                _buffer.Resize(ExternalBufferSize());
-                return _buffer.data;
-            }
+            return SynetBuffer(buffer, ExternalBufferSize(), _buffer);
         }
 
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
@@ -171,6 +173,31 @@ namespace Simd
             DeconvolutionPtr _deconvolution;
         };
 
+        class SynetDeconvolution32fNhwcSubPixel : public SynetDeconvolution32f
+        {
+        public:
+            SynetDeconvolution32fNhwcSubPixel(const DeconvParam & p);
+            virtual ~SynetDeconvolution32fNhwcSubPixel();
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const;
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
+            virtual void Forward(const float * src, float * buf, float * dst);
+
+            static bool Preferable(const DeconvParam & p);
+
+            typedef void* (*ConvolutionInitPtr)(size_t batch, const SimdConvolutionParameters * conv);
+
+        protected:
+            void SetConvolutions(ConvolutionInitPtr init);
+
+            std::vector<DeconvSubPixel> _phases;
+            std::vector<SynetConvolution32f*> _convs;
+            Array32f _weightS;
+            size_t _sizeS, _sizeD, _sizeB;
+        };
+
         void * SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
     }
 
@@ -196,6 +223,15 @@ namespace Simd
             static bool Preferable(const DeconvParam & p);
         };
 
+        class SynetDeconvolution32fNhwcSubPixel : public Base::SynetDeconvolution32fNhwcSubPixel
+        {
+        public:
+            SynetDeconvolution32fNhwcSubPixel(const DeconvParam & p);
+            virtual String Ext() const { return "Sse41"; }
+
+            static bool Preferable(const DeconvParam & p);
+        };
+
         void * SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
     }
 #endif
@@ -217,6 +253,13 @@ namespace Simd
             virtual String Ext() const { return "Avx2"; }
         };
 
+        class SynetDeconvolution32fNhwcSubPixel : public Sse41::SynetDeconvolution32fNhwcSubPixel
+        {
+        public:
+            SynetDeconvolution32fNhwcSubPixel(const DeconvParam & p);
+            virtual String Ext() const { return "Avx2"; }
+        };
+
         void * SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
     }
 #endif//SIMD_AVX2_ENABLE
@@ -241,6 +284,13 @@ namespace Simd
             virtual String Ext() const { return "Avx512bw"; }
         };
 
+        class SynetDeconvolution32fNhwcSubPixel : public Avx2::SynetDeconvolution32fNhwcSubPixel
+        {
+        public:
+            SynetDeconvolution32fNhwcSubPixel(const DeconvParam & p);
+            virtual String Ext() const { return "Avx512bw"; }
+        };
+
         void * SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
     }
 #endif
@@ -55,7 +55,9 @@ namespace Simd
 
         SIMD_INLINE bool Valid() const
         {
-            return true;
+            return (type == SimdTensorData32f || type == SimdTensorData16b) && 
+                interp >= SimdGridSampleInterpBilinear && interp <= SimdGridSampleInterpBicubic &&
+                padding >= SimdGridSamplePaddingZeros && padding <= SimdGridSamplePaddingReflect;
         }
 
         bool Is32fBlZ() const
@@ -89,6 +91,48 @@ namespace Simd
 
     namespace Base
     {
+        template <typename T, SimdBool align> SIMD_INLINE T Denormalize(T pos, ptrdiff_t dim)
+        {
+            if (align)
+                return T((pos + 1) / 2.0f * (dim - 1));
+            else
+                return T(((pos + 1) * dim - 1) / 2.0f);
+        }
+
+        template <typename T> SIMD_INLINE T Reflect(T x, float min, float max)
+        {
+            float fx = float(x);
+            float range = max - min;
+            if (fx < min)
+            {
+                float dx = min - fx;
+                int n = int(dx / range);
+                float r = dx - n * range;
+                return n % 2 == 0 ? T(min + r) : T(max - r);
+            }
+            else if (fx > max)
+            {
+                float dx = fx - max;
+                int n = int(dx / range);
+                float r = dx - n * range;
+                return n % 2 == 0 ? T(max - r) : T(min + r);
+            }
+            else
+                return T(fx);
+        }
+
+        SIMD_INLINE void CubicCoeffs(float x, float k[4])
+        {
+            static const float a = -0.75f;
+            x = std::abs(x);
+            k[0] = ((a * (x + 1.0f) - 5.0f * a) * (x + 1.0f) + 8.0f * a) * (x + 1.0f) - 4.0f * a;
+            k[1] = ((a + 2.0f) * x - (a + 3.0f)) * x * x + 1.0f;
+            k[2] = ((a + 2.0f) * (1.0f - x) - (a + 3.0f)) * (1.0f - x) * (1.0f - x) + 1.0f;
+            k[3] = ((a * (2.0f - x) - 5.0f * a) * (2.0f - x) + 8.0f * a) * (2.0f - x) - 4.0f * a;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         class SynetGridSample2dRef : public Simd::SynetGridSample2d
         {
         public:
@@ -122,6 +166,30 @@ namespace Simd
             BilinearInterpPtr _bilinearInterp;
         };
 
+        class SynetGridSample2dGather : public Simd::SynetGridSample2d
+        {
+        public:
+            SynetGridSample2dGather(const GridSample2dParam& param);
+
+            virtual size_t InternalBufferSize() const;
+
+            virtual void Forward(const uint8_t* src, const uint8_t* grd, uint8_t* dst);
+
+            typedef void (*IndexCoeffsPtr)(const float* grd, size_t size, int srcH, int srcW, size_t stride, uint32_t* idx, float* wgt);
+            typedef void (*GatherPtr)(const float* src, const uint32_t* idx, const float* wgt, size_t stride, size_t size, float* dst);
+            typedef void (*BFloat16ToFloat32Ptr)(const uint16_t* src, size_t size, float* dst);
+            typedef void (*Float32ToBFloat16Ptr)(const float* src, size_t size, uint16_t* dst);
+
+        protected:
+            size_t _srcS, _dstS, _taps, _rows, _block, _threads;
+            Array32f _coeffs, _src32f, _grd32f, _dst32f;
+            Array32u _index;
+            IndexCoeffsPtr _indexCoeffs;
+            GatherPtr _gather;
+            BFloat16ToFloat32Ptr _bFloat16ToFloat32;
+            Float32ToBFloat16Ptr _float32ToBFloat16;
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         void * SynetGridSample2dInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t dstH, size_t dstW,
@@ -137,6 +205,12 @@ namespace Simd
             SynetGridSample2d32fBlZ(const GridSample2dParam& param);
         };
 
+        class SynetGridSample2dGather : public Base::SynetGridSample2dGather
+        {
+        public:
+            SynetGridSample2dGather(const GridSample2dParam& param);
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         void* SynetGridSample2dInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t dstH, size_t dstW,
@@ -153,6 +227,12 @@ namespace Simd
             SynetGridSample2d32fBlZ(const GridSample2dParam& param);
         };
 
+        class SynetGridSample2dGather : public Sse41::SynetGridSample2dGather
+        {
+        public:
+            SynetGridSample2dGather(const GridSample2dParam& param);
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         void* SynetGridSample2dInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t dstH, size_t dstW,
@@ -25,6 +25,7 @@
 #define __SimdSynetInnerProduct16b_h__
 
 #include "Simd/SimdArray.h"
+#include "Simd/SimdSynetWorkspace.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdSynetConvParam.h"
 
@@ -35,13 +36,15 @@ namespace Simd
         size_t M, N, K;
         SimdTensorDataType typeA, typeB, typeC;
         SimdBool transB, constB, bias;
+        size_t qBits, qGroup;
 
         InnerProductParam16b(size_t m, size_t n, size_t k,
             SimdTensorDataType ta, SimdTensorDataType tb, SimdTensorDataType tc,
-            SimdBool t, SimdBool c, SimdBool b)
+            SimdBool t, SimdBool c, SimdBool b, size_t qb = 0, size_t qg = 0)
             : M(m), N(n), K(k)
             , typeA(ta), typeB(tb), typeC(tc)
             , transB(t), constB(c), bias(b)
+            , qBits(qb), qGroup(qg)
         {
         }
 
@@ -50,7 +53,8 @@ namespace Simd
             return
                 (typeA == SimdTensorData32f || typeA == SimdTensorData16b) &&
                 (typeB == SimdTensorData32f || typeB == SimdTensorData16b) &&
-                (typeC == SimdTensorData32f || typeC == SimdTensorData16b);
+                (typeC == SimdTensorData32f || typeC == SimdTensorData16b) &&
+                (qBits == 0 || ((qBits == 4 || qBits == 8) && typeB == SimdTensorData32f && constB && qGroup >= 2 && qGroup % 2 == 0));
         }
 
         String Info() const
@@ -59,6 +63,8 @@ namespace Simd
             ss << M << "x" << N << "x" << K << "-";
             ss << ToChar(typeA) << ToChar(typeB) << ToChar(typeC) << "-";
             ss << (transB ? "t" : "n") << (constB ? "1" : "2") << (bias ? "b" : "o");
+            if (qBits)
+                ss << "-q" << qBits << "g" << qGroup;
             return ss.str();
         }
 
@@ -94,6 +100,11 @@ namespace Simd
             return _buffer.RawSize() + _weight.RawSize() + _bias.RawSize();
         }
 
+        virtual size_t WorkspaceSize() const
+        {
+            return ExternalBufferSize() * sizeof(uint8_t);
+        }
+
         virtual size_t ExternalBufferSize() const
         {
             return _sizeA * 2 + _sizeB * 2 + _sizeC * 4;
@@ -133,13 +144,7 @@ namespace Simd
 
         uint8_t* Buffer(uint8_t* buffer)
         {
-            if (buffer)
-                return buffer;
-            else
-            {
-                _buffer.Resize(ExternalBufferSize());
-                return _buffer.data;
-            }
+            return SynetBuffer(buffer, ExternalBufferSize(), _buffer);
         }
     };
 
@@ -164,6 +169,7 @@ namespace Simd
         {
         public:
             SynetInnerProduct16bGemmNN(const InnerProductParam16b& p);
+            virtual size_t InternalBufferSize() const;
             virtual String Ext() const { return "Base"; }
             virtual String Desc() const;
             virtual void SetParams(const float* weight, const float* bias);
@@ -180,18 +186,32 @@ namespace Simd
 
             typedef void(*PrepPtr)(const uint8_t* src, const InnerProductParam16b& p, const AlgParam& a, size_t size, size_t K, uint16_t* dst);
             typedef void(*GemmPtr)(const uint16_t* A, const InnerProductParam16b& p, const AlgParam& a, size_t M, size_t N, size_t K, int update, const uint16_t* B, float* C, int post, const float* bias, uint8_t* dst);
+            typedef void(*DequantPtr)(const uint8_t* src, const float* scale, const InnerProductParam16b& p, const AlgParam& a, size_t N, size_t k, size_t K, uint16_t* dst);
+            typedef void(*GemvPtr)(const float* A, const InnerProductParam16b& p, const AlgParam& a, const uint8_t* src, const float* scale, const float* bias, uint8_t* C);
 
         protected:
             void SetAlgParam(size_t F, size_t microM, size_t microN, size_t microK, size_t L1, size_t L2, size_t L3);
+            void SetQuantizedWeight(const float* weight);
+            void SetGemv(GemvPtr gemv);
 
             AlgParam _alg;
             PrepPtr _prepA, _prepB;
             GemmPtr _gemm;
+            DequantPtr _dequantB;
+            GemvPtr _gemv;
+            Array8u _qWeight;
+            Array32f _qScale;
         };
 
         //-------------------------------------------------------------------------------------------------
 
+        void SynetInnerProduct16bQuantizeWeight(const float* weight, const InnerProductParam16b& p, int8_t* dst, float* scale);
+
+        //-------------------------------------------------------------------------------------------------
+
         void* SynetInnerProduct16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB, SimdBool bias);
+
+        void* SynetInnerProduct16bInitWq(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeC, SimdBool transB, SimdBool bias, size_t bits, size_t group);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -208,6 +228,8 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* SynetInnerProduct16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB, SimdBool bias);
+
+        void* SynetInnerProduct16bInitWq(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeC, SimdBool transB, SimdBool bias, size_t bits, size_t group);
     }
 #endif
 
@@ -225,6 +247,8 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* SynetInnerProduct16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB, SimdBool bias);
+
+        void* SynetInnerProduct16bInitWq(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeC, SimdBool transB, SimdBool bias, size_t bits, size_t group);
     }
 #endif
 
@@ -246,6 +270,8 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* SynetInnerProduct16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB, SimdBool bias);
+
+        void* SynetInnerProduct16bInitWq(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeC, SimdBool transB, SimdBool bias, size_t bits, size_t group);
     }
 #endif
 
@@ -263,6 +289,8 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* SynetInnerProduct16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB, SimdBool bias);
+
+        void* SynetInnerProduct16bInitWq(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeC, SimdBool transB, SimdBool bias, size_t bits, size_t group);
     }
 #endif
 }
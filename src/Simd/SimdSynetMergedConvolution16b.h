@@ -26,6 +26,7 @@
 
 #include "Simd/SimdSynetConvParam.h"
 #include "Simd/SimdArray.h"
+#include "Simd/SimdSynetWorkspace.h"
 
 namespace Simd
 {
@@ -34,6 +35,11 @@ namespace Simd
     public:
         virtual const MergConvParam& Param() const = 0;
 
+        virtual size_t WorkspaceSize() const
+        {
+            return ExternalBufferSize() * sizeof(uint8_t);
+        }
+
         virtual size_t ExternalBufferSize() const = 0;
 
         virtual size_t InternalBufferSize() const = 0;
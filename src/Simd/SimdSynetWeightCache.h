@@ -0,0 +1,81 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetWeightCache_h__
+#define __SimdSynetWeightCache_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdPerformance.h"
+
+#include <memory>
+#include <functional>
+
+namespace Simd
+{
+    namespace Base
+    {
+        typedef std::shared_ptr<const void> SynetWeightPtr;
+
+        typedef std::function<void(void* dst)> SynetWeightPackPtr;
+
+        struct SynetWeightCacheStat
+        {
+            size_t entries, bytes, hits, misses, saved;
+        };
+
+        void SetSynetWeightCache(bool enable);
+
+        bool GetSynetWeightCache();
+
+        void ForceSynetWeightCache(bool force);
+
+        class SynetWeightCacheForce
+        {
+        public:
+            SynetWeightCacheForce() { ForceSynetWeightCache(true); }
+            ~SynetWeightCacheForce() { ForceSynetWeightCache(false); }
+        };
+
+        SynetWeightCacheStat SynetWeightCacheStatistics();
+
+        SynetWeightPtr SynetWeightCacheGet(const String& key, const void* src, size_t srcSize, size_t dstSize, const SynetWeightPackPtr& pack);
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    template<class T, class Pack> SIMD_INLINE const T* SynetPackWeight(const String& key, const float* src, size_t srcSize, size_t dstSize,
+        Array<T>& own, Base::SynetWeightPtr& shared, Pack pack)
+    {
+        shared = Base::SynetWeightCacheGet(key, src, srcSize * sizeof(float), dstSize * sizeof(T), [&pack](void* dst) { pack((T*)dst); });
+        if (shared)
+        {
+            own.Resize(0);
+            return (const T*)shared.get();
+        }
+        own.Resize(dstSize, true);
+        pack(own.data);
+        return own.data;
+    }
+}
+
+#endif
@@ -0,0 +1,54 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetWorkspace_h__
+#define __SimdSynetWorkspace_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        bool SetSynetWorkspace(size_t size, bool hugePages);
+
+        size_t GetSynetWorkspace();
+
+        void* SynetWorkspace(size_t size);
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    template<class T> SIMD_INLINE T* SynetBuffer(T* buffer, size_t size, Array<T>& own)
+    {
+        if (buffer)
+            return buffer;
+        buffer = (T*)Base::SynetWorkspace(size * sizeof(T));
+        if (buffer)
+            return buffer;
+        own.Resize(size);
+        return own.data;
+    }
+}
+
+#endif
@@ -29,11 +29,13 @@
 
 #include "Simd/SimdPoint.hpp"
 
+#include <vector>
+
 namespace Simd
 {
     struct WarpAffParam
     {
-        static const int BorderSizeMax = 4 * 1;
+        static const int BorderSizeMax = 4 * 4;
 
         SimdWarpAffineFlags flags;
         float mat[6], inv[6];
@@ -44,7 +46,7 @@ namespace Simd
 
         bool Valid() const
         {
-            return channels >= 1 && channels <= 4 && srcH * srcS <= 0x100000000 &&
+            return channels >= 1 && channels <= 4 && srcH * srcS <= 0x100000000 && (flags & SimdWarpAffineChannelMask) != SimdWarpAffineChannelMask &&
                 (inv[0] != 0.0f || inv[1] != 0.0f || inv[3] != 0.0f || inv[4] != 0.0f);
         }
 
@@ -53,9 +55,24 @@ namespace Simd
             return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest;
         }
 
-        bool IsByteBilinear() const
+        bool IsBilinear() const
+        {
+            return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear;
+        }
+
+        bool IsByte() const
+        {
+            return (SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelByte;
+        }
+
+        bool IsShort() const
+        {
+            return (SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelShort;
+        }
+
+        bool IsFloat() const
         {
-            return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear && (SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelByte;
+            return (SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelFloat;
         }
 
         bool NeedFill() const
@@ -68,6 +85,8 @@ namespace Simd
             switch (SimdWarpAffineChannelMask & flags)
             {
             case SimdWarpAffineChannelByte: return 1;
+            case SimdWarpAffineChannelShort: return 2;
+            case SimdWarpAffineChannelFloat: return 4;
             default:
                 assert(0); return 0;
             }
@@ -88,6 +107,9 @@ namespace Simd
 
         virtual void Run(const uint8_t * src, uint8_t * dst) = 0;
 
+        void SetMatrix(const float* mat);
+        void SetThreads(size_t threads);
+
     protected:
         WarpAffParam _param;
         bool _first;
@@ -123,12 +145,12 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        class WarpAffineByteBilinear : public WarpAffine
+        class WarpAffineBilinear : public WarpAffine
         {
         public:
             typedef void(*RunPtr)(const WarpAffParam& p, int yBeg, int yEnd, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf);
 
-            WarpAffineByteBilinear(const WarpAffParam & param);
+            WarpAffineBilinear(const WarpAffParam & param);
 
             virtual void Run(const uint8_t * src, uint8_t * dst);
 
@@ -144,7 +166,43 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class WarpAffineBatch : Deletable
+        {
+        public:
+            WarpAffineBatch(const WarpAffParam& param, SimdTensorDataType type, const float* mean, const float* std);
+            virtual ~WarpAffineBatch();
+
+            void Run(const uint8_t* src, const float* mats, size_t batch, uint8_t* dst);
+
+            static bool Valid(const WarpAffParam& param, SimdTensorDataType type)
+            {
+                return param.Valid() && param.IsByte() && (type == SimdTensorData8u || 
+                    ((type == SimdTensorData32f || type == SimdTensorData16b) && param.NeedFill()));
+            }
+
+        protected:
+            typedef void* (*WarpAffineInitPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+            typedef void (*Convert8uTo32fPtr)(const uint8_t* src, size_t size, const float* scale, const float* shift, float* dst);
+            typedef void (*Float32ToBFloat16Ptr)(const float* src, size_t size, uint16_t* dst);
+
+            void SetWarps(WarpAffineInitPtr init);
+
+            WarpAffParam _param;
+            SimdTensorDataType _type;
+            size_t _rowSize, _dstSize, _threads;
+            std::vector<class WarpAffine*> _warps;
+            Array32f _scale, _shift, _dst32f;
+            Array8u _dst8u;
+            Convert8uTo32fPtr _convert8uTo32f;
+            Float32ToBFloat16Ptr _float32ToBFloat16;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void * WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels,
+            SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* mean, const float* std);
     }
 
 #ifdef SIMD_SSE41_ENABLE
@@ -161,10 +219,10 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        class WarpAffineByteBilinear : public Base::WarpAffineByteBilinear
+        class WarpAffineBilinear : public Base::WarpAffineBilinear
         {
         public:
-            WarpAffineByteBilinear(const WarpAffParam& param);
+            WarpAffineBilinear(const WarpAffParam& param);
 
         protected:
             virtual void SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi);
@@ -172,7 +230,18 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class WarpAffineBatch : public Base::WarpAffineBatch
+        {
+        public:
+            WarpAffineBatch(const WarpAffParam& param, SimdTensorDataType type, const float* mean, const float* std);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels,
+            SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* mean, const float* std);
     }
 #endif
 
@@ -190,10 +259,10 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
  
-        class WarpAffineByteBilinear : public Sse41::WarpAffineByteBilinear
+        class WarpAffineBilinear : public Sse41::WarpAffineBilinear
         {
         public:
-            WarpAffineByteBilinear(const WarpAffParam& param);
+            WarpAffineBilinear(const WarpAffParam& param);
 
         protected:
             virtual void SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi);
@@ -201,7 +270,18 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class WarpAffineBatch : public Sse41::WarpAffineBatch
+        {
+        public:
+            WarpAffineBatch(const WarpAffParam& param, SimdTensorDataType type, const float* mean, const float* std);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels,
+            SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* mean, const float* std);
     }
 #endif
 
@@ -219,10 +299,10 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        class WarpAffineByteBilinear : public Avx2::WarpAffineByteBilinear
+        class WarpAffineBilinear : public Avx2::WarpAffineBilinear
         {
         public:
-            WarpAffineByteBilinear(const WarpAffParam& param);
+            WarpAffineBilinear(const WarpAffParam& param);
 
         protected:
             virtual void SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi);
@@ -230,7 +310,18 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class WarpAffineBatch : public Avx2::WarpAffineBatch
+        {
+        public:
+            WarpAffineBatch(const WarpAffParam& param, SimdTensorDataType type, const float* mean, const float* std);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels,
+            SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* mean, const float* std);
     }
 #endif
 }
@@ -25,12 +25,33 @@
 #define __SimdWarpAffineCommon_h__
 
 #include "Simd/SimdWarpAffine.h"
+#include "Simd/SimdRemap.h"
 #include "Simd/SimdCopy.h"
+#include "Simd/SimdUnpack.h"
+#include "Simd/SimdStore.h"
 
 namespace Simd
 {
     namespace Base
     {
+        template<int N> SIMD_INLINE void FillBorder(uint8_t* dst, int count, const uint8_t* bs)
+        {
+            int i = 0, size = count * N;
+            for (int i = 0; i < size; i += N)
+                Base::CopyPixel<N>(bs, dst + i);
+        }
+
+        template<> SIMD_INLINE void FillBorder<3>(uint8_t* dst, int count, const uint8_t* bs)
+        {
+            int i = 0, size = count * 3, size3 = size - 3;
+            for (; i < size3; i += 3)
+                Base::CopyPixel<4>(bs, dst + i);
+            for (; i < size; i += 3)
+                Base::CopyPixel<3>(bs, dst + i);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         template<int N> SIMD_INLINE uint32_t NearestOffset(int x, int y, const float* m, int w, int h, int s)
         {
             float sx = (float)x, sy = (float)y;
@@ -129,11 +150,615 @@ namespace Simd
                 Base::CopyPixel<N * 2>(src1 + offs, dst1);
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> SIMD_INLINE void RemapSaveEdge(const RemapEdge* beg, const RemapEdge* end, const uint8_t* dst, uint8_t* buf)
+        {
+            for (const RemapEdge* e = beg; e < end; ++e, buf += N)
+                Base::CopyPixel<N>(dst + e->x * N, buf);
+        }
+
+        template<int N> SIMD_INLINE void RemapNearestEdge(const RemapParam& p, const RemapEdge* beg, const RemapEdge* end, const uint8_t* buf, uint8_t* dst)
+        {
+            bool fill = p.NeedFill();
+            for (const RemapEdge* e = beg; e < end; ++e, buf += N)
+                Base::CopyPixel<N>(fill ? p.border : buf, dst + e->x * N);
+        }
+
+        template<int N> SIMD_INLINE void ByteBilinearRemapEdge(const RemapParam& p, const RemapEdge* beg, const RemapEdge* end, 
+            const uint8_t* fx, const uint16_t* fy, const uint8_t* src, const uint8_t* buf, uint8_t* dst)
+        {
+            bool fill = p.NeedFill();
+            int w = (int)p.srcW, h = (int)p.srcH, s = (int)p.srcS;
+            for (const RemapEdge* e = beg; e < end; ++e, buf += N)
+            {
+                const uint8_t* brd = fill ? p.border : buf;
+                int ix = e->ix, iy = e->iy;
+                bool x0 = ix >= 0 && ix < w, x1 = ix + 1 >= 0 && ix + 1 < w;
+                bool y0 = iy >= 0 && iy < h, y1 = iy + 1 >= 0 && iy + 1 < h;
+                const uint8_t* s00 = y0 && x0 ? src + iy * s + ix * N : brd;
+                const uint8_t* s01 = y0 && x1 ? src + iy * s + ix * N + N : brd;
+                const uint8_t* s10 = y1 && x0 ? src + iy * s + s + ix * N : brd;
+                const uint8_t* s11 = y1 && x1 ? src + iy * s + s + ix * N + N : brd;
+                const uint8_t* _fx = fx + 2 * e->x;
+                const uint16_t* _fy = fy + 2 * e->x;
+                int f00 = _fy[0] * _fx[0];
+                int f01 = _fy[0] * _fx[1];
+                int f10 = _fy[1] * _fx[0];
+                int f11 = _fy[1] * _fx[1];
+                uint8_t* d = dst + e->x * N;
+                for (int c = 0; c < N; c++)
+                    d[c] = (s00[c] * f00 + s01[c] * f01 + s10[c] * f10 + s11[c] * f11 + WA_BILINEAR_ROUND_TERM) >> WA_BILINEAR_SHIFT;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> SIMD_INLINE void FloatBilinearInterpMain(const float* src0, const float* src1, float fx, float fy, float* dst)
+        {
+            float f00 = (1.0f - fy) * (1.0f - fx);
+            float f01 = (1.0f - fy) * fx;
+            float f10 = fy * (1.0f - fx);
+            float f11 = fy * fx;
+            for (int c = 0; c < N; c++)
+                dst[c] = src0[c] * f00 + src0[c + N] * f01 + src1[c] * f10 + src1[c + N] * f11;
+        }
+
+        template<int N> SIMD_INLINE void FloatBilinearRemapEdge(const RemapParam& p, const RemapEdge* beg, const RemapEdge* end,
+            const float* wx, const float* wy, const uint8_t* src, const uint8_t* buf, uint8_t* dst)
+        {
+            bool fill = p.NeedFill();
+            int w = (int)p.srcW, h = (int)p.srcH, s = (int)p.srcS, n = N * 4;
+            for (const RemapEdge* e = beg; e < end; ++e, buf += n)
+            {
+                const float* brd = (float*)(fill ? p.border : buf);
+                int ix = e->ix, iy = e->iy;
+                bool x0 = ix >= 0 && ix < w, x1 = ix + 1 >= 0 && ix + 1 < w;
+                bool y0 = iy >= 0 && iy < h, y1 = iy + 1 >= 0 && iy + 1 < h;
+                const float* s00 = y0 && x0 ? (float*)(src + iy * s + ix * n) : brd;
+                const float* s01 = y0 && x1 ? (float*)(src + iy * s + ix * n + n) : brd;
+                const float* s10 = y1 && x0 ? (float*)(src + iy * s + s + ix * n) : brd;
+                const float* s11 = y1 && x1 ? (float*)(src + iy * s + s + ix * n + n) : brd;
+                float fx = wx[e->x], fy = wy[e->x];
+                float f00 = (1.0f - fy) * (1.0f - fx);
+                float f01 = (1.0f - fy) * fx;
+                float f10 = fy * (1.0f - fx);
+                float f11 = fy * fx;
+                float* d = (float*)dst + e->x * N;
+                for (int c = 0; c < N; c++)
+                    d[c] = s00[c] * f00 + s01[c] * f01 + s10[c] * f10 + s11[c] * f11;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<class T> SIMD_INLINE T FloatToChannel(float value);
+
+        template<> SIMD_INLINE uint16_t FloatToChannel<uint16_t>(float value)
+        {
+            return (uint16_t)Round(value);
+        }
+
+        template<> SIMD_INLINE float FloatToChannel<float>(float value)
+        {
+            return value;
+        }
+
+        SIMD_INLINE void BilinearPrepMain(int x, int y, const float* m, int n, int s, uint32_t* offs, float* wx, float* wy)
+        {
+            float sx = (float)x, sy = (float)y;
+            float dx = sx * m[0] + sy * m[1] + m[2];
+            float dy = sx * m[3] + sy * m[4] + m[5];
+            float ix = floor(dx);
+            float iy = floor(dy);
+            *offs = (int)iy * s + (int)ix * n;
+            *wx = dx - ix;
+            *wy = dy - iy;
+        }
+
+        template<class T, int N> SIMD_INLINE void BilinearInterpMain(const uint8_t* src, int s, uint32_t offs, float fx, float fy, T* dst)
+        {
+            const T* src0 = (T*)(src + offs);
+            const T* src1 = (T*)(src + offs + s);
+            float f00 = (1.0f - fy) * (1.0f - fx);
+            float f01 = (1.0f - fy) * fx;
+            float f10 = fy * (1.0f - fx);
+            float f11 = fy * fx;
+            for (int c = 0; c < N; c++)
+                dst[c] = FloatToChannel<T>(float(src0[c]) * f00 + float(src0[c + N]) * f01 + float(src1[c]) * f10 + float(src1[c + N]) * f11);
+        }
+
+        template<class T, int N> SIMD_INLINE void BilinearInterpEdge(int x, int y, const float* m, int w, int h, int s, const uint8_t* src, const T* brd, T* dst)
+        {
+            float sx = (float)x, sy = (float)y;
+            float dx = sx * m[0] + sy * m[1] + m[2];
+            float dy = sx * m[3] + sy * m[4] + m[5];
+            int ix = (int)floor(dx);
+            int iy = (int)floor(dy);
+            float fx = dx - ix;
+            float fy = dy - iy;
+            float f00 = (1.0f - fy) * (1.0f - fx);
+            float f01 = (1.0f - fy) * fx;
+            float f10 = fy * (1.0f - fx);
+            float f11 = fy * fx;
+            bool x0 = ix < 0, x1 = ix > w;
+            bool y0 = iy < 0, y1 = iy > h;
+            src += iy * s + ix * N * sizeof(T);
+            const T* s00 = y0 || x0 ? brd : (T*)src;
+            const T* s01 = y0 || x1 ? brd : (T*)src + N;
+            const T* s10 = y1 || x0 ? brd : (T*)(src + s);
+            const T* s11 = y1 || x1 ? brd : (T*)(src + s) + N;
+            for (int c = 0; c < N; c++)
+                dst[c] = FloatToChannel<T>(float(s00[c]) * f00 + float(s01[c]) * f01 + float(s10[c]) * f10 + float(s11[c]) * f11);
+        }
     }
 
 #ifdef SIMD_SSE41_ENABLE
     namespace Sse41
     {
+        const __m128i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
+
+        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst);
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            __m128i fx0 = _mm_loadu_si128((__m128i*)fx + 0);
+            __m128i fx1 = _mm_loadu_si128((__m128i*)fx + 1);
+            __m128i r00 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src0 + 0), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src0 + 1), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src1 + 0), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src1 + 1), fx1);
+
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), _mm_loadu_si128((__m128i*)fy + 0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), _mm_loadu_si128((__m128i*)fy + 1));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), _mm_loadu_si128((__m128i*)fy + 2));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), _mm_loadu_si128((__m128i*)fy + 3));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
+
+            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
+            __m128i fx0 = UnpackU16<0>(_fx, _fx);
+            __m128i fx1 = UnpackU16<1>(_fx, _fx);
+            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SHUFFLE), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SHUFFLE), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SHUFFLE), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SHUFFLE), fx1);
+
+            __m128i fy0 = _mm_loadu_si128((__m128i*)fy + 0);
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i fy1 = _mm_loadu_si128((__m128i*)fy + 1);
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m128i SRC_SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
+            static const __m128i DST_SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+
+            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m128i fx0 = UnpackU16<0>(_fx, _fx);
+            __m128i fx1 = UnpackU16<1>(_fx, _fx);
+            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SRC_SHUFFLE), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SRC_SHUFFLE), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SRC_SHUFFLE), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SRC_SHUFFLE), fx1);
+
+            __m128i _fy = _mm_loadu_si128((__m128i*)fy);
+            __m128i fy0 = UnpackU32<0>(_fy, _fy);
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i fy1 = UnpackU32<1>(_fy, _fy);
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            Store12(dst, _mm_shuffle_epi8(_mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)), DST_SHUFFLE));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
+
+            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m128i fx0 = UnpackU16<0>(_fx, _fx);
+            __m128i fx1 = UnpackU16<1>(_fx, _fx);
+            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SHUFFLE), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SHUFFLE), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SHUFFLE), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SHUFFLE), fx1);
+
+            __m128i _fy = _mm_loadu_si128((__m128i*)fy);
+            __m128i fy0 = UnpackU32<0>(_fy, _fy);
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i fy1 = UnpackU32<1>(_fy, _fy);
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> void FloatBilinearRow(const uint8_t* src, int s, const uint32_t* offs, const float* wx, const float* wy, int width, float* dst);
+
+        template<> SIMD_INLINE void FloatBilinearRow<1>(const uint8_t* src, int s, const uint32_t* offs, const float* wx, const float* wy, int width, float* dst)
+        {
+            __m128 _1 = _mm_set1_ps(1.0f);
+            int width4 = (int)AlignLo(width, 4), x = 0;
+            for (; x < width4; x += 4)
+            {
+                const uint8_t* p0 = src + offs[x + 0], * p1 = src + offs[x + 1], * p2 = src + offs[x + 2], * p3 = src + offs[x + 3];
+                __m128 r01 = _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd((double*)p0)), _mm_castpd_ps(_mm_load_sd((double*)p1)));
+                __m128 r23 = _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd((double*)p2)), _mm_castpd_ps(_mm_load_sd((double*)p3)));
+                __m128 s00 = _mm_shuffle_ps(r01, r23, 0x88);
+                __m128 s01 = _mm_shuffle_ps(r01, r23, 0xDD);
+                r01 = _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd((double*)(p0 + s))), _mm_castpd_ps(_mm_load_sd((double*)(p1 + s))));
+                r23 = _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd((double*)(p2 + s))), _mm_castpd_ps(_mm_load_sd((double*)(p3 + s))));
+                __m128 s10 = _mm_shuffle_ps(r01, r23, 0x88);
+                __m128 s11 = _mm_shuffle_ps(r01, r23, 0xDD);
+                __m128 fx1 = _mm_loadu_ps(wx + x), fx0 = _mm_sub_ps(_1, fx1);
+                __m128 fy1 = _mm_loadu_ps(wy + x), fy0 = _mm_sub_ps(_1, fy1);
+                __m128 d0 = _mm_add_ps(_mm_mul_ps(s00, fx0), _mm_mul_ps(s01, fx1));
+                __m128 d1 = _mm_add_ps(_mm_mul_ps(s10, fx0), _mm_mul_ps(s11, fx1));
+                _mm_storeu_ps(dst + x, _mm_add_ps(_mm_mul_ps(d0, fy0), _mm_mul_ps(d1, fy1)));
+            }
+            for (; x < width; ++x)
+            {
+                const uint8_t* src0 = src + offs[x];
+                Base::FloatBilinearInterpMain<1>((float*)src0, (float*)(src0 + s), wx[x], wy[x], dst + x);
+            }
+        }
+
+        template<> SIMD_INLINE void FloatBilinearRow<2>(const uint8_t* src, int s, const uint32_t* offs, const float* wx, const float* wy, int width, float* dst)
+        {
+            __m128 _1 = _mm_set1_ps(1.0f);
+            for (int x = 0; x < width; ++x, dst += 2)
+            {
+                const double* src0 = (double*)(src + offs[x]);
+                const double* src1 = (double*)(src + offs[x] + s);
+                __m128 fx1 = _mm_set1_ps(wx[x]), fx0 = _mm_sub_ps(_1, fx1);
+                __m128 fy1 = _mm_set1_ps(wy[x]), fy0 = _mm_sub_ps(_1, fy1);
+                __m128 d0 = _mm_add_ps(_mm_mul_ps(_mm_castpd_ps(_mm_load_sd(src0 + 0)), fx0), _mm_mul_ps(_mm_castpd_ps(_mm_load_sd(src0 + 1)), fx1));
+                __m128 d1 = _mm_add_ps(_mm_mul_ps(_mm_castpd_ps(_mm_load_sd(src1 + 0)), fx0), _mm_mul_ps(_mm_castpd_ps(_mm_load_sd(src1 + 1)), fx1));
+                _mm_storel_pi((__m64*)dst, _mm_add_ps(_mm_mul_ps(d0, fy0), _mm_mul_ps(d1, fy1)));
+            }
+        }
+
+        template<> SIMD_INLINE void FloatBilinearRow<3>(const uint8_t* src, int s, const uint32_t* offs, const float* wx, const float* wy, int width, float* dst)
+        {
+            __m128 _1 = _mm_set1_ps(1.0f);
+            for (int x = 0; x < width; ++x, dst += 3)
+            {
+                const float* src0 = (float*)(src + offs[x]);
+                const float* src1 = (float*)(src + offs[x] + s);
+                __m128 fx1 = _mm_set1_ps(wx[x]), fx0 = _mm_sub_ps(_1, fx1);
+                __m128 fy1 = _mm_set1_ps(wy[x]), fy0 = _mm_sub_ps(_1, fy1);
+                __m128 s01 = _mm_loadu_ps(src0 + 2), s11 = _mm_loadu_ps(src1 + 2);
+                __m128 d0 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src0), fx0), _mm_mul_ps(_mm_shuffle_ps(s01, s01, 0xF9), fx1));
+                __m128 d1 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src1), fx0), _mm_mul_ps(_mm_shuffle_ps(s11, s11, 0xF9), fx1));
+                __m128 d = _mm_add_ps(_mm_mul_ps(d0, fy0), _mm_mul_ps(d1, fy1));
+                _mm_storel_pi((__m64*)dst, d);
+                _mm_store_ss(dst + 2, _mm_movehl_ps(d, d));
+            }
+        }
+
+        template<> SIMD_INLINE void FloatBilinearRow<4>(const uint8_t* src, int s, const uint32_t* offs, const float* wx, const float* wy, int width, float* dst)
+        {
+            __m128 _1 = _mm_set1_ps(1.0f);
+            for (int x = 0; x < width; ++x, dst += 4)
+            {
+                const float* src0 = (float*)(src + offs[x]);
+                const float* src1 = (float*)(src + offs[x] + s);
+                __m128 fx1 = _mm_set1_ps(wx[x]), fx0 = _mm_sub_ps(_1, fx1);
+                __m128 fy1 = _mm_set1_ps(wy[x]), fy0 = _mm_sub_ps(_1, fy1);
+                __m128 d0 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src0 + 0), fx0), _mm_mul_ps(_mm_loadu_ps(src0 + 4), fx1));
+                __m128 d1 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src1 + 0), fx0), _mm_mul_ps(_mm_loadu_ps(src1 + 4), fx1));
+                _mm_storeu_ps(dst, _mm_add_ps(_mm_mul_ps(d0, fy0), _mm_mul_ps(d1, fy1)));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> SIMD_INLINE void ShortBilinearLoad(const uint8_t* src, __m128& s0, __m128& s1);
+
+        template<> SIMD_INLINE void ShortBilinearLoad<2>(const uint8_t* src, __m128& s0, __m128& s1)
+        {
+            s0 = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i*)src)));
+            s1 = _mm_movehl_ps(s0, s0);
+        }
+
+        template<> SIMD_INLINE void ShortBilinearLoad<3>(const uint8_t* src, __m128& s0, __m128& s1)
+        {
+            s0 = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i*)src)));
+            s1 = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_srli_si128(_mm_loadl_epi64((__m128i*)(src + 4)), 2)));
+        }
+
+        template<> SIMD_INLINE void ShortBilinearLoad<4>(const uint8_t* src, __m128& s0, __m128& s1)
+        {
+            __m128i _src = _mm_loadu_si128((__m128i*)src);
+            s0 = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_src));
+            s1 = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_srli_si128(_src, 8)));
+        }
+
+        template<int N> SIMD_INLINE void ShortBilinearStore(__m128i value, uint16_t* dst);
+
+        template<> SIMD_INLINE void ShortBilinearStore<2>(__m128i value, uint16_t* dst)
+        {
+            *(int32_t*)dst = _mm_cvtsi128_si32(value);
+        }
+
+        template<> SIMD_INLINE void ShortBilinearStore<3>(__m128i value, uint16_t* dst)
+        {
+            *(int32_t*)dst = _mm_cvtsi128_si32(value);
+            dst[2] = (uint16_t)_mm_extract_epi16(value, 2);
+        }
+
+        template<> SIMD_INLINE void ShortBilinearStore<4>(__m128i value, uint16_t* dst)
+        {
+            _mm_storel_epi64((__m128i*)dst, value);
+        }
+
+        template<int N> SIMD_INLINE void ShortBilinearRow(const uint8_t* src, int s, const uint32_t* offs, const float* wx, const float* wy, int width, uint16_t* dst)
+        {
+            __m128 _1 = _mm_set1_ps(1.0f), s00, s01, s10, s11;
+            for (int x = 0; x < width; ++x, dst += N)
+            {
+                ShortBilinearLoad<N>(src + offs[x], s00, s01);
+                ShortBilinearLoad<N>(src + offs[x] + s, s10, s11);
+                __m128 fx1 = _mm_set1_ps(wx[x]), fx0 = _mm_sub_ps(_1, fx1);
+                __m128 fy1 = _mm_set1_ps(wy[x]), fy0 = _mm_sub_ps(_1, fy1);
+                __m128 d0 = _mm_add_ps(_mm_mul_ps(s00, fx0), _mm_mul_ps(s01, fx1));
+                __m128 d1 = _mm_add_ps(_mm_mul_ps(s10, fx0), _mm_mul_ps(s11, fx1));
+                __m128i d = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(d0, fy0), _mm_mul_ps(d1, fy1)));
+                ShortBilinearStore<N>(_mm_packus_epi32(d, d), dst);
+            }
+        }
+
+        template<> SIMD_INLINE void ShortBilinearRow<1>(const uint8_t* src, int s, const uint32_t* offs, const float* wx, const float* wy, int width, uint16_t* dst)
+        {
+            __m128 _1 = _mm_set1_ps(1.0f);
+            int width4 = (int)AlignLo(width, 4), x = 0;
+            for (; x < width4; x += 4)
+            {
+                const uint8_t* p0 = src + offs[x + 0], * p1 = src + offs[x + 1], * p2 = src + offs[x + 2], * p3 = src + offs[x + 3];
+                __m128i r0 = _mm_setr_epi32(*(int32_t*)p0, *(int32_t*)p1, *(int32_t*)p2, *(int32_t*)p3);
+                __m128i r1 = _mm_setr_epi32(*(int32_t*)(p0 + s), *(int32_t*)(p1 + s), *(int32_t*)(p2 + s), *(int32_t*)(p3 + s));
+                __m128 fx1 = _mm_loadu_ps(wx + x), fx0 = _mm_sub_ps(_1, fx1);
+                __m128 fy1 = _mm_loadu_ps(wy + x), fy0 = _mm_sub_ps(_1, fy1);
+                __m128 d0 = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(r0, K32_0000FFFF)), fx0), _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(r0, 16)), fx1));
+                __m128 d1 = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(r1, K32_0000FFFF)), fx0), _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(r1, 16)), fx1));
+                __m128i d = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(d0, fy0), _mm_mul_ps(d1, fy1)));
+                _mm_storel_epi64((__m128i*)(dst + x), _mm_packus_epi32(d, d));
+            }
+            for (; x < width; ++x)
+                Base::BilinearInterpMain<uint16_t, 1>(src, s, offs[x], wx[x], wy[x], dst + x);
+        }
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        const __m256i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM256_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
+
+        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst);
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            __m256i fx0 = _mm256_loadu_si256((__m256i*)fx + 0);
+            __m256i fx1 = _mm256_loadu_si256((__m256i*)fx + 1);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src0 + 0), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src0 + 1), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src1 + 0), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src1 + 1), fx1);
+
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), Load<false>((__m128i*)fy + 0, (__m128i*)fy + 2));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), Load<false>((__m128i*)fy + 1, (__m128i*)fy + 3));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), Load<false>((__m128i*)fy + 4, (__m128i*)fy + 6));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), Load<false>((__m128i*)fy + 5, (__m128i*)fy + 7));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
+
+            __m256i _fx = LoadPermuted<false>((__m256i*)fx);
+            __m256i fx0 = UnpackU16<0>(_fx, _fx);
+            __m256i fx1 = UnpackU16<1>(_fx, _fx);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SHUFFLE), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SHUFFLE), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SHUFFLE), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SHUFFLE), fx1);
+
+            __m256i fy0 = _mm256_loadu_si256((__m256i*)fy + 0);
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i fy1 = _mm256_loadu_si256((__m256i*)fy + 1);
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m256i SRC_SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
+            static const __m256i DST_SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+            static const __m256i DST_PERMUTE = SIMD_MM256_SETR_EPI32(0, 1, 2, 4, 5, 6, 0, 0);
+
+            __m256i _fx = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i*)fx), K32_TWO_UNPACK_PERMUTE);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m256i fx0 = UnpackU16<0>(_fx, _fx);
+            __m256i fx1 = UnpackU16<1>(_fx, _fx);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SRC_SHUFFLE), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SRC_SHUFFLE), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SRC_SHUFFLE), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SRC_SHUFFLE), fx1);
+
+            __m256i _fy = LoadPermuted<false>((__m256i*)fy);
+            __m256i fy0 = UnpackU32<0>(_fy, _fy);
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i fy1 = UnpackU32<1>(_fy, _fy);
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i _dst = PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3));
+            Store24<false>(dst, _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(_dst, DST_SHUFFLE), DST_PERMUTE));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
+
+            __m256i _fx = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i*)fx), K32_TWO_UNPACK_PERMUTE);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m256i fx0 = UnpackU16<0>(_fx, _fx);
+            __m256i fx1 = UnpackU16<1>(_fx, _fx);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SHUFFLE), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SHUFFLE), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SHUFFLE), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SHUFFLE), fx1);
+
+            __m256i _fy = LoadPermuted<false>((__m256i*)fy);
+            __m256i fy0 = UnpackU32<0>(_fy, _fy);
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i fy1 = UnpackU32<1>(_fy, _fy);
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> void FloatBilinearRow(const uint8_t* src, int s, const uint32_t* offs, const float* wx, const float* wy, int width, float* dst);
+
+        template<> SIMD_INLINE void FloatBilinearRow<1>(const uint8_t* src, int s, const uint32_t* offs, const float* wx, const float* wy, int width, float* dst)
+        {
+            __m256 _1 = _mm256_set1_ps(1.0f);
+            const float* src00 = (float*)src, * src01 = (float*)(src + 4);
+            const float* src10 = (float*)(src + s), * src11 = (float*)(src + s + 4);
+            int width8 = (int)AlignLo(width, 8), x = 0;
+            for (; x < width8; x += 8)
+            {
+                __m256i idx = _mm256_loadu_si256((__m256i*)(offs + x));
+                __m256 fx1 = _mm256_loadu_ps(wx + x), fx0 = _mm256_sub_ps(_1, fx1);
+                __m256 fy1 = _mm256_loadu_ps(wy + x), fy0 = _mm256_sub_ps(_1, fy1);
+                __m256 d0 = _mm256_fmadd_ps(_mm256_i32gather_ps(src01, idx, 1), fx1, _mm256_mul_ps(_mm256_i32gather_ps(src00, idx, 1), fx0));
+                __m256 d1 = _mm256_fmadd_ps(_mm256_i32gather_ps(src11, idx, 1), fx1, _mm256_mul_ps(_mm256_i32gather_ps(src10, idx, 1), fx0));
+                _mm256_storeu_ps(dst + x, _mm256_fmadd_ps(d1, fy1, _mm256_mul_ps(d0, fy0)));
+            }
+            for (; x < width; ++x)
+            {
+                const uint8_t* src0 = src + offs[x];
+                Base::FloatBilinearInterpMain<1>((float*)src0, (float*)(src0 + s), wx[x], wy[x], dst + x);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> void ShortBilinearRow(const uint8_t* src, int s, const uint32_t* offs, const float* wx, const float* wy, int width, uint16_t* dst);
+
+        template<> SIMD_INLINE void ShortBilinearRow<1>(const uint8_t* src, int s, const uint32_t* offs, const float* wx, const float* wy, int width, uint16_t* dst)
+        {
+            __m256 _1 = _mm256_set1_ps(1.0f);
+            const int* src0 = (int*)src, * src1 = (int*)(src + s);
+            int width8 = (int)AlignLo(width, 8), x = 0;
+            for (; x < width8; x += 8)
+            {
+                __m256i idx = _mm256_loadu_si256((__m256i*)(offs + x));
+                __m256i r0 = _mm256_i32gather_epi32(src0, idx, 1);
+                __m256i r1 = _mm256_i32gather_epi32(src1, idx, 1);
+                __m256 fx1 = _mm256_loadu_ps(wx + x), fx0 = _mm256_sub_ps(_1, fx1);
+                __m256 fy1 = _mm256_loadu_ps(wy + x), fy0 = _mm256_sub_ps(_1, fy1);
+                __m256 d0 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(r0, 16)), fx1, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(r0, K32_0000FFFF)), fx0));
+                __m256 d1 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(r1, 16)), fx1, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(r1, K32_0000FFFF)), fx0));
+                __m256i d = _mm256_cvtps_epi32(_mm256_fmadd_ps(d1, fy1, _mm256_mul_ps(d0, fy0)));
+                _mm_storeu_si128((__m128i*)(dst + x), _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi32(d, d), 0x08)));
+            }
+            for (; x < width; ++x)
+                Base::BilinearInterpMain<uint16_t, 1>(src, s, offs[x], wx[x], wy[x], dst + x);
+        }
     }
 #endif
 }
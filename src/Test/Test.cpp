@@ -174,6 +174,10 @@ namespace Test
     TEST_ADD_GROUP_A0(DetectionLbpDetect32fi);
     TEST_ADD_GROUP_A0(DetectionLbpDetect16ip);
     TEST_ADD_GROUP_A0(DetectionLbpDetect16ii);
+    TEST_ADD_GROUP_A0(DetectionDecodeSsd32f);
+    TEST_ADD_GROUP_A0(DetectionDecodeYolo32f);
+    TEST_ADD_GROUP_A0(DetectionFilterScores32f);
+    TEST_ADD_GROUP_A0(DetectionNms32f);
     TEST_ADD_GROUP_0S(Detection);
 
     TEST_ADD_GROUP_A0(AlphaBlending);
@@ -190,8 +194,10 @@ namespace Test
     TEST_ADD_GROUP_0S(DrawFilledPolygon);
     TEST_ADD_GROUP_0S(DrawEllipse);
     TEST_ADD_GROUP_0S(DrawCircle);
+    TEST_ADD_GROUP_0S(DrawOverlay);
 
     TEST_ADD_GROUP_0S(FontDraw);
+    TEST_ADD_GROUP_0S(FontDrawFrame);
 
     TEST_ADD_GROUP_A0(Fill);
     TEST_ADD_GROUP_A0(FillFrame);
@@ -225,10 +231,14 @@ namespace Test
     TEST_ADD_GROUP_A0(MedianFilterRhomb5x5);
     TEST_ADD_GROUP_A0(MedianFilterSquare3x3);
     TEST_ADD_GROUP_A0(MedianFilterSquare5x5);
+    TEST_ADD_GROUP_A0(MedianFilterSquare);
+    TEST_ADD_GROUP_A0(Morphology);
+    TEST_ADD_GROUP_A0(MorphologyBits);
     TEST_ADD_GROUP_A0(GaussianBlur3x3);
     TEST_ADD_GROUP_A0(AbsGradientSaturatedSum);
     TEST_ADD_GROUP_A0(LbpEstimate);
     TEST_ADD_GROUP_A0(NormalizeHistogram);
+    TEST_ADD_GROUP_A0(NormalizeHistogramAdaptive);
     TEST_ADD_GROUP_A0(SobelDx);
     TEST_ADD_GROUP_A0(SobelDxAbs);
     TEST_ADD_GROUP_A0(SobelDy);
@@ -301,6 +311,8 @@ namespace Test
     TEST_ADD_GROUP_A0(ReduceGray4x4);
     TEST_ADD_GROUP_A0(ReduceGray5x5);
 
+    TEST_ADD_GROUP_A0(Remap);
+
     TEST_ADD_GROUP_A0(Reorder16bit);
     TEST_ADD_GROUP_A0(Reorder32bit);
     TEST_ADD_GROUP_A0(Reorder64bit);
@@ -315,6 +327,7 @@ namespace Test
     TEST_ADD_GROUP_A0(SegmentationFillSingleHoles);
     TEST_ADD_GROUP_A0(SegmentationChangeIndex);
     TEST_ADD_GROUP_A0(SegmentationPropagate2x2);
+    TEST_ADD_GROUP_A0(ConnectedComponents);
 
     TEST_ADD_GROUP_A0(ShiftBilinear);
     TEST_ADD_GROUP_0S(ShiftDetectorRand);
@@ -372,6 +385,10 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetConvolution16bForward);
 
     TEST_ADD_GROUP_A0(SynetConvolution32fForward);
+    TEST_ADD_GROUP_0S(SynetWorkspace);
+    TEST_ADD_GROUP_0S(SynetWeightCache);
+    TEST_ADD_GROUP_0S(SynetConvolution32fReshape);
+    TEST_ADD_GROUP_0S(SynetConvolution16bAdd);
 
     TEST_ADD_GROUP_A0(SynetDeconvolution32fForward);
 
@@ -384,6 +401,7 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetInnerProduct8i);
 
     TEST_ADD_GROUP_A0(SynetInnerProduct16bForward);
+    TEST_ADD_GROUP_A0(SynetInnerProduct16bWqForward);
 
     TEST_ADD_GROUP_A0(SynetMergedConvolution8iForward);
 
@@ -418,6 +436,8 @@ namespace Test
 
     TEST_ADD_GROUP_A0(SynetQuantizedShuffleLayerForward);
 
+    TEST_ADD_GROUP_A0(SynetCalibration);
+
     TEST_ADD_GROUP_A0(SynetDequantizeLinear);
     TEST_ADD_GROUP_A0(SynetQuantizeLinear);
 
@@ -440,6 +460,8 @@ namespace Test
     TEST_ADD_GROUP_A0(Uyvy422ToBgr);
 
     TEST_ADD_GROUP_A0(WarpAffine);
+    TEST_ADD_GROUP_A0(WarpAffineBatch);
+    TEST_ADD_GROUP_A0(WarpPerspective);
 #ifdef SIMD_OPENCV_ENABLE
     TEST_ADD_GROUP_0S(WarpAffineOpenCv);
 #endif
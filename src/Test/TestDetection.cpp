@@ -436,6 +436,383 @@ namespace Test
 
 //-----------------------------------------------------------------------------
 
+namespace Test
+{
+    namespace
+    {
+        struct FuncSsd
+        {
+            typedef void(*FuncPtr)(const float* loc, const float* prior, const float* variance, size_t size, SimdBool clip, float* dst);
+
+            FuncPtr func;
+            String description;
+
+            FuncSsd(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const Buffer32f& loc, const Buffer32f& prior, const Buffer32f& variance, SimdBool clip, Buffer32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(loc.data(), prior.data(), variance.data(), loc.size() / 4, clip, dst.data());
+            }
+        };
+    }
+
+#define FUNC_SSD(function) FuncSsd(function, #function)
+
+    static void FillRandomBoxes(Buffer32f& boxes, float sizeMin, float sizeMax)
+    {
+        for (size_t i = 0; i < boxes.size(); i += 4)
+        {
+            float w = sizeMin + float(Random()) * (sizeMax - sizeMin);
+            float h = sizeMin + float(Random()) * (sizeMax - sizeMin);
+            boxes[i + 0] = float(Random()) * (1.0f - w);
+            boxes[i + 1] = float(Random()) * (1.0f - h);
+            boxes[i + 2] = boxes[i + 0] + w;
+            boxes[i + 3] = boxes[i + 1] + h;
+        }
+    }
+
+    bool DetectionDecodeSsd32fAutoTest(size_t size, SimdBool clip, const FuncSsd& f1, const FuncSsd& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << size << ", " << (clip ? "clip" : "") << "].");
+
+        Buffer32f loc(size * 4), prior(size * 4), variance(size * 4), dst1(size * 4, 0.0f), dst2(size * 4, 0.0f);
+        FillRandom(loc, -2.0f, 2.0f);
+        FillRandomBoxes(prior, 0.05f, 0.5f);
+        for (size_t i = 0; i < variance.size(); i += 4)
+        {
+            variance[i + 0] = 0.1f;
+            variance[i + 1] = 0.1f;
+            variance[i + 2] = 0.2f;
+            variance[i + 3] = 0.2f;
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(loc, prior, variance, clip, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(loc, prior, variance, clip, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool DetectionDecodeSsd32fAutoTest(const FuncSsd& f1, const FuncSsd& f2)
+    {
+        bool result = true;
+
+        result = result && DetectionDecodeSsd32fAutoTest(W * H / 16, SimdFalse, f1, f2);
+        result = result && DetectionDecodeSsd32fAutoTest(W * H / 16 + O, SimdTrue, f1, f2);
+
+        return result;
+    }
+
+    bool DetectionDecodeSsd32fAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && DetectionDecodeSsd32fAutoTest(FUNC_SSD(Simd::Base::DetectionDecodeSsd32f), FUNC_SSD(SimdDetectionDecodeSsd32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && DetectionDecodeSsd32fAutoTest(FUNC_SSD(Simd::Sse41::DetectionDecodeSsd32f), FUNC_SSD(SimdDetectionDecodeSsd32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && DetectionDecodeSsd32fAutoTest(FUNC_SSD(Simd::Avx2::DetectionDecodeSsd32f), FUNC_SSD(SimdDetectionDecodeSsd32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && DetectionDecodeSsd32fAutoTest(FUNC_SSD(Simd::Avx512bw::DetectionDecodeSsd32f), FUNC_SSD(SimdDetectionDecodeSsd32f));
+#endif
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncYolo
+        {
+            typedef size_t(*FuncPtr)(const float* src, size_t height, size_t width, size_t anchors, size_t classes, const float* anchorSizes,
+                float threshold, float* boxes, float* scores, uint32_t* labels, size_t capacity);
+
+            FuncPtr func;
+            String description;
+
+            FuncYolo(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const Buffer32f& src, size_t height, size_t width, size_t anchors, size_t classes, const Buffer32f& anchorSizes,
+                float threshold, Buffer32f& boxes, Buffer32f& scores, Sums& labels, size_t & count) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                count = func(src.data(), height, width, anchors, classes, anchorSizes.data(), threshold, boxes.data(), scores.data(), labels.data(), scores.size());
+            }
+        };
+    }
+
+#define FUNC_YOLO(function) FuncYolo(function, #function)
+
+    bool DetectionDecodeYolo32fAutoTest(size_t height, size_t width, size_t anchors, size_t classes, float threshold, const FuncYolo& f1, const FuncYolo& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << height << "x" << width << "x" << anchors << "x" << classes << "].");
+
+        size_t size = height * width * anchors, step = 5 + classes;
+        Buffer32f src(size * step), anchorSizes(anchors * 2);
+        FillRandom(src, -3.0f, 3.0f);
+        for (size_t i = 0; i < size; ++i)
+            src[i * step + 4] = float(Random()) * 8.0f - 7.0f;
+        FillRandom(anchorSizes, 0.05f, 0.5f);
+
+        Buffer32f boxes1(size * 4, 0.0f), boxes2(size * 4, 0.0f), scores1(size, 0.0f), scores2(size, 0.0f);
+        Sums labels1(size, 0), labels2(size, 0);
+        size_t count1 = 0, count2 = 0;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, height, width, anchors, classes, anchorSizes, threshold, boxes1, scores1, labels1, count1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, height, width, anchors, classes, anchorSizes, threshold, boxes2, scores2, labels2, count2));
+
+        if (count1 != count2)
+        {
+            TEST_LOG_SS(Error, "Different number of decoded boxes: " << count1 << " != " << count2 << " !");
+            return false;
+        }
+
+        result = result && Compare(labels1, labels2, 0, true, 32);
+        result = result && Compare(scores1, scores2, EPS, true, 32, DifferenceBoth, "scores");
+        result = result && Compare(boxes1, boxes2, EPS, true, 32, DifferenceBoth, "boxes");
+
+        return result;
+    }
+
+    bool DetectionDecodeYolo32fAutoTest(const FuncYolo& f1, const FuncYolo& f2)
+    {
+        bool result = true;
+
+        result = result && DetectionDecodeYolo32fAutoTest(13, 13, 3, 80, 0.3f, f1, f2);
+        result = result && DetectionDecodeYolo32fAutoTest(26, 26, 3, 20 + 1, 0.5f, f1, f2);
+        result = result && DetectionDecodeYolo32fAutoTest(20, 20, 1, 3, 0.2f, f1, f2);
+
+        return result;
+    }
+
+    bool DetectionDecodeYolo32fAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && DetectionDecodeYolo32fAutoTest(FUNC_YOLO(Simd::Base::DetectionDecodeYolo32f), FUNC_YOLO(SimdDetectionDecodeYolo32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && DetectionDecodeYolo32fAutoTest(FUNC_YOLO(Simd::Sse41::DetectionDecodeYolo32f), FUNC_YOLO(SimdDetectionDecodeYolo32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && DetectionDecodeYolo32fAutoTest(FUNC_YOLO(Simd::Avx2::DetectionDecodeYolo32f), FUNC_YOLO(SimdDetectionDecodeYolo32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && DetectionDecodeYolo32fAutoTest(FUNC_YOLO(Simd::Avx512bw::DetectionDecodeYolo32f), FUNC_YOLO(SimdDetectionDecodeYolo32f));
+#endif
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncFs
+        {
+            typedef size_t(*FuncPtr)(const float* scores, size_t size, float threshold, uint32_t* indices);
+
+            FuncPtr func;
+            String description;
+
+            FuncFs(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const Buffer32f& scores, float threshold, Sums& indices, size_t& count) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                count = func(scores.data(), scores.size(), threshold, indices.data());
+            }
+        };
+    }
+
+#define FUNC_FS(function) FuncFs(function, #function)
+
+    bool DetectionFilterScores32fAutoTest(size_t size, float threshold, const FuncFs& f1, const FuncFs& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << size << ", " << threshold << "].");
+
+        Buffer32f scores(size);
+        FillRandom(scores, 0.0f, 1.0f);
+
+        Sums indices1(size, 0), indices2(size, 0);
+        size_t count1 = 0, count2 = 0;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(scores, threshold, indices1, count1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(scores, threshold, indices2, count2));
+
+        if (count1 != count2)
+        {
+            TEST_LOG_SS(Error, "Different number of filtered scores: " << count1 << " != " << count2 << " !");
+            return false;
+        }
+
+        result = result && Compare(indices1, indices2, 0, true, 32);
+
+        return result;
+    }
+
+    bool DetectionFilterScores32fAutoTest(const FuncFs& f1, const FuncFs& f2)
+    {
+        bool result = true;
+
+        result = result && DetectionFilterScores32fAutoTest(W * H, 0.9f, f1, f2);
+        result = result && DetectionFilterScores32fAutoTest(W * H + O, 0.1f, f1, f2);
+
+        return result;
+    }
+
+    bool DetectionFilterScores32fAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && DetectionFilterScores32fAutoTest(FUNC_FS(Simd::Base::DetectionFilterScores32f), FUNC_FS(SimdDetectionFilterScores32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && DetectionFilterScores32fAutoTest(FUNC_FS(Simd::Sse41::DetectionFilterScores32f), FUNC_FS(SimdDetectionFilterScores32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && DetectionFilterScores32fAutoTest(FUNC_FS(Simd::Avx2::DetectionFilterScores32f), FUNC_FS(SimdDetectionFilterScores32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && DetectionFilterScores32fAutoTest(FUNC_FS(Simd::Avx512bw::DetectionFilterScores32f), FUNC_FS(SimdDetectionFilterScores32f));
+#endif
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncNms
+        {
+            typedef size_t(*FuncPtr)(const float* boxes, const float* scores, const uint32_t* labels, size_t size, float iouThreshold, float sigma,
+                float scoreThreshold, uint32_t* indices, float* keepScores);
+
+            FuncPtr func;
+            String description;
+
+            FuncNms(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const Buffer32f& boxes, const Buffer32f& scores, const Sums & labels, float iouThreshold, float sigma,
+                float scoreThreshold, Sums& indices, Buffer32f& keepScores, size_t& count) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                count = func(boxes.data(), scores.data(), labels.empty() ? NULL : labels.data(), scores.size(), 
+                    iouThreshold, sigma, scoreThreshold, indices.data(), keepScores.data());
+            }
+        };
+    }
+
+#define FUNC_NMS(function) FuncNms(function, #function)
+
+    bool DetectionNms32fAutoTest(size_t size, size_t classes, float iouThreshold, float sigma, const FuncNms& f1, const FuncNms& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << size << ", " << classes << ", " << iouThreshold << ", " << sigma << "].");
+
+        Buffer32f boxes(size * 4), scores(size);
+        FillRandomBoxes(boxes, 0.02f, 0.2f);
+        FillRandom(scores, 0.0f, 1.0f);
+        Sums labels(classes ? size : 0);
+        for (size_t i = 0; i < labels.size(); ++i)
+            labels[i] = Random(int(classes));
+        float scoreThreshold = 0.05f;
+
+        Sums indices1(size, 0), indices2(size, 0);
+        Buffer32f keepScores1(size, 0.0f), keepScores2(size, 0.0f);
+        size_t count1 = 0, count2 = 0;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(boxes, scores, labels, iouThreshold, sigma, scoreThreshold, indices1, keepScores1, count1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(boxes, scores, labels, iouThreshold, sigma, scoreThreshold, indices2, keepScores2, count2));
+
+        if (count1 != count2)
+        {
+            TEST_LOG_SS(Error, "Different number of kept boxes: " << count1 << " != " << count2 << " !");
+            return false;
+        }
+
+        result = result && Compare(indices1, indices2, 0, true, 32);
+        result = result && Compare(keepScores1, keepScores2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool DetectionNms32fAutoTest(const FuncNms& f1, const FuncNms& f2)
+    {
+        bool result = true;
+
+        result = result && DetectionNms32fAutoTest(2000, 0, 0.5f, 0.0f, f1, f2);
+        result = result && DetectionNms32fAutoTest(2000 + O, 10, 0.3f, 0.0f, f1, f2);
+        result = result && DetectionNms32fAutoTest(1000 + O, 0, 0.5f, 0.5f, f1, f2);
+        result = result && DetectionNms32fAutoTest(1000, 5, 0.5f, 0.5f, f1, f2);
+
+        return result;
+    }
+
+    bool DetectionNms32fAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && DetectionNms32fAutoTest(FUNC_NMS(Simd::Base::DetectionNms32f), FUNC_NMS(SimdDetectionNms32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && DetectionNms32fAutoTest(FUNC_NMS(Simd::Sse41::DetectionNms32f), FUNC_NMS(SimdDetectionNms32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && DetectionNms32fAutoTest(FUNC_NMS(Simd::Avx2::DetectionNms32f), FUNC_NMS(SimdDetectionNms32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && DetectionNms32fAutoTest(FUNC_NMS(Simd::Avx512bw::DetectionNms32f), FUNC_NMS(SimdDetectionNms32f));
+#endif
+
+        return result;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 #ifdef TEST_PERFORMANCE_TEST_ENABLE
 #define SIMD_CHECK_PERFORMANCE() TEST_PERFORMANCE_TEST_(__FUNCTION__)
 #endif
@@ -631,6 +631,7 @@ namespace Test
 //-----------------------------------------------------------------------------
 
 #include "Simd/SimdDrawing.hpp"
+#include "Simd/SimdOverlay.hpp"
 
 namespace Test
 {
@@ -803,4 +804,66 @@ namespace Test
 
         return true;
     }
+
+    bool DrawOverlaySpecialTest(const Options & options)
+    {
+        typedef Simd::Pixel::Bgr24 Color;
+
+        const size_t width = 3840, height = 2160, n = 300;
+        View canvas(width, height, View::Bgr24), control(width, height, View::Bgr24);
+        FillRandom(canvas);
+        Simd::Copy(canvas, control);
+
+        std::vector<Rect> boxes(n);
+        std::vector<Color> colors(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            ptrdiff_t x = Random(width + 100) - 50, y = Random(height + 100) - 50;
+            boxes[i] = Rect(x, y, x + Random(300) + 10, y + Random(300) + 10);
+            colors[i] = Color(Random(256), Random(256), Random(256));
+        }
+
+        Simd::Overlay overlay;
+        for (size_t i = 0; i < n; ++i)
+        {
+            overlay.DrawFilledRectangle(boxes[i], colors[i]);
+            overlay.DrawLine(boxes[i].TopLeft(), boxes[i].BottomRight(), colors[n - 1 - i], 3);
+        }
+        overlay.Render(canvas);
+        for (size_t i = 0; i < n; ++i)
+        {
+            Simd::DrawFilledRectangle(control, boxes[i], colors[i]);
+            Simd::DrawLine(control, boxes[i].TopLeft(), boxes[i].BottomRight(), colors[n - 1 - i], 3);
+        }
+        if (!Compare(canvas, control, 0, true, 64))
+            return false;
+
+        Simd::Font font(24);
+        overlay.Clear();
+        for (size_t i = 0; i < n; ++i)
+        {
+            String label = "object " + ToString(i);
+            overlay.DrawRectangle(boxes[i], colors[i], 2);
+            overlay.DrawText(font, label, boxes[i].TopLeft() - Point(0, font.Height()), colors[i]);
+        }
+        double start = GetTime();
+        overlay.Render(canvas);
+        double overlayTime = GetTime() - start;
+
+        start = GetTime();
+        for (size_t i = 0; i < n; ++i)
+        {
+            String label = "object " + ToString(i);
+            Simd::DrawRectangle(control, boxes[i], colors[i], 2);
+            font.Draw(control, label, boxes[i].TopLeft() - Point(0, font.Height()), colors[i]);
+        }
+        double drawTime = GetTime() - start;
+
+        TEST_LOG_SS(Info, "Annotation of " << n << " objects at " << width << "x" << height << " image: Simd::Overlay - "
+            << std::setprecision(3) << std::fixed << overlayTime * 1000.0 << " ms, per object drawing - " << drawTime * 1000.0 << " ms.");
+
+        canvas.Save("overlay.ppm");
+
+        return true;
+    }
 }
@@ -293,6 +293,217 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncMS
+        {
+            typedef void(*FuncPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t* dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncMS(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(View::Format format, size_t radius)
+            {
+                description = description + "[" + ToString(radius) + "]" + ColorDescription(format);
+            }
+
+            void Call(const View& src, size_t radius, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, View::PixelSize(src.format), radius, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_MS(function) FuncMS(function, #function)
+
+    bool MedianFilterSquareAutoTest(View::Format format, int width, int height, size_t radius, FuncMS f1, FuncMS f2)
+    {
+        bool result = true;
+
+        f1.Update(format, radius);
+        f2.Update(format, radius);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width, height, format, NULL, TEST_ALIGN(width));
+        View d2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, radius, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, radius, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        if (radius <= 2)
+        {
+            FuncC f3 = radius == 1 ? FUNC_C(SimdMedianFilterSquare3x3) : FUNC_C(SimdMedianFilterSquare5x5);
+            f3.description += ColorDescription(format);
+
+            View d3(width, height, format, NULL, TEST_ALIGN(width));
+
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f3.Call(s, d3));
+
+            result = result && Compare(d2, d3, 0, true, 64);
+        }
+
+        return result;
+    }
+
+    bool MedianFilterSquareAutoTest(const FuncMS& f1, const FuncMS& f2)
+    {
+        bool result = true;
+
+        for (View::Format format = View::Gray8; format <= View::Bgra32; format = View::Format(format + 1))
+        {
+            result = result && MedianFilterSquareAutoTest(format, W, H, 1, f1, f2);
+            result = result && MedianFilterSquareAutoTest(format, W, H, 2, f1, f2);
+            result = result && MedianFilterSquareAutoTest(format, W, H, 3, f1, f2);
+            result = result && MedianFilterSquareAutoTest(format, W, H, 7, f1, f2);
+            result = result && MedianFilterSquareAutoTest(format, W + O, H - O, 5, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool MedianFilterSquareAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && MedianFilterSquareAutoTest(FUNC_MS(Simd::Base::MedianFilterSquare), FUNC_MS(SimdMedianFilterSquare));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && MedianFilterSquareAutoTest(FUNC_MS(Simd::Sse41::MedianFilterSquare), FUNC_MS(SimdMedianFilterSquare));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && MedianFilterSquareAutoTest(FUNC_MS(Simd::Avx2::MedianFilterSquare), FUNC_MS(SimdMedianFilterSquare));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncMO
+        {
+            typedef void(*FuncPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+                SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, uint8_t* dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncMO(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY)
+            {
+                const char* types[] = { "Erode", "Dilate", "Open", "Close" };
+                const char* shapes[] = { "Rect", "Cross", "Ellipse" };
+                description = description + "[" + types[type] + "-" + shapes[shape] + "-" + ToString(kernelX) + "x" + ToString(kernelY) + "]";
+            }
+
+            void Call(const View& src, size_t width, SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, width, src.height, type, shape, kernelX, kernelY, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_MO(function) FuncMO(function, #function)
+
+    bool MorphologyAutoTest(int width, int height, bool bits, SimdMorphologyType type, SimdMorphologyShape shape, size_t kernelX, size_t kernelY, FuncMO f1, FuncMO f2)
+    {
+        bool result = true;
+
+        f1.Update(type, shape, kernelX, kernelY);
+        f2.Update(type, shape, kernelX, kernelY);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        size_t size = bits ? (width + 7) / 8 : width;
+        View s(size, height, View::Gray8, NULL, TEST_ALIGN(size));
+        FillRandom(s);
+
+        View d1(size, height, View::Gray8, NULL, TEST_ALIGN(size));
+        View d2(size, height, View::Gray8, NULL, TEST_ALIGN(size));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, width, type, shape, kernelX, kernelY, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, width, type, shape, kernelX, kernelY, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool MorphologyAutoTest(bool bits, const FuncMO& f1, const FuncMO& f2)
+    {
+        bool result = true;
+
+        int width = bits ? W * 8 + O : W, height = H;
+        for (int type = SimdMorphologyErode; type <= SimdMorphologyClose; ++type)
+        {
+            SimdMorphologyType t = (SimdMorphologyType)type;
+            result = result && MorphologyAutoTest(width, height, bits, t, SimdMorphologyRect, 3, 3, f1, f2);
+            result = result && MorphologyAutoTest(width, height, bits, t, SimdMorphologyCross, 5, 3, f1, f2);
+            result = result && MorphologyAutoTest(width, height, bits, t, SimdMorphologyEllipse, 7, 9, f1, f2);
+        }
+        result = result && MorphologyAutoTest(width, height, bits, SimdMorphologyErode, SimdMorphologyRect, 15, 15, f1, f2);
+        result = result && MorphologyAutoTest(width - O, height + O, bits, SimdMorphologyDilate, SimdMorphologyRect, 1, 8, f1, f2);
+        result = result && MorphologyAutoTest(width + O, height - O, bits, SimdMorphologyOpen, SimdMorphologyEllipse, 12, 5, f1, f2);
+
+        return result;
+    }
+
+    bool MorphologyAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && MorphologyAutoTest(false, FUNC_MO(Simd::Base::Morphology), FUNC_MO(SimdMorphology));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && MorphologyAutoTest(false, FUNC_MO(Simd::Sse41::Morphology), FUNC_MO(SimdMorphology));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && MorphologyAutoTest(false, FUNC_MO(Simd::Avx2::Morphology), FUNC_MO(SimdMorphology));
+#endif 
+
+        return result;
+    }
+
+    bool MorphologyBitsAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && MorphologyAutoTest(true, FUNC_MO(Simd::Base::MorphologyBits), FUNC_MO(SimdMorphologyBits));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && MorphologyAutoTest(true, FUNC_MO(Simd::Sse41::MorphologyBits), FUNC_MO(SimdMorphologyBits));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && MorphologyAutoTest(true, FUNC_MO(Simd::Avx2::MorphologyBits), FUNC_MO(SimdMorphologyBits));
+#endif 
+
+        return result;
+    }
+
     bool GaussianBlur3x3AutoTest(const Options & options)
     {
         bool result = true;
@@ -458,6 +669,89 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncNHA
+        {
+            typedef void(*FuncPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+                size_t tilesX, size_t tilesY, float clipLimit, uint8_t* dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncNHA(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t tilesX, size_t tilesY, float clipLimit)
+            {
+                description = description + "[" + ToString(tilesX) + "x" + ToString(tilesY) + "-" + ToString(double(clipLimit), 1, false) + "]";
+            }
+
+            void Call(const View& src, size_t tilesX, size_t tilesY, float clipLimit, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, tilesX, tilesY, clipLimit, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_NHA(function) FuncNHA(function, #function)
+
+    bool NormalizeHistogramAdaptiveAutoTest(int width, int height, size_t tilesX, size_t tilesY, float clipLimit, FuncNHA f1, FuncNHA f2)
+    {
+        bool result = true;
+
+        f1.Update(tilesX, tilesY, clipLimit);
+        f2.Update(tilesX, tilesY, clipLimit);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View s(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(s, 32, 160);
+
+        View d1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, tilesX, tilesY, clipLimit, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, tilesX, tilesY, clipLimit, d2));
+
+        result = result && Compare(d1, d2, 1, true, 64);
+
+        return result;
+    }
+
+    bool NormalizeHistogramAdaptiveAutoTest(const FuncNHA& f1, const FuncNHA& f2)
+    {
+        bool result = true;
+
+        result = result && NormalizeHistogramAdaptiveAutoTest(W, H, 8, 8, 2.0f, f1, f2);
+        result = result && NormalizeHistogramAdaptiveAutoTest(W, H, 4, 3, 0.0f, f1, f2);
+        result = result && NormalizeHistogramAdaptiveAutoTest(W + O, H - O, 7, 5, 4.0f, f1, f2);
+        result = result && NormalizeHistogramAdaptiveAutoTest(W - O, H + O, 1, 1, 1.5f, f1, f2);
+
+        return result;
+    }
+
+    bool NormalizeHistogramAdaptiveAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && NormalizeHistogramAdaptiveAutoTest(FUNC_NHA(Simd::Base::NormalizeHistogramAdaptive), FUNC_NHA(SimdNormalizeHistogramAdaptive));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && NormalizeHistogramAdaptiveAutoTest(FUNC_NHA(Simd::Sse41::NormalizeHistogramAdaptive), FUNC_NHA(SimdNormalizeHistogramAdaptive));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && NormalizeHistogramAdaptiveAutoTest(FUNC_NHA(Simd::Avx2::NormalizeHistogramAdaptive), FUNC_NHA(SimdNormalizeHistogramAdaptive));
+#endif 
+
+        return result;
+    }
+
     bool SobelDxAutoTest(const Options & options)
     {
         bool result = true;
@@ -674,25 +968,30 @@ namespace Test
     {
         struct FuncGB
         {
-            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
 
             FuncPtr func;
             String description;
 
             FuncGB(const FuncPtr& f, const String& d) : func(f), description(d) {}
 
-            void Update(size_t c, float s)
+            void Update(size_t c, float s, SimdGaussianBlurFlags f)
             {
                 std::stringstream ss;
                 ss << description;
-                ss << "[" << ToString(s, 1, true) << "-" << c << "]";
+                ss << "[" << ToString(s, 1, true) << "-" << c;
+                SimdGaussianBlurFlags channel = SimdGaussianBlurFlags(f & SimdGaussianBlurChannelMask);
+                ss << "-" << (channel == SimdGaussianBlurChannelByte ? "b" : (channel == SimdGaussianBlurChannelShort ? "s" : "f"));
+                SimdGaussianBlurFlags engine = SimdGaussianBlurFlags(f & SimdGaussianBlurEngineMask);
+                ss << "-" << (engine == SimdGaussianBlurEngineAuto ? "a" : (engine == SimdGaussianBlurEngineDirect ? "d" : "r"));
+                ss << "]";
                 description = ss.str();
             }
 
-            void Call(const View& src, float sigma, float epsilon,  View& dst) const
+            void Call(const View& src, size_t width, size_t channels, float sigma, float epsilon, SimdGaussianBlurFlags flags, View& dst) const
             {
                 void* filter = NULL;
-                filter = func(src.width, src.height, src.ChannelCount(), &sigma, &epsilon);
+                filter = func(width, src.height, channels, &sigma, &epsilon, flags);
                 {
                     TEST_PERFORMANCE_TEST(description);
                     SimdGaussianBlurRun(filter, src.data, src.stride, dst.data, dst.stride);
@@ -705,16 +1004,33 @@ namespace Test
 #define FUNC_GB(function) \
     FuncGB(function, std::string(#function))
 
-    bool GaussianBlurAutoTest(size_t width, size_t height, size_t channels, float sigma, FuncGB f1, FuncGB f2)
+    bool GaussianBlurAutoTest(size_t width, size_t height, size_t channels, float sigma, SimdGaussianBlurFlags flags, FuncGB f1, FuncGB f2)
     {
         bool result = true;
 
-        f1.Update(channels, sigma);
-        f2.Update(channels, sigma);
+        f1.Update(channels, sigma, flags);
+        f2.Update(channels, sigma, flags);
 
+        SimdGaussianBlurFlags channel = SimdGaussianBlurFlags(flags & SimdGaussianBlurChannelMask);
         View src;
-        if (!GetTestImage(src, width, height, channels, f1.description, f2.description))
-            return false;
+        if (channel == SimdGaussianBlurChannelByte)
+        {
+            if (!GetTestImage(src, width, height, channels, f1.description, f2.description))
+                return false;
+        }
+        else
+        {
+            src.Recreate(width * channels, height, channel == SimdGaussianBlurChannelShort ? View::Int16 : View::Float, NULL, TEST_ALIGN(width * channels));
+            if (channel == SimdGaussianBlurChannelShort)
+            {
+                for (size_t row = 0; row < src.height; ++row)
+                    for (size_t col = 0; col < src.width; ++col)
+                        src.At<uint16_t>(col, row) = uint16_t(Random(0x8000));
+            }
+            else
+                FillRandom32f(src, -1.0f, 1.0f);
+            TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+        }
 
         View dst1(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
         View dst2(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
@@ -723,11 +1039,14 @@ namespace Test
 
         TEST_ALIGN(SIMD_ALIGN);
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, sigma, epsilon, dst1));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, width, channels, sigma, epsilon, flags, dst1));
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, sigma, epsilon, dst2));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, width, channels, sigma, epsilon, flags, dst2));
 
-        result = result && Compare(dst1, dst2, 1, true, 64);
+        if (channel == SimdGaussianBlurChannelFloat)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, channel == SimdGaussianBlurChannelShort ? 2 : 1, true, 64);
 
         if (src.format == View::Bgr24 && NOISE_IMAGE == false)
         {
@@ -738,12 +1057,12 @@ namespace Test
         return result;
     }
 
-    bool GaussianBlurAutoTest(int channels, float sigma, const FuncGB& f1, const FuncGB& f2)
+    bool GaussianBlurAutoTest(int channels, float sigma, SimdGaussianBlurFlags flags, const FuncGB& f1, const FuncGB& f2)
     {
         bool result = true;
 
-        result = result && GaussianBlurAutoTest(W, H, channels, sigma, f1, f2);
-        result = result && GaussianBlurAutoTest(W + O, H - O, channels, sigma, f1, f2);
+        result = result && GaussianBlurAutoTest(W, H, channels, sigma, flags, f1, f2);
+        result = result && GaussianBlurAutoTest(W + O, H - O, channels, sigma, flags, f1, f2);
 
         return result;
     }
@@ -752,13 +1071,21 @@ namespace Test
     {
         bool result = true;
 
-        //result = result && GaussianBlurAutoTest(12, 8, 1, 5.0f, f1, f2);
+        const SimdGaussianBlurFlags b = SimdGaussianBlurChannelByte, s = SimdGaussianBlurChannelShort, f = SimdGaussianBlurChannelFloat;
+        const SimdGaussianBlurFlags a = SimdGaussianBlurEngineAuto, d = SimdGaussianBlurEngineDirect, r = SimdGaussianBlurEngineRecursive;
 
         for (int channels = 1; channels <= 4; channels++)
         {
-            result = result && GaussianBlurAutoTest(channels, 0.5f, f1, f2);
-            result = result && GaussianBlurAutoTest(channels, 1.0f, f1, f2);
-            result = result && GaussianBlurAutoTest(channels, 3.0f, f1, f2);
+            result = result && GaussianBlurAutoTest(channels, 0.5f, SimdGaussianBlurFlags(b | a), f1, f2);
+            result = result && GaussianBlurAutoTest(channels, 1.0f, SimdGaussianBlurFlags(b | a), f1, f2);
+            result = result && GaussianBlurAutoTest(channels, 3.0f, SimdGaussianBlurFlags(b | a), f1, f2);
+            result = result && GaussianBlurAutoTest(channels, 10.0f, SimdGaussianBlurFlags(b | a), f1, f2);
+            result = result && GaussianBlurAutoTest(channels, 10.0f, SimdGaussianBlurFlags(b | d), f1, f2);
+            result = result && GaussianBlurAutoTest(channels, 1.0f, SimdGaussianBlurFlags(b | r), f1, f2);
+            result = result && GaussianBlurAutoTest(channels, 3.0f, SimdGaussianBlurFlags(s | d), f1, f2);
+            result = result && GaussianBlurAutoTest(channels, 10.0f, SimdGaussianBlurFlags(s | r), f1, f2);
+            result = result && GaussianBlurAutoTest(channels, 3.0f, SimdGaussianBlurFlags(f | d), f1, f2);
+            result = result && GaussianBlurAutoTest(channels, 10.0f, SimdGaussianBlurFlags(f | r), f1, f2);
         }
 
         return result;
@@ -769,26 +1096,26 @@ namespace Test
         bool result = true;
 
         if (TestBase(options))
-            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Base::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInit));
+            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Base::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInitV2));
 
 #ifdef SIMD_SSE41_ENABLE
         if (Simd::Sse41::Enable && TestSse41(options))
-            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Sse41::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInit));
+            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Sse41::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInitV2));
 #endif 
 
 #ifdef SIMD_AVX2_ENABLE
         if (Simd::Avx2::Enable && TestAvx2(options))
-            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Avx2::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInit));
+            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Avx2::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInitV2));
 #endif 
 
 #ifdef SIMD_AVX512BW_ENABLE
         if (Simd::Avx512bw::Enable && TestAvx512bw(options))
-            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Avx512bw::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInit));
+            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Avx512bw::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInitV2));
 #endif 
 
 #ifdef SIMD_NEON_ENABLE
         if (Simd::Neon::Enable && TestNeon(options))
-            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Neon::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInit));
+            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Neon::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInitV2));
 #endif
 
         return result;
@@ -229,4 +229,61 @@ namespace Test
 
         return true;
     }
+
+    bool FontDrawFrameSpecialTest(const Options & options)
+    {
+        typedef Simd::Font::Frame Frame;
+        typedef Simd::Pixel::Bgr24 Color;
+
+        const String text = "2025-11-01 12:34:56.789\nCamera #1";
+        const Color color(32, 224, 255);
+        const Point position(W / 8, H / 8);
+        Simd::Font font(32);
+
+        View control(W, H, View::Bgr24);
+        Simd::Fill(control, 64);
+        font.Draw(control, text, position, color);
+
+        Frame::Format formats[] = { Frame::Gray8, Frame::Bgr24, Frame::Bgra32, Frame::Rgb24, Frame::Rgba32, Frame::Nv12, Frame::Yuv420p, Frame::Yuv444p };
+        for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f)
+        {
+            Frame source(W, H, Frame::Bgr24), frame(W, H, formats[f], false, 0, SimdYuvBt601), yuv(W, H, Frame::Yuv420p, false, 0, SimdYuvBt601);
+            Simd::Fill(source.planes[0], 64);
+            if (formats[f] == Frame::Nv12)
+            {
+                Simd::Convert(source, yuv);
+                Simd::Copy(yuv.planes[0], frame.planes[0]);
+                Simd::InterleaveUv(yuv.planes[1], yuv.planes[2], frame.planes[1]);
+            }
+            else
+                Simd::Convert(source, frame);
+
+            double start = GetTime();
+            for (size_t i = 0; i < 100; ++i)
+            {
+                if (!font.Draw(frame, text, position, color))
+                {
+                    TEST_LOG_SS(Error, "Can't draw text at frame with format " << (int)formats[f] << "!");
+                    return false;
+                }
+            }
+            TEST_LOG_SS(Info, "Simd::Font::Draw(Frame) for format " << (int)formats[f] << ": " << std::setprecision(3) << std::fixed
+                << (GetTime() - start) * 10.0 << " ms.");
+
+            if (formats[f] == Frame::Bgr24 && !Compare(frame.planes[0], control, 0, true, 64))
+                return false;
+
+            if (formats[f] == Frame::Nv12)
+            {
+                Simd::Copy(frame.planes[0], yuv.planes[0]);
+                Simd::DeinterleaveUv(frame.planes[1], yuv.planes[1], yuv.planes[2]);
+                Simd::Convert(yuv, source);
+            }
+            else
+                Simd::Convert(frame, source);
+            source.planes[0].Save(String("text_frame_") + ToString((int)formats[f]) + ".ppm");
+        }
+
+        return true;
+    }
 }
@@ -1149,6 +1149,7 @@ namespace Test
         {
             if (_network && _data && _options)
             {
+                double start = GetTime();
                 if (_current%_options->logEvery == 0)
                 {
                     Error train = Check(*_network, _data->train, _options->threshold, true);
@@ -1161,14 +1162,17 @@ namespace Test
                     std::cout << "Epoch " << _current << "\r";
 
                 _current++;
+                if (_time)
+                    *_time += GetTime() - start;
             }
         }
 
-        Logger(Network * network = NULL, TrainData * data = NULL, TrainOptions * options = NULL)
+        Logger(Network * network = NULL, TrainData * data = NULL, TrainOptions * options = NULL, double * time = NULL)
             : _current(options ? options->epochStart : 0)
             , _network(network)
             , _options(options)
             , _data(data)
+            , _time(time)
         {
         }
 
@@ -1177,6 +1181,7 @@ namespace Test
         Network * _network;
         TrainOptions * _options;
         TrainData *_data;
+        double * _time;
     };
 
     bool LoadDigits(const Network & net, bool error, TrainSample & dst)
@@ -1371,9 +1376,16 @@ namespace Test
         trainOptions.threadNumber = 1;
 #endif
 
-        Logger logger(&net, &data, &trainOptions);
+        double logging = 0;
+        Logger logger(&net, &data, &trainOptions, &logging);
 
+        double start = GetTime();
         net.Train(data.train.src, data.train.dst, trainOptions, logger);
+        double training = GetTime() - start - logging;
+
+        size_t samples = data.train.src.size() * (trainOptions.epochFinish - trainOptions.epochStart);
+        TEST_LOG_SS(Info, "Simd::Neural::Network trains " << std::setprecision(1) << std::fixed << samples / training
+            << " samples/sec (threads = " << trainOptions.threadNumber << ", batch = " << trainOptions.batchSize << ").");
 
 #ifdef TEST_PERFORMANCE_TEST_ENABLE
         TEST_LOG_SS(Info, PerformanceMeasurerStorage::s_storage.ConsoleReport(false, true));
@@ -0,0 +1,344 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+#include "Test/TestOptions.h"
+
+#include "Simd/SimdRemap.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncRM
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+                size_t channels, const void* map, SimdTensorDataType mapType, SimdWarpAffineFlags flags, const uint8_t* border);
+
+            FuncPtr func;
+            String description;
+
+            FuncRM(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdTensorDataType mapType, SimdWarpAffineFlags flags)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels;
+                ss << "-" << ((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte ? "b" : "f");
+                ss << "-" << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest ? "nr" : "bl");
+                ss << "-" << ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant ? "c" : "t");
+                ss << "-" << (mapType == SimdTensorData32f ? "f" : "i");
+                ss << "-" << srcW << "x" << srcH << "->" << dstW << "x" << dstH << "]";
+                description = ss.str();
+            }
+
+            void Call(size_t srcW, const View& src, size_t dstW, View& dst, size_t channels, const void* map, SimdTensorDataType mapType, 
+                SimdWarpAffineFlags flags, const uint8_t* border, const View& buf) const
+            {
+                void* context = func(srcW, src.height, src.stride, dstW, dst.height, dst.stride, channels, map, mapType, flags, border);
+                if (context)
+                {
+                    if ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderTransparent)
+                        Simd::Copy(buf, dst);
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdRemapRun(context, src.data, dst.data);
+                    }
+                    SimdRelease(context);
+                }
+            }
+        };
+    }
+
+#define FUNC_RM(function) \
+    FuncRM(function, std::string(#function))
+
+    static void SetRemapMap(size_t srcW, size_t srcH, size_t dstW, size_t dstH, SimdTensorDataType mapType, Buffer32f & map32f, std::vector<int32_t> & map32i)
+    {
+        map32f.resize(dstW * dstH * 2);
+        float kx = float(srcW + 4) / float(dstW), ky = float(srcH + 4) / float(dstH);
+        for (size_t y = 0, i = 0; y < dstH; ++y)
+        {
+            for (size_t x = 0; x < dstW; ++x, i += 2)
+            {
+                map32f[i + 0] = float(x) * kx - 2.0f + 3.0f * ::sinf(float(y) * 0.05f);
+                map32f[i + 1] = float(y) * ky - 2.0f + 3.0f * ::cosf(float(x) * 0.07f);
+            }
+        }
+        if (mapType == SimdTensorData32i)
+        {
+            map32i.resize(map32f.size());
+            for (size_t i = 0; i < map32f.size(); ++i)
+                map32i[i] = Simd::Round(map32f[i] * 65536.0f);
+        }
+    }
+
+    static View::Format RemapFormat(size_t channels, SimdWarpAffineFlags flags, size_t & width)
+    {
+        if ((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelFloat)
+        {
+            width *= channels;
+            return View::Float;
+        }
+        switch (channels)
+        {
+        case 1: return View::Gray8;
+        case 2: return View::Uv16;
+        case 3: return View::Bgr24;
+        case 4: return View::Bgra32;
+        default:
+            assert(0); return View::None;
+        }
+    }
+
+    bool RemapAutoTest(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdTensorDataType mapType, SimdWarpAffineFlags flags, FuncRM f1, FuncRM f2)
+    {
+        bool result = true;
+
+        f1.Update(srcW, srcH, dstW, dstH, channels, mapType, flags);
+        f2.Update(srcW, srcH, dstW, dstH, channels, mapType, flags);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " .");
+
+        bool isFloat = (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelFloat;
+        size_t srcWidth = srcW, dstWidth = dstW;
+        View::Format format = RemapFormat(channels, flags, srcWidth);
+        RemapFormat(channels, flags, dstWidth);
+
+        View src(srcWidth, srcH, format, NULL, TEST_ALIGN(srcWidth));
+        if (isFloat)
+            FillRandom32f(src, -10.0f, 10.0f);
+        else
+            FillRandom(src);
+
+        Buffer32f map32f;
+        std::vector<int32_t> map32i;
+        SetRemapMap(srcW, srcH, dstW, dstH, mapType, map32f, map32i);
+        const void* map = mapType == SimdTensorData32f ? (void*)map32f.data() : (void*)map32i.data();
+
+        View buf(dstWidth, dstH, format, NULL, TEST_ALIGN(dstWidth));
+        View dst1(dstWidth, dstH, format, NULL, TEST_ALIGN(dstWidth));
+        View dst2(dstWidth, dstH, format, NULL, TEST_ALIGN(dstWidth));
+        Simd::Fill(dst1, 0x33);
+        Simd::Fill(dst2, 0x99);
+        Simd::Copy(dst1, buf);
+        uint8_t border8u[4] = { 11, 33, 55, 77 };
+        float border32f[4] = { -1.5f, 2.0f, 3.5f, 7.0f };
+        const uint8_t* border = isFloat ? (uint8_t*)border32f : border8u;
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(srcW, src, dstW, dst1, channels, map, mapType, flags, border, buf));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(srcW, src, dstW, dst2, channels, map, mapType, flags, border, buf));
+
+        if (isFloat)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool RemapAutoTest(const FuncRM& f1, const FuncRM& f2)
+    {
+        bool result = true;
+
+        std::vector<SimdWarpAffineFlags> channel = { SimdWarpAffineChannelByte, SimdWarpAffineChannelFloat };
+        std::vector<SimdWarpAffineFlags> interp = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear };
+        std::vector<SimdWarpAffineFlags> border = { SimdWarpAffineBorderConstant, SimdWarpAffineBorderTransparent };
+        for (size_t c = 0; c < channel.size(); ++c)
+        {
+            for (size_t i = 0; i < interp.size(); ++i)
+            {
+                for (size_t b = 0; b < border.size(); ++b)
+                {
+                    SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(channel[c] | interp[i] | border[b]);
+                    for (size_t n = 1; n <= 4; ++n)
+                        result = result && RemapAutoTest(W, H, W, H, n, SimdTensorData32f, flags, f1, f2);
+                }
+            }
+        }
+        SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant);
+        result = result && RemapAutoTest(W, H, W * 3 / 4 + O, H * 3 / 4 - O, 3, SimdTensorData32i, flags, f1, f2);
+
+        return result;
+    }
+
+    bool RemapAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && RemapAutoTest(FUNC_RM(Simd::Base::RemapInit), FUNC_RM(SimdRemapInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && RemapAutoTest(FUNC_RM(Simd::Sse41::RemapInit), FUNC_RM(SimdRemapInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && RemapAutoTest(FUNC_RM(Simd::Avx2::RemapInit), FUNC_RM(SimdRemapInit));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncWP
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+                size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+            FuncPtr func;
+            String description;
+
+            FuncWP(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels;
+                ss << "-" << ((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte ? "b" : "f");
+                ss << "-" << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest ? "nr" : "bl");
+                ss << "-" << ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant ? "c" : "t");
+                ss << "-" << srcW << "x" << srcH << "->" << dstW << "x" << dstH << "]";
+                description = ss.str();
+            }
+
+            void Call(size_t srcW, const View& src, size_t dstW, View& dst, size_t channels, const float* mat,
+                SimdWarpAffineFlags flags, const uint8_t* border, const View& buf) const
+            {
+                void* context = func(srcW, src.height, src.stride, dstW, dst.height, dst.stride, channels, mat, flags, border);
+                if (context)
+                {
+                    if ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderTransparent)
+                        Simd::Copy(buf, dst);
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdWarpPerspectiveRun(context, src.data, dst.data);
+                    }
+                    SimdRelease(context);
+                }
+            }
+        };
+    }
+
+#define FUNC_WP(function) \
+    FuncWP(function, std::string(#function))
+
+    bool WarpPerspectiveAutoTest(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, FuncWP f1, FuncWP f2)
+    {
+        bool result = true;
+
+        f1.Update(srcW, srcH, dstW, dstH, channels, flags);
+        f2.Update(srcW, srcH, dstW, dstH, channels, flags);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " .");
+
+        bool isFloat = (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelFloat;
+        size_t srcWidth = srcW, dstWidth = dstW;
+        View::Format format = RemapFormat(channels, flags, srcWidth);
+        RemapFormat(channels, flags, dstWidth);
+
+        View src(srcWidth, srcH, format, NULL, TEST_ALIGN(srcWidth));
+        if (isFloat)
+            FillRandom32f(src, -10.0f, 10.0f);
+        else
+            FillRandom(src);
+
+        float mat[9] = { 0.9f, -0.3f, float(dstW / 6), 0.3f, 0.9f, -float(dstH / 8), 0.0004f, 0.0002f, 1.0f };
+
+        View buf(dstWidth, dstH, format, NULL, TEST_ALIGN(dstWidth));
+        View dst1(dstWidth, dstH, format, NULL, TEST_ALIGN(dstWidth));
+        View dst2(dstWidth, dstH, format, NULL, TEST_ALIGN(dstWidth));
+        Simd::Fill(dst1, 0x33);
+        Simd::Fill(dst2, 0x99);
+        Simd::Copy(dst1, buf);
+        uint8_t border8u[4] = { 11, 33, 55, 77 };
+        float border32f[4] = { -1.5f, 2.0f, 3.5f, 7.0f };
+        const uint8_t* border = isFloat ? (uint8_t*)border32f : border8u;
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(srcW, src, dstW, dst1, channels, mat, flags, border, buf));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(srcW, src, dstW, dst2, channels, mat, flags, border, buf));
+
+        if (isFloat)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool WarpPerspectiveAutoTest(const FuncWP& f1, const FuncWP& f2)
+    {
+        bool result = true;
+
+        std::vector<SimdWarpAffineFlags> channel = { SimdWarpAffineChannelByte, SimdWarpAffineChannelFloat };
+        std::vector<SimdWarpAffineFlags> interp = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear };
+        for (size_t c = 0; c < channel.size(); ++c)
+        {
+            for (size_t i = 0; i < interp.size(); ++i)
+            {
+                SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(channel[c] | interp[i] | SimdWarpAffineBorderConstant);
+                result = result && WarpPerspectiveAutoTest(W, H, W, H, 1, flags, f1, f2);
+                result = result && WarpPerspectiveAutoTest(W, H, W, H, 3, flags, f1, f2);
+                result = result && WarpPerspectiveAutoTest(W, H, W, H, 4, flags, f1, f2);
+            }
+        }
+        SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderTransparent);
+        result = result && WarpPerspectiveAutoTest(W, H, W + O, H - O, 2, flags, f1, f2);
+
+        return result;
+    }
+
+    bool WarpPerspectiveAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Base::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Sse41::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Avx2::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif
+
+        return result;
+    }
+}
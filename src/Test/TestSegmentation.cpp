@@ -367,4 +367,121 @@ namespace Test
 
         return result;
     }
+
+    namespace
+    {
+        struct FuncCC
+        {
+            typedef size_t(*FuncPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t threshold,
+                SimdConnectedComponentsFlags flags, uint32_t* labels, size_t labelsStride, SimdConnectedComponentStat* stats, size_t capacity);
+            FuncPtr func;
+            String description;
+
+            FuncCC(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdConnectedComponentsFlags flags)
+            {
+                bool bits = (flags & SimdConnectedComponentsFormatMask) == SimdConnectedComponentsBits;
+                bool eight = (flags & SimdConnectedComponentsConnectivityMask) == SimdConnectedComponents8;
+                description = description + (bits ? "[Bits-" : "[Gray8-") + (eight ? "8]" : "4]");
+            }
+
+            void Call(const View& src, uint8_t threshold, SimdConnectedComponentsFlags flags, View& labels, std::vector<SimdConnectedComponentStat>& stats, size_t& count) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                count = func(src.data, src.stride, labels.width, labels.height, threshold, flags, (uint32_t*)labels.data, labels.stride, stats.data(), stats.size());
+            }
+        };
+    }
+
+#define FUNC_CC(func) FuncCC(func, #func)
+
+    bool ConnectedComponentsAutoTest(int width, int height, SimdConnectedComponentsFlags flags, FuncCC f1, FuncCC f2)
+    {
+        bool result = true;
+
+        f1.Update(flags);
+        f2.Update(flags);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        bool bits = (flags & SimdConnectedComponentsFormatMask) == SimdConnectedComponentsBits;
+        const uint8_t threshold = 128;
+        size_t size = bits ? (width + 7) / 8 : width;
+        View src(size, height, View::Gray8, NULL, TEST_ALIGN(size));
+        FillRandom(src);
+
+        View labels1(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        View labels2(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        size_t count = f2.func(src.data, src.stride, width, height, threshold, flags, NULL, 0, NULL, 0), count1 = 0, count2 = 0;
+        std::vector<SimdConnectedComponentStat> stats1(count), stats2(count);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, threshold, flags, labels1, stats1, count1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, threshold, flags, labels2, stats2, count2));
+
+        if (count1 != count2)
+        {
+            TEST_LOG_SS(Error, "There is difference in component number: " << count1 << " != " << count2 << " !");
+            return false;
+        }
+
+        result = result && Compare(labels1, labels2, 0, true, 64);
+
+        size_t area = 0, foreground = 0;
+        for (size_t i = 0; i < count1 && result; ++i)
+        {
+            if (memcmp(&stats1[i], &stats2[i], sizeof(SimdConnectedComponentStat)))
+            {
+                TEST_LOG_SS(Error, "There is difference in statistics of component " << i + 1 << " !");
+                result = false;
+            }
+            area += stats1[i].area;
+        }
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x)
+                foreground += bits ? (src.At<uint8_t>(x / 8, y) >> (x % 8)) & 1 : src.At<uint8_t>(x, y) >= threshold;
+        if (result && area != foreground)
+        {
+            TEST_LOG_SS(Error, "Total area of components " << area << " is not equal to number of foreground pixels " << foreground << " !");
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool ConnectedComponentsAutoTest(const FuncCC& f1, const FuncCC& f2)
+    {
+        bool result = true;
+
+        for (int flags = 0; flags < 4; ++flags)
+        {
+            SimdConnectedComponentsFlags f = (SimdConnectedComponentsFlags)flags;
+            result = result && ConnectedComponentsAutoTest(W, H, f, f1, f2);
+            result = result && ConnectedComponentsAutoTest(W + O, H - O, f, f1, f2);
+            result = result && ConnectedComponentsAutoTest(W - O, H + O, f, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool ConnectedComponentsAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && ConnectedComponentsAutoTest(FUNC_CC(Simd::Base::ConnectedComponents), FUNC_CC(SimdConnectedComponents));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && ConnectedComponentsAutoTest(FUNC_CC(Simd::Sse41::ConnectedComponents), FUNC_CC(SimdConnectedComponents));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && ConnectedComponentsAutoTest(FUNC_CC(Simd::Avx2::ConnectedComponents), FUNC_CC(SimdConnectedComponents));
+#endif
+
+        return result;
+    }
 }
@@ -0,0 +1,178 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestRandom.h"
+#include "Test/TestOptions.h"
+
+#include "Simd/SimdSynetCalibration.h"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        struct FuncC
+        {
+            typedef void*(*FuncPtr)(size_t channels, SimdTensorFormatType format, size_t bins, SimdBool perChannel);
+
+            FuncPtr func;
+            String desc;
+
+            FuncC(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t c, SimdTensorFormatType f, size_t b, SimdBool p)
+            {
+                desc = desc + "[" + ToString(c) + "-" + ToString(f) + "-" + ToString(b) + "-" + ToString<int>(p) + "]";
+            }
+
+            void Call(void* context, const Tensor32f& src, size_t batch, size_t spatial) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                SimdSynetCalibrationUpdate(context, src.Data(), batch, spatial);
+            }
+        };
+    }
+
+#define FUNC_C(function) FuncC(function, #function)
+
+    static bool CompareParams(void* context1, void* context2, size_t size, SimdSynetCalibrationMethodType method, float percentile, SimdBool symmetric, const String& desc)
+    {
+        Tensor32f scale1(ToShape(size)), scale2(ToShape(size));
+        Tensor32i zero1(ToShape(size)), zero2(ToShape(size));
+        SimdSynetCalibrationGetParams(context1, method, percentile, symmetric, scale1.Data(), zero1.Data());
+        SimdSynetCalibrationGetParams(context2, method, percentile, symmetric, scale2.Data(), zero2.Data());
+        return Compare(scale1, scale2, EPS, true, 32, DifferenceBoth, desc + " scale") && Compare(zero1, zero2, 1, true, 32, desc + " zero");
+    }
+
+    bool SynetCalibrationAutoTest(size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdBool perChannel, FuncC f1, FuncC f2)
+    {
+        bool result = true;
+
+        const size_t bins = 2048;
+        f1.Update(channels, format, bins, perChannel);
+        f2.Update(channels, format, bins, perChannel);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << batch << "x" << channels << "x" << spatial << "].");
+
+        void* context1 = f1.func(channels, format, bins, perChannel);
+        void* context2 = f2.func(channels, format, bins, perChannel);
+        if (context1 == NULL || context2 == NULL)
+        {
+            SimdRelease(context1);
+            SimdRelease(context2);
+            return result;
+        }
+
+        Shape shape = format == SimdTensorFormatNchw ? Shp(batch, channels, spatial) : Shp(batch, spatial, channels);
+        Tensor32f src0(shape), src1(shape), src2(shape);
+        FillRandom(src0, -1.0f, 3.0f);
+        FillRandom(src1, -2.0f, 5.0f);
+        FillRandom(src2, -11.0f, 7.0f);
+
+        f1.Call(context1, src0, batch, spatial);
+        f2.Call(context2, src0, batch, spatial);
+        f1.Call(context1, src1, batch, spatial);
+        f2.Call(context2, src1, batch, spatial);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src2, batch, spatial));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src2, batch, spatial));
+
+        Tensor32f min1(ToShape(channels)), max1(ToShape(channels)), min2(ToShape(channels)), max2(ToShape(channels));
+        SimdSynetCalibrationGetMinMax(context1, min1.Data(), max1.Data());
+        SimdSynetCalibrationGetMinMax(context2, min2.Data(), max2.Data());
+        result = result && Compare(min1, min2, 0, true, 32, DifferenceAbsolute, "min");
+        result = result && Compare(max1, max2, 0, true, 32, DifferenceAbsolute, "max");
+
+        size_t size = perChannel ? channels : 1;
+        Tensor<uint32_t> hist1(ToShape(bins)), hist2(ToShape(bins));
+        for (size_t i = 0; i < size && result; ++i)
+        {
+            float range1 = 0, range2 = 0;
+            SimdSynetCalibrationGetHistogram(context1, i, &range1, hist1.Data());
+            SimdSynetCalibrationGetHistogram(context2, i, &range2, hist2.Data());
+            if (range1 != range2)
+            {
+                TEST_LOG_SS(Error, "Histogram " << i << " range: " << range1 << " != " << range2 << " !");
+                result = false;
+            }
+            result = result && Compare(hist1, hist2, 0, true, 32, "histogram " + ToString(i));
+        }
+
+        result = result && CompareParams(context1, context2, size, SimdSynetCalibrationMinMax, 1.0f, SimdFalse, "min-max");
+        result = result && CompareParams(context1, context2, size, SimdSynetCalibrationPercentile, 0.999f, SimdTrue, "percentile");
+        result = result && CompareParams(context1, context2, size, SimdSynetCalibrationKl, 1.0f, SimdTrue, "kl");
+        result = result && CompareParams(context1, context2, size, SimdSynetCalibrationMse, 1.0f, SimdFalse, "mse");
+
+        SimdRelease(context1);
+        SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetCalibrationAutoTest(const FuncC& f1, const FuncC& f2)
+    {
+        bool result = true;
+
+        SimdTensorFormatType nchw = SimdTensorFormatNchw, nhwc = SimdTensorFormatNhwc;
+        SimdBool t = SimdTrue, f = SimdFalse;
+
+        result = result && SynetCalibrationAutoTest(2, 64, 1000, nchw, f, f1, f2);
+        result = result && SynetCalibrationAutoTest(2, 64, 1000, nhwc, f, f1, f2);
+        result = result && SynetCalibrationAutoTest(1, 17, 555, nchw, t, f1, f2);
+        result = result && SynetCalibrationAutoTest(1, 17, 555, nhwc, t, f1, f2);
+        result = result && SynetCalibrationAutoTest(3, 3, 3333, nhwc, t, f1, f2);
+
+        return result;
+    }
+
+    bool SynetCalibrationAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SynetCalibrationAutoTest(FUNC_C(Simd::Base::SynetCalibrationInit), FUNC_C(SimdSynetCalibrationInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && SynetCalibrationAutoTest(FUNC_C(Simd::Sse41::SynetCalibrationInit), FUNC_C(SimdSynetCalibrationInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SynetCalibrationAutoTest(FUNC_C(Simd::Avx2::SynetCalibrationInit), FUNC_C(SimdSynetCalibrationInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SynetCalibrationAutoTest(FUNC_C(Simd::Avx512bw::SynetCalibrationInit), FUNC_C(SimdSynetCalibrationInit));
+#endif 
+
+        return result;
+    }
+#endif
+}
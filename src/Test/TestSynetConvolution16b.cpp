@@ -164,7 +164,15 @@ namespace Test
             SimdBFloat16ToFloat32(dst16u1.Data(), dst16u1.Size(), dst32f1.Data());
             SimdBFloat16ToFloat32(dst16u2.Data(), dst16u2.Size(), dst32f2.Data());
         }
-        result = result && Compare(dst32f1, dst32f2, eps, true, 64, DifferenceBoth);
+        if (comp & SimdSynetCompatibility16bfWinograd)
+        {
+            float range = 0;
+            for (size_t i = 0; i < dst32f1.Size(); ++i)
+                range = Simd::Max(range, Simd::Abs(dst32f1.Data()[i]));
+            result = result && Compare(dst32f1, dst32f2, range * 0.01f, true, 64, DifferenceAbsolute);
+        }
+        else
+            result = result && Compare(dst32f1, dst32f2, eps, true, 64, DifferenceBoth);
 
         if(0)
         {
@@ -200,6 +208,7 @@ namespace Test
         const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
         const SimdBool tF = SimdFalse, tT = SimdTrue;
         SimdSynetCompatibilityType c = (SimdSynetCompatibilityType)(SimdSynetCompatibilityFmaUse | SimdSynetCompatibility16bfSoft);
+        SimdSynetCompatibilityType w = (SimdSynetCompatibilityType)(c | SimdSynetCompatibility16bfWinograd);
 
 #ifdef NDEBUG
 #if 0
@@ -432,6 +441,12 @@ namespace Test
         result = result && SynetConvolution16bForwardAutoTest(eps, Param(1, 64, 75, 75, 64, _3, _1, _1, _1, _1, 1, aId, tT, b16, b16), c, f1, f2);
         result = result && SynetConvolution16bForwardAutoTest(eps, Param(1, 576, 75, 75, 64, _1, _1, _1, _0, _0, 1, aId, tT, b16, b16), c, f1, f2);
 #endif
+#if 1
+        result = result && SynetConvolution16bForwardAutoTest(eps, Param(1, 64, 64, 64, 96, _3, _1, _1, _1, _1, 1, aRe, tT, f32, f32), w, f1, f2);
+        result = result && SynetConvolution16bForwardAutoTest(eps, Param(2, 96, 35, 29, 64, _3, _1, _1, _0, _0, 1, aPr, tT, b16, b16), w, f1, f2);
+        result = result && SynetConvolution16bForwardAutoTest(eps, Param(1, 128, 150, 150, 128, _3, _1, _1, _1, _1, 1, aId, tT, b16, f32), w, f1, f2);
+        result = result && SynetConvolution16bForwardAutoTest(eps, Param(1, 80, 33, 47, 72, _3, _1, _1, _1, _1, 1, aLr, tT, f32, b16), w, f1, f2);
+#endif
 #if 0
         result = result && SynetConvolution16bForwardAutoTest(eps, Param(1, 224, 24, 24, 224, _3, _1, _2, _1, _1, 1, aPr, tT, b16, b16), c, f1, f2);
 #endif
@@ -472,5 +487,107 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution16bAddSpecialTest(const Param& p, SimdTensorDataType addType)
+    {
+        bool result = true;
+
+        const SimdConvolutionParameters& c = p.conv;
+        TEST_LOG_SS(Info, "Test SynetConvolution16bForwardAdd " << p.Decription(addType == SimdTensorData32f ? "-af" : "-ab") << " .");
+
+        srand(0);
+        Tensor32f weight(p.WeightShape());
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.5f);
+        if (c.activation == SimdConvolutionActivationRestrictRange)
+        {
+            params.Data()[0] = -1.0f;
+            params.Data()[1] = 1.5f;
+        }
+
+        Tensor32f src32f(p.SrcShape(), c.srcF), add32f(p.DstShape(), c.dstF), dst32f1(p.DstShape(), c.dstF), dst32f2(p.DstShape(), c.dstF);
+        Tensor16u src16u(p.SrcShape(), c.srcF), add16u(p.DstShape(), c.dstF), dst16u1(p.DstShape(), c.dstF), dst16u2(p.DstShape(), c.dstF);
+        FillRandom(src32f.Data(), src32f.Size(), -1.0, 1.0f);
+        FillRandom(add32f.Data(), add32f.Size(), -4.0, 4.0f);
+        SimdFloat32ToBFloat16(src32f.Data(), src32f.Size(), src16u.Data());
+        SimdFloat32ToBFloat16(add32f.Data(), add32f.Size(), add16u.Data());
+        if (addType == SimdTensorData16b)
+            SimdBFloat16ToFloat32(add16u.Data(), add16u.Size(), add32f.Data());
+
+        const uint8_t* src = c.srcT == SimdTensorData32f ? (uint8_t*)src32f.Data() : (uint8_t*)src16u.Data();
+        const uint8_t* add = addType == SimdTensorData32f ? (uint8_t*)add32f.Data() : (uint8_t*)add16u.Data();
+        uint8_t* dst1 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : (uint8_t*)dst16u1.Data();
+        uint8_t* dst2 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : (uint8_t*)dst16u2.Data();
+
+        SimdConvolutionParameters id = c;
+        id.activation = SimdConvolutionActivationIdentity;
+        void* context1 = ::SimdSynetConvolution16bInit(p.batch, &c, SimdSynetCompatibilityDefault);
+        void* context2 = ::SimdSynetConvolution16bInit(p.batch, &id, SimdSynetCompatibilityDefault);
+        if (context1 == NULL || context2 == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't create BF16 convolution context!");
+            ::SimdRelease(context1);
+            ::SimdRelease(context2);
+            return false;
+        }
+        ::SimdSynetConvolution16bSetParams(context1, weight.Data(), bias.Data(), params.Data());
+        ::SimdSynetConvolution16bSetParams(context2, weight.Data(), bias.Data(), params.Data());
+
+        SimdBool fused = ::SimdSynetConvolution16bForwardAdd(context1, src, add, addType, NULL, dst1);
+        ::SimdSynetConvolution16bForward(context2, src, NULL, dst2);
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        if (!fused)
+        {
+            TEST_LOG_SS(Info, "Fused residual addition is not supported by current convolution algorithm.");
+            return result;
+        }
+
+        if (c.dstT == SimdTensorData16b)
+        {
+            SimdBFloat16ToFloat32(dst16u1.Data(), dst16u1.Size(), dst32f1.Data());
+            SimdBFloat16ToFloat32(dst16u2.Data(), dst16u2.Size(), dst32f2.Data());
+        }
+        const float* prm = params.Data();
+        for (size_t i = 0, n = dst32f2.Size(), dc = c.dstC; i < n; ++i)
+        {
+            float value = dst32f2.Data()[i] + add32f.Data()[i];
+            if (c.activation == SimdConvolutionActivationRelu)
+                value = std::max(value, 0.0f);
+            else if (c.activation == SimdConvolutionActivationPrelu)
+                value = value > 0.0f ? value : value * prm[c.dstF == SimdTensorFormatNhwc ? i % dc : 0];
+            else if (c.activation == SimdConvolutionActivationRestrictRange)
+                value = std::min(std::max(value, prm[0]), prm[1]);
+            dst32f2.Data()[i] = value;
+        }
+
+        float eps = c.dstT == SimdTensorData16b ? 0.032f : 0.002f;
+        result = result && Compare(dst32f1, dst32f2, eps, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetConvolution16bAddSpecialTest(const Options& options)
+    {
+        bool result = true;
+
+        const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aPr = SimdConvolutionActivationPrelu, aRr = SimdConvolutionActivationRestrictRange;
+        Size _1(1, 1), _3(3, 3);
+        const SimdBool tT = SimdTrue;
+
+        result = result && SynetConvolution16bAddSpecialTest(Param(1, 64, 20, 20, 96, _1, _1, _1, Size(0, 0), Size(0, 0), 1, aRe, tT, f32, f32), f32);
+        result = result && SynetConvolution16bAddSpecialTest(Param(1, 64, 20, 20, 96, _1, _1, _1, Size(0, 0), Size(0, 0), 1, aRe, tT, b16, b16), b16);
+        result = result && SynetConvolution16bAddSpecialTest(Param(1, 48, 17, 19, 37, _3, _1, _1, _1, _1, 1, aPr, tT, b16, f32), b16);
+        result = result && SynetConvolution16bAddSpecialTest(Param(2, 32, 15, 15, 80, _3, _1, _1, _1, _1, 1, aRr, tT, f32, b16), f32);
+
+        return result;
+    }
 #endif
 }
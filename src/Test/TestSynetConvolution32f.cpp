@@ -318,5 +318,229 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    struct SynetWorkspaceData
+    {
+        Param param;
+        Tensor32f src, weight, bias;
+
+        SynetWorkspaceData(const Param& p)
+            : param(p)
+        {
+            const SimdConvolutionParameters& c = p.conv;
+            src.Reshape({ p.batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
+            FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+            weight.Reshape({ c.kernelY * c.kernelX * c.srcC / c.group * c.dstC });
+            FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+            bias.Reshape({ c.dstC });
+            FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        }
+    };
+
+    bool SynetWorkspaceSpecialTest(const std::vector<SynetWorkspaceData> & data, bool workspace, std::vector<Tensor32f> & dst, size_t & internal)
+    {
+        std::vector<void*> contexts(data.size());
+        for (size_t i = 0; i < data.size(); ++i)
+            contexts[i] = ::SimdSynetConvolution32fInit(data[i].param.batch, &data[i].param.conv);
+        size_t size = ::SimdSynetWorkspaceSize(contexts.data(), contexts.size());
+        if (workspace && !::SimdSynetSetWorkspace(size, SimdTrue))
+        {
+            TEST_LOG_SS(Error, "Can't attach Synet workspace with size " << size << " bytes!");
+            return false;
+        }
+        internal = 0;
+        dst.resize(data.size());
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            const Param& p = data[i].param;
+            const SimdConvolutionParameters& c = p.conv;
+            dst[i].Reshape({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+            ::SimdSynetConvolution32fSetParams(contexts[i], data[i].weight.Data(), NULL, data[i].bias.Data(), NULL);
+            ::SimdSynetConvolution32fForward(contexts[i], data[i].src.Data(), NULL, dst[i].Data());
+            internal += ::SimdSynetConvolution32fInternalBufferSize(contexts[i]);
+        }
+        for (size_t i = 0; i < data.size(); ++i)
+            ::SimdRelease(contexts[i]);
+        if (workspace)
+        {
+            if (::SimdSynetGetWorkspace() < size)
+            {
+                TEST_LOG_SS(Error, "Wrong size of Synet workspace: " << ::SimdSynetGetWorkspace() << " < " << size << " !");
+                return false;
+            }
+            ::SimdSynetSetWorkspace(0, SimdFalse);
+        }
+        return true;
+    }
+
+    bool SynetWorkspaceSpecialTest(const Options & options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu;
+        const SimdBool tF = SimdFalse, tT = SimdTrue;
+        std::vector<SynetWorkspaceData> data;
+        data.push_back(SynetWorkspaceData(Param(1, 3, 128, 128, 16, _3, _1, _2, _1, _1, 1, aRe, tT)));
+        data.push_back(SynetWorkspaceData(Param(1, 16, 64, 64, 32, _3, _1, _1, _1, _1, 1, aRe, tT)));
+        data.push_back(SynetWorkspaceData(Param(1, 32, 64, 64, 32, _3, _1, _2, _1, _1, 32, aRe, tT)));
+        data.push_back(SynetWorkspaceData(Param(1, 32, 32, 32, 64, _1, _1, _1, _0, _0, 1, aRe, tT)));
+        data.push_back(SynetWorkspaceData(Param(1, 64, 32, 32, 64, _3, _1, _1, _1, _1, 1, aRe, tF)));
+        data.push_back(SynetWorkspaceData(Param(1, 64, 32, 32, 128, _3, _1, _2, _1, _1, 1, aRe, tF)));
+
+        TEST_LOG_SS(Info, "Test Synet workspace for " << data.size() << " FP32 convolutions.");
+
+        std::vector<Tensor32f> dst1, dst2;
+        size_t internal1 = 0, internal2 = 0;
+        result = result && SynetWorkspaceSpecialTest(data, false, dst1, internal1);
+        result = result && SynetWorkspaceSpecialTest(data, true, dst2, internal2);
+
+        for (size_t i = 0; i < data.size() && result; ++i)
+            result = result && Compare(dst1[i], dst2[i], 0.0f, true, 64, DifferenceAbsolute);
+
+        if (result)
+            TEST_LOG_SS(Info, "Internal buffers: " << internal1 * sizeof(float) / 1024 << " kB without workspace and " << internal2 * sizeof(float) / 1024 << " kB with workspace.");
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetWeightCacheSpecialTest(const std::vector<SynetWorkspaceData>& data, bool cache, std::vector<Tensor32f>& dst, size_t& internal)
+    {
+        ::SimdSynetSetWeightCache(cache ? SimdTrue : SimdFalse);
+        std::vector<void*> contexts(data.size());
+        internal = 0;
+        dst.resize(data.size());
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            const Param& p = data[i].param;
+            const SimdConvolutionParameters& c = p.conv;
+            contexts[i] = ::SimdSynetConvolution32fInit(p.batch, &c);
+            dst[i].Reshape({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+            ::SimdSynetConvolution32fSetParams(contexts[i], data[i].weight.Data(), NULL, data[i].bias.Data(), NULL);
+            internal += ::SimdSynetConvolution32fInternalBufferSize(contexts[i]);
+        }
+        for (size_t i = 0; i < data.size(); ++i)
+            ::SimdSynetConvolution32fForward(contexts[i], data[i].src.Data(), NULL, dst[i].Data());
+        size_t entries, bytes, hits, misses, saved;
+        ::SimdSynetWeightCacheStatistics(&entries, &bytes, &hits, &misses, &saved);
+        if (cache)
+            TEST_LOG_SS(Info, "Weight cache: " << entries << " entries (" << bytes / 1024 << " kB), " << hits << " hits, " << misses << " misses, " << saved / 1024 << " kB saved.");
+        for (size_t i = 0; i < data.size(); ++i)
+            ::SimdRelease(contexts[i]);
+        ::SimdSynetSetWeightCache(SimdFalse);
+        ::SimdSynetWeightCacheStatistics(&entries, &bytes, NULL, NULL, NULL);
+        if (entries || bytes)
+        {
+            TEST_LOG_SS(Error, "Weight cache is not empty after release of all contexts: " << entries << " entries, " << bytes << " bytes!");
+            return false;
+        }
+        return true;
+    }
+
+    bool SynetWeightCacheSpecialTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _1(1, 1), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu;
+        const SimdBool tT = SimdTrue;
+        const size_t copies = 3;
+        std::vector<SynetWorkspaceData> unique, data;
+        unique.push_back(SynetWorkspaceData(Param(1, 64, 32, 32, 64, _3, _1, _1, _1, _1, 1, aRe, tT)));
+        unique.push_back(SynetWorkspaceData(Param(1, 128, 16, 16, 128, _3, _1, _1, _1, _1, 1, aRe, tT)));
+        for (size_t c = 0; c < copies; ++c)
+            data.insert(data.end(), unique.begin(), unique.end());
+
+        TEST_LOG_SS(Info, "Test Synet weight cache for " << data.size() << " FP32 convolutions (" << unique.size() << " unique).");
+
+        size_t hits0, misses0, hits1, misses1;
+        ::SimdSynetWeightCacheStatistics(NULL, NULL, &hits0, &misses0, NULL);
+
+        std::vector<Tensor32f> dst1, dst2;
+        size_t internal1 = 0, internal2 = 0;
+        result = result && SynetWeightCacheSpecialTest(data, false, dst1, internal1);
+        result = result && SynetWeightCacheSpecialTest(data, true, dst2, internal2);
+
+        for (size_t i = 0; i < data.size() && result; ++i)
+            result = result && Compare(dst1[i], dst2[i], 0.0f, true, 64, DifferenceAbsolute);
+
+        ::SimdSynetWeightCacheStatistics(NULL, NULL, &hits1, &misses1, NULL);
+        if (result && hits1 - hits0 != (misses1 - misses0) * (copies - 1))
+        {
+            TEST_LOG_SS(Error, "Wrong weight cache statistics: " << hits1 - hits0 << " hits for " << misses1 - misses0 << " misses!");
+            result = false;
+        }
+
+        if (result)
+            TEST_LOG_SS(Info, "Internal buffers: " << internal1 * sizeof(float) / 1024 << " kB without weight cache and " << internal2 * sizeof(float) / 1024 << " kB with weight cache.");
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution32fReshapeSpecialTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _1(1, 1), _3(3, 3);
+        Param p(1, 64, 32, 32, 64, _3, _1, _1, _1, _1, 1, SimdConvolutionActivationRelu, SimdTrue);
+        const SimdConvolutionParameters& c = p.conv;
+        Size shapes[] = { Size(32, 32), Size(48, 20), Size(17, 33), Size(32, 32), Size(64, 36), Size(48, 20) };
+        const size_t count = sizeof(shapes) / sizeof(shapes[0]), plans = 3;
+
+        TEST_LOG_SS(Info, "Test reshapable FP32 convolution for " << count << " input shapes and " << plans << " plans.");
+
+        Tensor32f weight({ c.kernelY * c.kernelX * c.srcC / c.group * c.dstC }), bias({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        void* reshapable = ::SimdSynetConvolution32fInitReshapable(p.batch, &c, plans);
+        if (reshapable == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't create reshapable FP32 convolution!");
+            return false;
+        }
+        ::SimdSynetConvolution32fSetParams(reshapable, weight.Data(), NULL, bias.Data(), NULL);
+
+        size_t misses0, misses1;
+        ::SimdSynetWeightCacheStatistics(NULL, NULL, NULL, &misses0, NULL);
+        for (size_t i = 0; i < count && result; ++i)
+        {
+            Param s = p;
+            s.conv.srcH = shapes[i].y;
+            s.conv.srcW = shapes[i].x;
+            s.conv.dstH = (s.conv.srcH + c.padY + c.padH - c.kernelY) / c.strideY + 1;
+            s.conv.dstW = (s.conv.srcW + c.padX + c.padW - c.kernelX) / c.strideX + 1;
+            if (!::SimdSynetConvolution32fReshape(reshapable, s.batch, s.conv.srcH, s.conv.srcW))
+            {
+                TEST_LOG_SS(Error, "Can't reshape FP32 convolution to " << s.conv.srcH << "x" << s.conv.srcW << " !");
+                result = false;
+                break;
+            }
+            Tensor32f src({ s.batch, s.conv.srcH, s.conv.srcW, s.conv.srcC });
+            FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+            Tensor32f dst1({ s.batch, s.conv.dstH, s.conv.dstW, s.conv.dstC }), dst2(dst1.Shape());
+
+            void* context = ::SimdSynetConvolution32fInit(s.batch, &s.conv);
+            ::SimdSynetConvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), NULL);
+            ::SimdSynetConvolution32fForward(context, src.Data(), NULL, dst1.Data());
+            ::SimdRelease(context);
+
+            ::SimdSynetConvolution32fForward(reshapable, src.Data(), NULL, dst2.Data());
+
+            result = result && Compare(dst1, dst2, 0.0f, true, 64, DifferenceAbsolute);
+        }
+        ::SimdSynetWeightCacheStatistics(NULL, NULL, NULL, &misses1, NULL);
+        if (result)
+            TEST_LOG_SS(Info, "Reshapable convolution " << ::SimdSynetConvolution32fInfo(reshapable) << " has packed weights " << misses1 - misses0 << " times for " << count << " shapes.");
+        ::SimdRelease(reshapable);
+
+        return result;
+    }
 #endif
 }
@@ -201,11 +201,17 @@ namespace Test
         result = result && SynetDeconvolution16bForwardAutoTest(eps, Param(1, 256, 16, 16, 15, _1, _1, _1, _0, _0, 1, aId, tT, b16, b16), c, f1, f2);
         result = result && SynetDeconvolution16bForwardAutoTest(eps, Param(1, 256, 16, 16, 31, _1, _1, _1, _0, _0, 1, aId, tT, b16, b16), c, f1, f2);
 #endif
+#if 1
+        result = result && SynetDeconvolution16bForwardAutoTest(eps, Param(1, 64, 24, 32, 48, _4, _1, _2, _1, _1, 1, aRe, tT, f32, f32), c, f1, f2);
+        result = result && SynetDeconvolution16bForwardAutoTest(eps, Param(1, 48, 17, 23, 40, _3, _1, _2, _1, _0, 1, aPr, tT, b16, b16), c, f1, f2);
+        result = result && SynetDeconvolution16bForwardAutoTest(eps, Param(1, 32, 15, 19, 36, _3, _1, _2, _0, _0, 1, aId, tT, b16, f32), c, f1, f2);
+#endif
 #else
 #if 1
         result = result && SynetDeconvolution16bForwardAutoTest(eps, Param(1, 256, 16, 16, 15, _1, _1, _1, _0, _0, 1, aId, tT, b16, b16), c, f1, f2);
         result = result && SynetDeconvolution16bForwardAutoTest(eps, Param(1, 256, 16, 16, 31, _1, _1, _1, _0, _0, 1, aId, tT, b16, b16), c, f1, f2);
         //result = result && SynetDeconvolution16bForwardAutoTest(eps, Param(1, 72, 24, 32, 64, _4, _1, _2, _1, _1, 1, aId, tT, f32, f32), c, f1, f2);
+        result = result && SynetDeconvolution16bForwardAutoTest(eps, Param(1, 32, 12, 16, 24, _4, _1, _2, _1, _1, 1, aId, tT, b16, b16), c, f1, f2);
 #endif
 #endif
 
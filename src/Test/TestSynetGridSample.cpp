@@ -153,6 +153,85 @@ namespace Test
         return result;
     }
 
+    void* SynetGridSample2dRefInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t dstH, size_t dstW,
+        SimdTensorDataType type, SimdGridSampleInterpType interp, SimdGridSamplePaddingType padding, SimdBool align)
+    {
+        Simd::GridSample2dParam param(batch, channels, srcH, srcW, dstH, dstW, type, interp, padding, align);
+        return new Simd::Base::SynetGridSample2dRef(param);
+    }
+
+    bool SynetGridSample2dRefAutoTest(const Shape& srcShape, const Shape& grdShape,
+        SimdTensorDataType type, SimdGridSampleInterpType interp, SimdGridSamplePaddingType padding, SimdBool align, FuncGS2D f1)
+    {
+        bool result = true;
+
+        FuncGS2D f2 = FUNC_GS2D(SynetGridSample2dRefInit);
+
+        Shape dstShape = Shp(srcShape[0], srcShape[1], grdShape[1], grdShape[2]);
+
+        f1.Update(srcShape, grdShape, type, interp, padding, align);
+        f2.Update(srcShape, grdShape, SimdTensorData32f, interp, padding, align);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " .");
+
+        Tensor32f src(srcShape), grd(grdShape), dst1(dstShape), dst2(dstShape);
+        Tensor16u src16b(srcShape), grd16b(grdShape), dst16b(dstShape);
+
+        Fill(src, 0);
+        Fill(grd, 0);
+        if (type == SimdTensorData16b)
+        {
+            SimdFloat32ToBFloat16(src.Data(), src.Size(), src16b.Data());
+            SimdBFloat16ToFloat32(src16b.Data(), src.Size(), src.Data());
+            SimdFloat32ToBFloat16(grd.Data(), grd.Size(), grd16b.Data());
+            SimdBFloat16ToFloat32(grd16b.Data(), grd.Size(), grd.Data());
+        }
+        memset(dst1.Data(), 1, dst1.Size() * sizeof(float));
+        memset(dst2.Data(), 2, dst2.Size() * sizeof(float));
+
+        void* context1 = f1.func(srcShape[0], srcShape[1], srcShape[2], srcShape[3], grdShape[1], grdShape[2], type, interp, padding, align);
+        void* context2 = f2.func(srcShape[0], srcShape[1], srcShape[2], srcShape[3], grdShape[1], grdShape[2], SimdTensorData32f, interp, padding, align);
+
+        if (type == SimdTensorData16b)
+        {
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, (uint8_t*)src16b.Data(), (uint8_t*)grd16b.Data(), (uint8_t*)dst16b.Data()));
+            SimdBFloat16ToFloat32(dst16b.Data(), dst16b.Size(), dst1.Data());
+        }
+        else
+        {
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, (uint8_t*)src.Data(), (uint8_t*)grd.Data(), (uint8_t*)dst1.Data()));
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, (uint8_t*)src.Data(), (uint8_t*)grd.Data(), (uint8_t*)dst2.Data()));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        result = result && Compare(dst1, dst2, type == SimdTensorData16b ? 0.02f : EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetGridSample2dRefAutoTest(const Shape& srcShape, const Shape& grdShape, const FuncGS2D& f1)
+    {
+        bool result = true;
+
+        SimdBool t = SimdTrue, f = SimdFalse;
+        SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int p = 0; p < 3; ++p)
+            {
+                result = result && SynetGridSample2dRefAutoTest(srcShape, grdShape, f32, (SimdGridSampleInterpType)i, (SimdGridSamplePaddingType)p, f, f1);
+                result = result && SynetGridSample2dRefAutoTest(srcShape, grdShape, f32, (SimdGridSampleInterpType)i, (SimdGridSamplePaddingType)p, t, f1);
+                result = result && SynetGridSample2dRefAutoTest(srcShape, grdShape, b16, (SimdGridSampleInterpType)i, (SimdGridSamplePaddingType)p, f, f1);
+                result = result && SynetGridSample2dRefAutoTest(srcShape, grdShape, b16, (SimdGridSampleInterpType)i, (SimdGridSamplePaddingType)p, t, f1);
+            }
+        }
+
+        return result;
+    }
+
     bool SynetGridSample2dAutoTest(const Shape& srcShape, const Shape& grdShape, const FuncGS2D& f1, const FuncGS2D& f2)
     {
         bool result = true;
@@ -176,8 +255,8 @@ namespace Test
 
         SimdBool t = SimdTrue, f = SimdFalse;
         SimdTensorDataType f32 = SimdTensorData32f;
-        SimdGridSampleInterpType Bl = SimdGridSampleInterpBilinear;
-        SimdGridSamplePaddingType Z = SimdGridSamplePaddingZeros;
+        SimdGridSampleInterpType Bl = SimdGridSampleInterpBilinear, Bc = SimdGridSampleInterpBicubic;
+        SimdGridSamplePaddingType Z = SimdGridSamplePaddingZeros, B = SimdGridSamplePaddingBorder;
 
 
 #ifdef NDEBUG
@@ -192,9 +271,14 @@ namespace Test
         result = result && SynetGridSample2dAutoTest(Shp(8, 32, 40, 40), Shp(8, 300, 4, 2), f1, f2);
         result = result && SynetGridSample2dAutoTest(Shp(8, 32, 80, 80), Shp(8, 300, 4, 2), f1, f2);
 #endif
+#if 1
+        result = result && SynetGridSample2dRefAutoTest(Shp(2, 8, 21, 26), Shp(2, 19, 23, 2), f1);
+        result = result && SynetGridSample2dAutoTest<float>(Shp(1, 32, 64, 64), Shp(1, 96, 96, 2), f32, Bc, B, f, f1, f2);
+#endif
 #else
         result = result && SynetGridSample2dAutoTest<float>(Shp(5188, 1, 54, 96), Shp(5188, 7, 7, 2), f32, Bl, Z, t, f1, f2);
         result = result && SynetGridSample2dAutoTest<float>(Shp(5188, 1, 13, 24), Shp(5188, 7, 7, 2), f32, Bl, Z, t, f1, f2);
+        result = result && SynetGridSample2dRefAutoTest(Shp(1, 3, 9, 11), Shp(1, 7, 8, 2), f1);
 #endif
 
         return result;
@@ -253,6 +253,171 @@ namespace Test
             result = result && SynetInnerProduct16bForwardAutoTest(EPS, FUNC_IP16B(Simd::AmxBf16::SynetInnerProduct16bInit), FUNC_IP16B(SimdSynetInnerProduct16bInit));
 #endif
 
+        return result;
+    }
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncIP16bWq
+        {
+            typedef void* (*FuncPtr)(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeC, SimdBool transB, SimdBool bias, size_t bits, size_t group);
+
+            FuncPtr func;
+            String desc;
+
+            FuncIP16bWq(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(const Simd::InnerProductParam16b& p)
+            {
+                desc = desc + "[" + p.Info() + "]";
+            }
+
+            void Call(void* context, const uint8_t* A, uint8_t* buf, uint8_t* C) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetInnerProduct16bForward(context, A, NULL, buf, C);
+            }
+        };
+
+        struct FuncIP32f
+        {
+            String desc;
+
+            FuncIP32f(const Simd::InnerProductParam16b& p) : desc(String("SimdSynetInnerProduct32fForward[") + p.Info() + "]") {}
+
+            void Call(void* context, const float* A, float* C) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetInnerProduct32fForward(context, A, C);
+            }
+        };
+    }
+
+#define FUNC_IP16BWQ(function) \
+    FuncIP16bWq(function, std::string(#function))
+
+    bool SynetInnerProduct16bWqForwardAutoTest(float eps, const Simd::InnerProductParam16b& p, FuncIP16bWq f1, FuncIP16bWq f2)
+    {
+        bool result = true;
+
+        f1.Update(p);
+        f2.Update(p);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Shape sA = Shp(p.M, p.K), sB = p.transB ? Shp(p.N, p.K) : Shp(p.K, p.N), sC = Shp(p.M, p.N);
+        Tensor32f Af(sA), Bf(sB), C1f(sC), C2f(sC), C3f(sC), bias(Shp(p.N));
+        Tensor16u Ab(sA), C1b(sC), C2b(sC);
+
+        FillRandom(Af.Data(), Af.Size(), -1.0, 1.0f);
+        FillRandom(Bf.Data(), Bf.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        SimdFloat32ToBFloat16(Af.Data(), Af.Size(), Ab.Data());
+
+        const uint8_t* A = p.typeA == SimdTensorData32f ? (uint8_t*)Af.Data() : (uint8_t*)Ab.Data();
+        uint8_t* C1 = p.typeC == SimdTensorData32f ? (uint8_t*)C1f.Data() : (uint8_t*)C1b.Data();
+        uint8_t* C2 = p.typeC == SimdTensorData32f ? (uint8_t*)C2f.Data() : (uint8_t*)C2b.Data();
+
+        void* context1 = f1.func(p.M, p.N, p.K, p.typeA, p.typeC, p.transB, p.bias, p.qBits, p.qGroup);
+        void* context2 = f2.func(p.M, p.N, p.K, p.typeA, p.typeC, p.transB, p.bias, p.qBits, p.qGroup);
+        void* context3 = ::SimdSynetInnerProduct32fInit(p.M, p.K, p.N, p.transB, SimdConvolutionActivationIdentity);
+        if (context1 == NULL || context2 == NULL || context3 == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't create inner product context!");
+            ::SimdRelease(context1);
+            ::SimdRelease(context2);
+            ::SimdRelease(context3);
+            return false;
+        }
+
+        ::SimdSynetInnerProduct16bSetParams(context1, Bf.Data(), bias.Data());
+        ::SimdSynetInnerProduct16bSetParams(context2, Bf.Data(), bias.Data());
+        ::SimdSynetInnerProduct32fSetParams(context3, Bf.Data(), NULL, p.bias ? bias.Data() : NULL, NULL);
+
+        Tensor8u buf;
+        buf.Extend(Shp(SimdSynetInnerProduct16bExternalBufferSize(context1)));
+        buf.Extend(Shp(SimdSynetInnerProduct16bExternalBufferSize(context2)));
+
+        FuncIP32f f3(p);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, A, buf.Data(), C1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, A, buf.Data(), C2));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f3.Call(context3, Af.Data(), C3f.Data()));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+        ::SimdRelease(context3);
+
+        if (p.typeC == SimdTensorData16b)
+        {
+            eps = eps * 7.1f;
+            SimdBFloat16ToFloat32(C1b.Data(), C1b.Size(), C1f.Data());
+            SimdBFloat16ToFloat32(C2b.Data(), C2b.Size(), C2f.Data());
+        }
+        result = result && Compare(C1f, C2f, eps, true, 64, DifferenceBoth);
+
+        float e = GetRange(C3f.Data(), C3f.Size()) * (p.qBits == 4 ? 0.08f : 0.02f);
+        result = result && Compare(C1f, C3f, e, true, 64, DifferenceAbsolute, " Compare to SynetInnerProduct32f.");
+
+        return result;
+    }
+
+    bool SynetInnerProduct16bWqForwardAutoTest(float eps, const FuncIP16bWq& f1, const FuncIP16bWq& f2)
+    {
+        bool result = true;
+
+        SimdBool t = SimdTrue, f = SimdFalse;
+        const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+        using Param = Simd::InnerProductParam16b;
+
+#if defined(NDEBUG)
+        result = result && SynetInnerProduct16bWqForwardAutoTest(eps, Param(1, 1024, 1024, b16, f32, b16, t, t, t, 4, 32), f1, f2);
+        result = result && SynetInnerProduct16bWqForwardAutoTest(eps, Param(1, 1024, 1024, f32, f32, f32, t, t, t, 8, 128), f1, f2);
+        result = result && SynetInnerProduct16bWqForwardAutoTest(eps, Param(3, 1000, 1000, f32, f32, b16, f, t, t, 4, 64), f1, f2);
+        result = result && SynetInnerProduct16bWqForwardAutoTest(eps, Param(64, 512, 512, b16, f32, f32, t, t, f, 4, 128), f1, f2);
+        result = result && SynetInnerProduct16bWqForwardAutoTest(eps, Param(127, 129, 131, f32, f32, f32, f, t, t, 8, 32), f1, f2);
+#else
+        result = result && SynetInnerProduct16bWqForwardAutoTest(eps, Param(1, 100, 200, b16, f32, f32, t, t, t, 4, 64), f1, f2);
+        result = result && SynetInnerProduct16bWqForwardAutoTest(eps, Param(17, 100, 130, f32, f32, b16, f, t, t, 8, 32), f1, f2);
+#endif
+
+        return result;
+    }
+
+    bool SynetInnerProduct16bWqForwardAutoTest(const Options& options)
+    {
+        const float EPS = 0.001f;
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SynetInnerProduct16bWqForwardAutoTest(EPS, FUNC_IP16BWQ(Simd::Base::SynetInnerProduct16bInitWq), FUNC_IP16BWQ(SimdSynetInnerProduct16bInitWq));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && SynetInnerProduct16bWqForwardAutoTest(EPS, FUNC_IP16BWQ(Simd::Sse41::SynetInnerProduct16bInitWq), FUNC_IP16BWQ(SimdSynetInnerProduct16bInitWq));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SynetInnerProduct16bWqForwardAutoTest(EPS, FUNC_IP16BWQ(Simd::Avx2::SynetInnerProduct16bInitWq), FUNC_IP16BWQ(SimdSynetInnerProduct16bInitWq));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SynetInnerProduct16bWqForwardAutoTest(EPS, FUNC_IP16BWQ(Simd::Avx512bw::SynetInnerProduct16bInitWq), FUNC_IP16BWQ(SimdSynetInnerProduct16bInitWq));
+#endif
+
+#if (defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE)))   
+        if (Simd::AmxBf16::Enable && TestAmxBf16(options))
+            result = result && SynetInnerProduct16bWqForwardAutoTest(EPS, FUNC_IP16BWQ(Simd::AmxBf16::SynetInnerProduct16bInitWq), FUNC_IP16BWQ(SimdSynetInnerProduct16bInitWq));
+#endif
+
         return result;
     }
 #endif
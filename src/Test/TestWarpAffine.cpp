@@ -24,6 +24,7 @@
 #include "Test/TestCompare.h"
 #include "Test/TestPerformance.h"
 #include "Test/TestString.h"
+#include "Test/TestTensor.h"
 #include "Test/TestRandom.h"
 #include "Test/TestFile.h"
 #include "Test/TestOptions.h"
@@ -50,7 +51,13 @@ namespace Test
             {
                 std::stringstream ss;
                 ss << description << "[" << channels;
-                ss << "-" << ((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte ? "b" : "?");
+                switch (flags & SimdWarpAffineChannelMask)
+                {
+                case SimdWarpAffineChannelByte: ss << "-b"; break;
+                case SimdWarpAffineChannelShort: ss << "-s"; break;
+                case SimdWarpAffineChannelFloat: ss << "-f"; break;
+                default: ss << "-?";
+                }
                 ss << "-" << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest ? "nr" : "bl");
                 ss << "-" << ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant ? "c" : "t") << "-{ ";
                 for(int i = 0; i < 6; ++i)
@@ -59,10 +66,10 @@ namespace Test
                 description = ss.str();
             }
 
-            void Call(const View & src, View & dst, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border, const View & buf) const
+            void Call(size_t srcW, const View & src, size_t dstW, View & dst, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border, const View & buf) const
             {
                 void * context = NULL;
-                context = func(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, channels, mat, flags, border);
+                context = func(srcW, src.height, src.stride, dstW, dst.height, dst.stride, channels, mat, flags, border);
                 if (context)
                 {
                     if ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear && (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderTransparent)
@@ -122,7 +129,9 @@ namespace Test
         TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " .");
 
         View::Format format;
-        if ((SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelByte)
+        size_t srcWidth = srcW, dstWidth = dstW;
+        SimdWarpAffineFlags channel = (SimdWarpAffineFlags)(SimdWarpAffineChannelMask & flags);
+        if (channel == SimdWarpAffineChannelByte)
         {
             switch (channels)
             {
@@ -135,11 +144,15 @@ namespace Test
             }
         }
         else
-            assert(0);
+        {
+            format = channel == SimdWarpAffineChannelShort ? View::Int16 : View::Float;
+            srcWidth *= channels;
+            dstWidth *= channels;
+        }
 
-        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        View src(srcWidth, srcH, format, NULL, TEST_ALIGN(srcWidth));
         
-        if ((SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelByte)
+        if (channel == SimdWarpAffineChannelByte)
         {
 #ifdef TEST_WARP_AFFINE_REAL_IMAGE
             ::srand(0);
@@ -148,30 +161,45 @@ namespace Test
             FillRandom(src);
 #endif
         }
+        else if (channel == SimdWarpAffineChannelShort)
+        {
+            for (size_t row = 0; row < src.height; ++row)
+                for (size_t col = 0; col < src.width; ++col)
+                    src.At<uint16_t>(col, row) = uint16_t(Random(4096));
+        }
+        else
+            FillRandom32f(src, -1.0f, 1.0f);
 
-        View buf(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
-        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
-        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View buf(dstWidth, dstH, format, NULL, TEST_ALIGN(dstWidth));
+        View dst1(dstWidth, dstH, format, NULL, TEST_ALIGN(dstWidth));
+        View dst2(dstWidth, dstH, format, NULL, TEST_ALIGN(dstWidth));
         Simd::Fill(dst1, 0x33);
         if((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant)
             Simd::Fill(dst2, 0x99);
         else
             Simd::Fill(dst2, 0x33);
         Simd::Copy(dst1, buf);
-        uint8_t border[4] = { 11, 33, 55, 77 };
+        uint8_t border8u[4] = { 11, 33, 55, 77 };
+        uint16_t border16u[4] = { 1100, 3300, 5500, 7700 };
+        float border32f[4] = { -0.5f, 0.25f, 0.5f, 0.75f };
+        const uint8_t* border = channel == SimdWarpAffineChannelByte ? border8u : 
+            (channel == SimdWarpAffineChannelShort ? (uint8_t*)border16u : (uint8_t*)border32f);
 
         TEST_ALIGN(SIMD_ALIGN);
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, mat, flags, border, buf));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(srcW, src, dstW, dst1, channels, mat, flags, border, buf));
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, mat, flags, border, buf));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(srcW, src, dstW, dst2, channels, mat, flags, border, buf));
 
 #if !((defined(_WIN32) && defined(SIMD_X86_ENABLE) && defined(_DEBUG)) || (defined(__clang__) && !defined(NDEBUG)))
-        result = result && Compare(dst1, dst2, 0, true, 64);
+        if (channel == SimdWarpAffineChannelFloat)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, channel == SimdWarpAffineChannelShort ? 4 : 0, true, 64);
 #endif
 
 #if defined(TEST_WARP_AFFINE_REAL_IMAGE)
-        if (!result)
+        if (!result && channel == SimdWarpAffineChannelByte)
         {
             SaveImage(src, String("src"));
             SaveImage(dst1, String("dst1"));
@@ -219,7 +247,7 @@ namespace Test
         }
 #endif
 
-        std::vector<SimdWarpAffineFlags> channel = { SimdWarpAffineChannelByte };
+        std::vector<SimdWarpAffineFlags> channel = { SimdWarpAffineChannelByte, SimdWarpAffineChannelShort, SimdWarpAffineChannelFloat };
         std::vector<SimdWarpAffineFlags> interp = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear };
         std::vector<SimdWarpAffineFlags> border = { SimdWarpAffineBorderConstant, SimdWarpAffineBorderTransparent };
         for (size_t c = 0; c < channel.size(); ++c)
@@ -269,6 +297,176 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncWAB
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels,
+                SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* mean, const float* std);
+
+            FuncPtr func;
+            String description;
+
+            FuncWAB(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(size_t dstW, size_t dstH, size_t channels, size_t batch, SimdWarpAffineFlags flags, SimdTensorDataType type)
+            {
+                std::stringstream ss;
+                ss << description << "[" << batch << "x" << dstH << "x" << dstW << "x" << channels;
+                ss << "-" << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest ? "nr" : "bl");
+                ss << "-" << ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant ? "c" : "t");
+                ss << "-" << ToString(type) << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, const Buffer32f & mats, size_t batch, SimdWarpAffineFlags flags, const uint8_t* border, 
+                SimdTensorDataType type, const float* mean, const float* std, size_t dstW, size_t dstH, uint8_t* dst, const Buffer8u & buf) const
+            {
+                size_t channels = src.ChannelCount();
+                void * context = func(src.width, src.height, src.stride, dstW, dstH, channels, flags, border, type, mean, std);
+                if (context)
+                {
+                    if ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear && (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderTransparent)
+                        memcpy(dst, buf.data(), buf.size());
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdWarpAffineBatchRun(context, src.data, mats.data(), batch, dst);
+                    }
+                    SimdRelease(context);
+                }
+            }
+        };
+    }
+
+#define FUNC_WAB(function) \
+    FuncWAB(function, std::string(#function))
+
+    bool WarpAffineBatchCheck(const uint8_t* dst, SimdTensorDataType type, const Buffer8u& ref8u, size_t channels, const float* mean, const float* std, const String& desc)
+    {
+        size_t size = ref8u.size();
+        if (type == SimdTensorData8u)
+            return Compare(dst, size, ref8u.data(), size, 0, true, 64, desc);
+        Buffer32f dst32f(size), ref32f(size);
+        for (size_t i = 0; i < size; ++i)
+            ref32f[i] = (float(ref8u[i]) - mean[i % channels]) / std[i % channels];
+        if (type == SimdTensorData32f)
+        {
+            memcpy(dst32f.data(), dst, size * sizeof(float));
+            return Compare(dst32f, ref32f, EPS, true, 64, DifferenceBoth, desc);
+        }
+        else
+        {
+            SimdBFloat16ToFloat32((uint16_t*)dst, size, dst32f.data());
+            return Compare(dst32f, ref32f, 0.02f, true, 64, DifferenceBoth, desc);
+        }
+    }
+
+    bool WarpAffineBatchAutoTest(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, size_t batch, SimdWarpAffineFlags flags, SimdTensorDataType type, FuncWAB f1, FuncWAB f2)
+    {
+        bool result = true;
+
+        f1.Update(dstW, dstH, channels, batch, flags, type);
+        f2.Update(dstW, dstH, channels, batch, flags, type);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " .");
+
+        View::Format format = View::None;
+        switch (channels)
+        {
+        case 1: format = View::Gray8; break;
+        case 2: format = View::Uv16; break;
+        case 3: format = View::Bgr24; break;
+        case 4: format = View::Bgra32; break;
+        default:
+            assert(0);
+        }
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        ::srand(0);
+        FillPicture(src);
+
+        Buffer32f mats(batch * 6);
+        for (size_t b = 0; b < batch; ++b)
+        {
+            float angle = 0.25f * (float(b) - float(batch) / 2.0f), scale = float(dstW) / float(srcW) * 2.0f * (1.0f + 0.1f * float(b % 3));
+            float cx = float(srcW) * (0.3f + 0.4f * float(Random())), cy = float(srcH) * (0.3f + 0.4f * float(Random()));
+            float* m = mats.data() + b * 6;
+            m[0] = scale * ::cos(angle), m[1] = -scale * ::sin(angle);
+            m[3] = scale * ::sin(angle), m[4] = scale * ::cos(angle);
+            m[2] = float(dstW) / 2.0f - m[0] * cx - m[1] * cy;
+            m[5] = float(dstH) / 2.0f - m[3] * cx - m[4] * cy;
+        }
+        uint8_t border[4] = { 11, 33, 55, 77 };
+        float mean[4] = { 127.5f, 120.0f, 110.0f, 100.0f }, std[4] = { 128.0f, 60.0f, 70.0f, 80.0f };
+
+        size_t crop = dstH * dstW * channels, size = batch * crop;
+        size_t elem = type == SimdTensorData8u ? 1 : (type == SimdTensorData32f ? 4 : 2);
+        Buffer8u ref(size, 0x33), buf(size * elem, 0x33), dst1(size * elem, 0x33), dst2(size * elem, 0x33);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, mats, batch, flags, border, type, mean, std, dstW, dstH, dst1.data(), buf));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, mats, batch, flags, border, type, mean, std, dstW, dstH, dst2.data(), buf));
+
+        for (size_t b = 0; b < batch; ++b)
+        {
+            void* context = SimdWarpAffineInit(srcW, srcH, src.stride, dstW, dstH, dstW * channels, channels, mats.data() + b * 6, flags, border);
+            SimdWarpAffineRun(context, src.data, ref.data() + b * crop);
+            SimdRelease(context);
+        }
+
+        result = result && WarpAffineBatchCheck(dst1.data(), type, ref, channels, mean, std, "dst1");
+        result = result && WarpAffineBatchCheck(dst2.data(), type, ref, channels, mean, std, "dst2");
+
+        return result;
+    }
+
+    bool WarpAffineBatchAutoTest(const FuncWAB & f1, const FuncWAB & f2)
+    {
+        bool result = true;
+
+        SimdWarpAffineFlags Bc = (SimdWarpAffineFlags)(SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant);
+        SimdWarpAffineFlags Bt = (SimdWarpAffineFlags)(SimdWarpAffineInterpBilinear | SimdWarpAffineBorderTransparent);
+        SimdWarpAffineFlags Nc = (SimdWarpAffineFlags)(SimdWarpAffineInterpNearest | SimdWarpAffineBorderConstant);
+        SimdTensorDataType f32 = SimdTensorData32f, u8 = SimdTensorData8u, b16 = SimdTensorData16b;
+
+        result = result && WarpAffineBatchAutoTest(W, H, 112, 112, 3, 16, Bc, u8, f1, f2);
+        result = result && WarpAffineBatchAutoTest(W, H, 112, 112, 3, 16, Bc, f32, f1, f2);
+        result = result && WarpAffineBatchAutoTest(W, H, 112, 112, 3, 16, Bc, b16, f1, f2);
+        result = result && WarpAffineBatchAutoTest(W, H, 96, 96, 4, 5, Bt, u8, f1, f2);
+        result = result && WarpAffineBatchAutoTest(W, H, 61, 67, 1, 7, Nc, f32, f1, f2);
+        result = result && WarpAffineBatchAutoTest(W, H, 61, 67, 2, 3, Bc, b16, f1, f2);
+
+        return result;
+    }
+
+    bool WarpAffineBatchAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Base::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Sse41::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Avx2::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Avx512bw::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+#endif
+
+        return result;
+    }
 }
 
 //-------------------------------------------------------------------------------------------------